@@ -28,12 +28,13 @@ rem Source
 cl /c %compile_flags% src/containers/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/fileio/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/serialization/json/*.cpp %defines% %includes% & ^
-cl /c %compile_flags% src/math/constants.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/math/constants.cpp src/math/random.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/core/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/platform/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/physics/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/engine/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/graphics/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/game/*.cpp %defines% %includes% & ^
 cl /c %compile_flags% src/main.cpp %defines% %includes%
 
 rem Resources
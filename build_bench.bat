@@ -0,0 +1,57 @@
+@echo off
+
+set includes= /I src /I dependencies\glad\include /I dependencies\wglext\include /I dependencies\stb\include
+
+set libs= Shell32.lib                     ^
+          User32.lib                      ^
+          Gdi32.lib                       ^
+          OpenGL32.lib                    ^
+          msvcrt.lib                      ^
+          dependencies\glad\lib\glad.lib  ^
+          dependencies\stb\lib\stb.lib
+
+set defines= /DGN_USE_OPENGL /DGN_PLATFORM_WINDOWS /DGN_RELEASE /DNDEBUG /DGN_TRACK_ALLOCATIONS
+set compile_flags= /O2 /EHsc /std:c++17 /MP7
+set link_flags= /NODEFAULTLIB:LIBCMT
+
+rem Remove existing files
+del word_lookup_bench.exe
+del game_bench.exe
+del hash_bench.exe
+del table_churn_bench.exe
+del batch_find_bench.exe
+
+rem Shared Source (the game code needs the worker pool and the platform layer)
+cl /c %compile_flags% src/containers/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/math/random.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/core/application_internal.cpp src/core/input_processing.cpp src/core/jobs.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/platform/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/graphics/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/game/*.cpp %defines% %includes%
+
+lib *.obj /OUT:bench_shared.lib
+del *.obj
+
+rem Word lookup benchmark
+cl /c %compile_flags% src/benchmarks/word_lookup_bench.cpp %defines% %includes%
+link word_lookup_bench.obj bench_shared.lib %libs% /OUT:word_lookup_bench.exe %link_flags%
+
+rem Game logic benchmarks
+cl /c %compile_flags% src/benchmarks/game_bench.cpp %defines% %includes%
+link game_bench.obj bench_shared.lib %libs% /OUT:game_bench.exe %link_flags%
+
+rem Hash function quality and throughput
+cl /c %compile_flags% src/benchmarks/hash_bench.cpp %defines% %includes%
+link hash_bench.obj bench_shared.lib %libs% /OUT:hash_bench.exe %link_flags%
+
+rem Hash tables under remove and insert churn
+cl /c %compile_flags% src/benchmarks/table_churn_bench.cpp %defines% %includes%
+link table_churn_bench.obj bench_shared.lib %libs% /OUT:table_churn_bench.exe %link_flags%
+
+rem Batched lookups against one Find after another
+cl /c %compile_flags% src/benchmarks/batch_find_bench.cpp %defines% %includes%
+link batch_find_bench.obj bench_shared.lib %libs% /OUT:batch_find_bench.exe %link_flags%
+
+rem Delete Intermediate Files
+del *.obj
+del bench_shared.lib
@@ -0,0 +1,25 @@
+#!/bin/sh
+# Builds the benchmarks on Linux. Allocation tracking is compiled into the
+# platform layer here so the benchmarks can report allocations per operation.
+#
+# Usage: ./build_bench.sh
+
+set -e
+
+includes="-I src"
+libs="-lpthread"
+
+defines="-DGN_PLATFORM_LINUX -DGN_RELEASE -DNDEBUG -DGN_TRACK_ALLOCATIONS"
+compile_flags="-O2 -std=c++17"
+
+CXX=${CXX:-g++}
+
+# Shared Source
+shared="src/math/random.cpp src/core/jobs.cpp src/platform/platform_linux.cpp src/game/*.cpp"
+
+# Benchmarks
+$CXX $compile_flags $defines $includes $shared src/benchmarks/word_lookup_bench.cpp $libs -o word_lookup_bench
+$CXX $compile_flags $defines $includes $shared src/benchmarks/game_bench.cpp $libs -o game_bench
+$CXX $compile_flags $defines $includes $shared src/containers/stringpool.cpp src/benchmarks/hash_bench.cpp $libs -o hash_bench
+$CXX $compile_flags $defines $includes $shared src/benchmarks/table_churn_bench.cpp $libs -o table_churn_bench
+$CXX $compile_flags $defines $includes $shared src/benchmarks/batch_find_bench.cpp $libs -o batch_find_bench
@@ -0,0 +1,59 @@
+@echo off
+
+set includes= /I src /I dependencies\glad\include /I dependencies\wglext\include /I dependencies\stb\include
+
+set libs= Shell32.lib                     ^
+          User32.lib                      ^
+          Gdi32.lib                       ^
+          OpenGL32.lib                    ^
+          msvcrt.lib                      ^
+          dependencies\glad\lib\glad.lib  ^
+          dependencies\stb\lib\stb.lib
+
+set defines= /DGN_USE_OPENGL /DGN_PLATFORM_WINDOWS /DGN_RELEASE /DNDEBUG
+set compile_flags= /O2 /EHsc /std:c++17 /MP7
+set link_flags= /NODEFAULTLIB:LIBCMT
+
+rem Remove existing files
+del build_feedback_matrix.exe simulate.exe build_decision_tree.exe build_opening_book.exe build_word_list.exe build_word_dawg.exe replay_stats.exe tournament.exe
+
+rem Shared Source (everything the game uses except main and the entry point)
+cl /c %compile_flags% src/containers/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/math/random.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/core/application_internal.cpp src/core/input_processing.cpp src/core/jobs.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/platform/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/graphics/*.cpp %defines% %includes% & ^
+cl /c %compile_flags% src/game/*.cpp %defines% %includes%
+
+lib *.obj /OUT:tools_shared.lib
+del *.obj
+
+rem Tools
+cl /c %compile_flags% src/tools/build_feedback_matrix.cpp %defines% %includes%
+link build_feedback_matrix.obj tools_shared.lib %libs% /OUT:build_feedback_matrix.exe %link_flags%
+
+cl /c %compile_flags% src/tools/simulate.cpp %defines% %includes%
+link simulate.obj tools_shared.lib %libs% /OUT:simulate.exe %link_flags%
+
+cl /c %compile_flags% src/tools/build_decision_tree.cpp %defines% %includes%
+link build_decision_tree.obj tools_shared.lib %libs% /OUT:build_decision_tree.exe %link_flags%
+
+cl /c %compile_flags% src/tools/build_opening_book.cpp %defines% %includes%
+link build_opening_book.obj tools_shared.lib %libs% /OUT:build_opening_book.exe %link_flags%
+
+cl /c %compile_flags% src/tools/build_word_list.cpp %defines% %includes%
+link build_word_list.obj tools_shared.lib %libs% /OUT:build_word_list.exe %link_flags%
+
+cl /c %compile_flags% src/tools/build_word_dawg.cpp %defines% %includes%
+link build_word_dawg.obj tools_shared.lib %libs% /OUT:build_word_dawg.exe %link_flags%
+
+cl /c %compile_flags% src/tools/replay_stats.cpp %defines% %includes%
+link replay_stats.obj tools_shared.lib %libs% /OUT:replay_stats.exe %link_flags%
+
+rem Strategy tournament
+cl /c %compile_flags% src/tools/tournament.cpp %defines% %includes%
+link tournament.obj tools_shared.lib %libs% /OUT:tournament.exe %link_flags%
+
+rem Delete Intermediate Files
+del *.obj
+del tools_shared.lib
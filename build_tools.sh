@@ -0,0 +1,37 @@
+#!/bin/sh
+# Builds the headless tools on Linux. There's no window or renderer on Linux,
+# so only the game logic, worker pool and platform basics get compiled.
+#
+# Usage: ./build_tools.sh [debug]
+
+set -e
+
+includes="-I src"
+libs="-lpthread"
+
+if [ "$1" = "debug" ]; then
+    defines="-DGN_PLATFORM_LINUX -DGN_DEBUG"
+    compile_flags="-g -std=c++17"
+else
+    defines="-DGN_PLATFORM_LINUX -DGN_RELEASE -DNDEBUG"
+    compile_flags="-O2 -std=c++17"
+fi
+
+CXX=${CXX:-g++}
+
+# Shared Source
+shared="src/math/random.cpp src/core/jobs.cpp src/platform/platform_linux.cpp src/game/*.cpp"
+
+# Tools
+$CXX $compile_flags $defines $includes $shared src/tools/build_feedback_matrix.cpp $libs -o build_feedback_matrix
+$CXX $compile_flags $defines $includes $shared src/tools/simulate.cpp $libs -o simulate
+$CXX $compile_flags $defines $includes $shared src/tools/build_decision_tree.cpp $libs -o build_decision_tree
+$CXX $compile_flags $defines $includes $shared src/tools/build_opening_book.cpp $libs -o build_opening_book
+$CXX $compile_flags $defines $includes $shared src/tools/build_word_list.cpp $libs -o build_word_list
+$CXX $compile_flags $defines $includes src/tools/build_word_dawg.cpp $libs -o build_word_dawg
+$CXX $compile_flags $defines $includes $shared src/tools/replay_stats.cpp $libs -o replay_stats
+$CXX $compile_flags $defines $includes $shared src/tools/tournament.cpp $libs -o tournament
+
+# Puzzle server and its load generator, these use epoll so they're Linux only
+$CXX $compile_flags $defines $includes $shared src/tools/puzzle_server.cpp $libs -o puzzle_server
+$CXX $compile_flags $defines $includes $shared src/tools/puzzle_client.cpp $libs -o puzzle_client
@@ -7,6 +7,14 @@ call build release
 echo Build Finished successfully!
 echo.
 
+echo Building data files...
+call build_tools
+build_word_list.exe assets/words5.bin
+build_feedback_matrix.exe assets/feedback_matrix.bin
+build_decision_tree.exe --opening salet assets/decision_tree.bin
+build_opening_book.exe --output assets/opening_book.bin
+echo.
+
 if not exist %exportDir% md %exportDir%
 if not exist %exportDir%\assets md %exportDir%\assets
 
@@ -0,0 +1,205 @@
+// Benchmarks looking up many keys at once with HashTable::FindMany and
+// HashSet::ContainsMany against calling Find for one key after another.
+//
+// Usage: batch_find_bench [--csv] [--keys N]
+//
+// Tables of u64 keys go from ones that fit in L1 to ones far bigger than
+// L2, where every lookup is a cache miss and overlapping them is what
+// counts. Half the looked up keys are in the table, in random order, and
+// the batched functions get them 1024 at a time. Every time is the best
+// of a few runs, taken in turn so noise hits them all alike. --keys runs
+// one size.
+
+#include "core/types.h"
+#include "containers/hashing.h"
+#include "containers/hashset.h"
+#include "containers/hashtable.h"
+#include "platform/platform.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static constexpr u64 lookupCount = 1 << 20;
+static constexpr u64 callSize = 1024;
+static constexpr s32 runCount = 9;
+
+// Results get folded in here so the compiler can't drop the work
+static volatile u64 sink;
+
+static inline f64 GetSeconds()
+{
+    return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Keys 0 to keyCount - 1 are in the table, anything past that isn't
+static inline u64 MakeKey(u64 counter)
+{
+    return Hashing::Mix(counter ^ 0xBA7C4ull);
+}
+
+struct Result
+{
+    f64 findNs;
+    f64 findManyNs;
+    f64 containsNs;
+    f64 containsManyNs;
+};
+
+static inline void KeepBest(f64& best, f64 seconds)
+{
+    f64 ns = seconds * 1e9 / lookupCount;
+    best = (best == 0.0 || ns < best) ? ns : best;
+}
+
+static Result RunLookups(u64 keyCount, const u64* queries)
+{
+    Result result = {};
+
+    HashTable<u64, u64>* table = new HashTable<u64, u64>();
+    HashSet<u64>* set = new HashSet<u64>();
+
+    for (u64 i = 0; i < keyCount; i++)
+    {
+        table->Place(MakeKey(i), i);
+        set->Place(MakeKey(i));
+    }
+
+    u64* values[callSize];
+    bool contains[callSize];
+
+    // The four are timed in turn every run, so a noisy stretch slows all of them alike
+    for (s32 run = 0; run < runCount; run++)
+    {
+        {   // Find
+            u64 sum = 0;
+            f64 start = GetSeconds();
+
+            for (u64 i = 0; i < lookupCount; i++)
+            {
+                auto it = table->Find(queries[i]);
+                if (it)
+                    sum += it.value();
+            }
+
+            KeepBest(result.findNs, GetSeconds() - start);
+            sink = sink + sum;
+        }
+
+        {   // FindMany
+            u64 sum = 0;
+            f64 start = GetSeconds();
+
+            for (u64 i = 0; i < lookupCount; i += callSize)
+            {
+                table->FindMany(queries + i, callSize, values);
+
+                for (u64 j = 0; j < callSize; j++)
+                {
+                    if (values[j])
+                        sum += *values[j];
+                }
+            }
+
+            KeepBest(result.findManyNs, GetSeconds() - start);
+            sink = sink + sum;
+        }
+
+        {   // Set Find
+            u64 found = 0;
+            f64 start = GetSeconds();
+
+            for (u64 i = 0; i < lookupCount; i++)
+                found += (bool) set->Find(queries[i]);
+
+            KeepBest(result.containsNs, GetSeconds() - start);
+            sink = sink + found;
+        }
+
+        {   // ContainsMany
+            u64 found = 0;
+            f64 start = GetSeconds();
+
+            for (u64 i = 0; i < lookupCount; i += callSize)
+                found += set->ContainsMany(queries + i, callSize, contains);
+
+            KeepBest(result.containsManyNs, GetSeconds() - start);
+            sink = sink + found;
+        }
+    }
+
+    delete table;
+    delete set;
+
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    u64 keyCounts[] = { 1 << 8, 1 << 12, 1 << 16, 1 << 18, 1 << 21 };
+    s32 sizeCount = sizeof(keyCounts) / sizeof(keyCounts[0]);
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else if (strcmp(argv[i], "--keys") == 0 && i + 1 < argc)
+        {
+            keyCounts[0] = strtoull(argv[++i], nullptr, 10);
+            sizeCount = 1;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: batch_find_bench [--csv] [--keys N]\n");
+            return 1;
+        }
+    }
+
+    u64* queries = (u64*) PlatformAllocate(lookupCount * sizeof(u64));
+
+    if (csv)
+        printf("keys,table_kb,find_ns,find_many_ns,contains_ns,contains_many_ns\n");
+    else
+        printf("%9s %10s %9s %13s %8s %12s %17s %8s\n", "Keys", "Table KB", "Find ns", "FindMany ns", "Speedup", "Contains ns", "ContainsMany ns", "Speedup");
+
+    for (s32 s = 0; s < sizeCount; s++)
+    {
+        u64 keyCount = keyCounts[s];
+
+        // Every other query is a key that isn't there
+        u64 state = 0x9E3779B97F4A7C15ull;
+        for (u64 i = 0; i < lookupCount; i++)
+        {
+            state = Hashing::Mix(state + i);
+            queries[i] = MakeKey((i & 1) ? keyCount + state % keyCount : state % keyCount);
+        }
+
+        Result result = RunLookups(keyCount, queries);
+
+        // What a table of this many keys takes up: a control byte, hash, key and value per slot
+        u64 capacity = HashGroup::GetCapacity(keyCount);
+        while (HashGroup::GetMaxLoad(capacity) < keyCount)
+            capacity *= 2;
+        u64 tableKb = capacity * (sizeof(u8) + sizeof(Hash) + 2 * sizeof(u64)) / 1024;
+
+        if (csv)
+        {
+            printf("%llu,%llu,%.2f,%.2f,%.2f,%.2f\n", (unsigned long long) keyCount, (unsigned long long) tableKb,
+                   result.findNs, result.findManyNs, result.containsNs, result.containsManyNs);
+        }
+        else
+        {
+            printf("%9llu %10llu %9.1f %13.1f %7.2fx %12.1f %17.1f %7.2fx\n", (unsigned long long) keyCount, (unsigned long long) tableKb,
+                   result.findNs, result.findManyNs, result.findNs / result.findManyNs,
+                   result.containsNs, result.containsManyNs, result.containsNs / result.containsManyNs);
+        }
+
+        fflush(stdout);
+    }
+
+    PlatformFree(queries);
+
+    return 0;
+}
@@ -0,0 +1,396 @@
+// Benchmarks the game logic hot paths: validating typed guesses, scoring,
+// narrowing the candidates, starting a new game, and whole games played by
+// a strategy.
+//
+// Usage: game_bench [--csv] [--filter <text>] [--time <seconds>]
+//
+// Prints a table by default. With --csv, prints one line per benchmark
+// (name,unit,ns_per_op,ops_per_sec,allocs_per_op) for scripts that track
+// regressions. --filter only runs benchmarks with the text in their name,
+// and --time is how long each one runs for (0.5 s by default).
+//
+// Allocations are counted through global operator new and, in builds with
+// GN_TRACK_ALLOCATIONS (build_bench does this), the platform layer. None of
+// these paths should allocate, so anything above 0 is a regression.
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/absurdle.h"
+#include "game/board.h"
+#include "game/candidates.h"
+#include "game/feedback_matrix.h"
+#include "game/game_state.h"
+#include "game/multi_board.h"
+#include "game/packed_word.h"
+#include "game/scoring.h"
+#include "game/strategies.h"
+#include "game/word_dawg.h"
+#include "game/word_index.h"
+#include "game/wordlist.h"
+#include "math/random.h"
+#include "platform/platform.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+// Allocation Counting
+
+static std::atomic<u64> newCount { 0 };
+
+void* operator new(size_t size)
+{
+    newCount.fetch_add(1, std::memory_order_relaxed);
+
+    void* block = malloc(size ? size : 1);
+    if (!block)
+        throw std::bad_alloc();
+
+    return block;
+}
+
+void operator delete(void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete(void* block, size_t size) noexcept
+{
+    free(block);
+}
+
+static u64 GetAllocationCount()
+{
+    u64 count = newCount.load(std::memory_order_relaxed);
+
+#ifdef GN_TRACK_ALLOCATIONS
+    count += PlatformGetAllocationCount();
+#endif
+
+    return count;
+}
+
+// Inputs
+
+static constexpr s32 queryCount = 4096;
+static constexpr s32 queryMask = queryCount - 1;
+
+static struct
+{
+    char words[queryCount][6];          // Half valid guesses, half near misses
+    PackedWord guesses[queryCount];     // Any word
+    PackedWord answers[queryCount];     // Answer words only
+    s32 guessIndices[queryCount];
+    s32 answerIndices[queryCount];
+} inputs;
+
+static void GenerateInputs()
+{
+    Math::RandomState random = Math::SeedRandom(0x6A6D65);
+
+    for (s32 i = 0; i < queryCount; i++)
+    {
+        const char* word = wordList[Math::RandomBounded(random, wordListSize)];
+        PlatformCopyMemory(inputs.words[i], word, 5);
+
+        if (i & 1)
+            inputs.words[i][4] = 'Q';
+
+        inputs.words[i][5] = '\0';
+
+        inputs.guessIndices[i] = (s32) Math::RandomBounded(random, wordListSize);
+        inputs.answerIndices[i] = (s32) Math::RandomBounded(random, answersEnd);
+        inputs.guesses[i] = packedWordList[inputs.guessIndices[i]];
+        inputs.answers[i] = packedWordList[inputs.answerIndices[i]];
+    }
+}
+
+// Results get folded in here so the compiler can't drop the work
+static volatile u64 sink;
+
+// Benchmarks, each one runs its operation count times
+
+static void ValidateIndex(s64 count)
+{
+    u64 hits = 0;
+    for (s64 i = 0; i < count; i++)
+        hits += WordIndex::Contains(inputs.words[i & queryMask]);
+
+    sink = sink + hits;
+}
+
+static void ValidateDawg(s64 count)
+{
+    u64 hits = 0;
+    for (s64 i = 0; i < count; i++)
+        hits += WordDawg::Contains(inputs.words[i & queryMask]);
+
+    sink = sink + hits;
+}
+
+static void ScoreSingle(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+        total += Scoring::Score(inputs.guesses[i & queryMask], inputs.answers[(i * 7) & queryMask]);
+
+    sink = sink + total;
+}
+
+// One operation is one answer scored, so it lines up with ScoreSingle
+static void ScoreBatch(s64 count)
+{
+    static Scoring::Feedback feedback[answersEnd + 8];
+
+    u64 total = 0;
+    for (s64 done = 0, i = 0; done < count; done += answersEnd, i++)
+    {
+        Scoring::ScoreBatch(inputs.guesses[i & queryMask], packedWordList, answersEnd, feedback);
+        total += feedback[i % answersEnd];
+    }
+
+    sink = sink + total;
+}
+
+// Narrowing every answer down by one guess, the biggest update a board ever does
+static void FilterFirstGuess(s64 count)
+{
+    CandidateSet fresh;
+    fresh.Reset();
+
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+    {
+        PackedWord guess = inputs.guesses[i & queryMask];
+        Scoring::Feedback feedback = Scoring::Score(guess, inputs.answers[i & queryMask]);
+
+        CandidateSet set = fresh;
+        set.Apply(guess, feedback);
+        total += set.Count();
+    }
+
+    sink = sink + total;
+}
+
+// The filtering step of Absurdle, every answer split by feedback
+static void FilterAbsurdle(s64 count)
+{
+    static u16 candidates[answersEnd];
+    static Absurdle::Partition partition;
+
+    for (s32 i = 0; i < answersEnd; i++)
+        candidates[i] = (u16) i;
+
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+    {
+        Absurdle::PartitionByFeedback(inputs.guessIndices[i & queryMask], candidates, answersEnd, partition);
+        total += Absurdle::PickBin(partition);
+    }
+
+    sink = sink + total;
+}
+
+// Everything StartGame resets, the rest of the game state in main.cpp needs a window
+struct GameState
+{
+    MultiBoard boards;
+    Board board;
+    AbsurdleBoard absurdle;
+    Math::RandomState random;
+};
+
+static inline void ResetGame(GameState& state, s32 boardCount, GameMode mode)
+{
+    StartGame(mode, boardCount, state.random, state.boards, state.board, state.absurdle);
+}
+
+static GameState gameState;
+
+static void ResetClassic(s64 count)
+{
+    for (s64 i = 0; i < count; i++)
+        ResetGame(gameState, 1, GameMode::CLASSIC);
+
+    sink = sink + gameState.board.answerIndex;
+}
+
+static void ResetMulti(s64 count)
+{
+    for (s64 i = 0; i < count; i++)
+        ResetGame(gameState, maxBoards, GameMode::CLASSIC);
+
+    sink = sink + gameState.boards.answerIndices[0];
+}
+
+static void ResetAbsurdle(s64 count)
+{
+    for (s64 i = 0; i < count; i++)
+        ResetGame(gameState, 1, GameMode::ABSURDLE);
+
+    sink = sink + gameState.absurdle.candidateCount;
+}
+
+static Strategies::Scratch* scratch;
+
+template <s32 (*NextGuess)(const Board&, Strategies::Scratch&)>
+static void PlayGames(s64 count)
+{
+    Board board;
+
+    u64 guesses = 0;
+    for (s64 i = 0; i < count; i++)
+    {
+        board.Reset(inputs.answerIndices[i & queryMask]);
+
+        while (board.status == BoardStatus::PLAYING)
+            board.Guess(NextGuess(board, *scratch));
+
+        guesses += board.guessCount;
+    }
+
+    sink = sink + guesses;
+}
+
+// Runner
+
+struct Benchmark
+{
+    const char* name;
+    const char* unit;           // What one operation is
+    void (*run)(s64 count);
+};
+
+static const Benchmark benchmarks[] = {
+    { "validate/index",         "lookup",   ValidateIndex },
+    { "validate/dawg",          "lookup",   ValidateDawg },
+    { "score/single",           "score",    ScoreSingle },
+    { "score/batch",            "score",    ScoreBatch },
+    { "filter/first_guess",     "filter",   FilterFirstGuess },
+    { "filter/absurdle",        "filter",   FilterAbsurdle },
+    { "reset/classic",          "reset",    ResetClassic },
+    { "reset/multi32",          "reset",    ResetMulti },
+    { "reset/absurdle",         "reset",    ResetAbsurdle },
+    { "game/first_candidate",   "game",     PlayGames<Strategies::FirstCandidate> },
+    { "game/max_entropy",       "game",     PlayGames<Strategies::MaxEntropy> },
+};
+
+struct Result
+{
+    f64 nsPerOp;
+    f64 allocationsPerOp;
+};
+
+static f64 TimeRun(const Benchmark& benchmark, s64 count)
+{
+    auto start = std::chrono::steady_clock::now();
+    benchmark.run(count);
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<f64>(end - start).count();
+}
+
+static Result RunBenchmark(const Benchmark& benchmark, f64 targetSeconds)
+{
+    // Double the count until a run is long enough to scale from, which also warms things up
+    s64 count = 1;
+    f64 seconds = TimeRun(benchmark, count);
+
+    while (seconds < targetSeconds / 10.0 && count < (1ll << 40))
+    {
+        count *= 2;
+        seconds = TimeRun(benchmark, count);
+    }
+
+    s64 scaled = (s64) (count * targetSeconds / ((seconds > 0.0) ? seconds : 1e-9));
+    count = (scaled > count) ? scaled : count;
+
+    u64 allocationsBefore = GetAllocationCount();
+    seconds = TimeRun(benchmark, count);
+    u64 allocations = GetAllocationCount() - allocationsBefore;
+
+    Result result;
+    result.nsPerOp = seconds * 1e9 / count;
+    result.allocationsPerOp = (f64) allocations / count;
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    const char* filter = nullptr;
+    f64 targetSeconds = 0.5;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--time") == 0 && i + 1 < argc)
+            targetSeconds = atof(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Usage: game_bench [--csv] [--filter <text>] [--time <seconds>]\n");
+            return 1;
+        }
+    }
+
+    // Everything the benchmarks touch is built up front so none of it gets timed
+    BuildWordList();
+    BuildPackedWordList();
+    WordIndex::Build();
+    CandidateIndex::Build();
+
+    Jobs::Init(1);
+
+    bool matrixLoaded = FeedbackMatrix::Load(FeedbackMatrix::defaultPath);
+    if (!matrixLoaded)
+        FeedbackMatrix::Build();
+
+    Strategies::Init();
+    scratch = (Strategies::Scratch*) PlatformAllocate(sizeof(Strategies::Scratch));
+
+    GenerateInputs();
+    gameState.random = Math::SeedRandom(0x7265736574);
+
+    if (csv)
+        printf("name,unit,ns_per_op,ops_per_sec,allocs_per_op\n");
+    else
+        printf("Feedback matrix %s, %.2f s per benchmark\n\n%-22s %14s %18s %12s\n",
+               matrixLoaded ? "loaded" : "built", targetSeconds, "Benchmark", "ns/op", "throughput", "allocs/op");
+
+    constexpr s32 benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+    for (s32 i = 0; i < benchmarkCount; i++)
+    {
+        const Benchmark& benchmark = benchmarks[i];
+        if (filter && !strstr(benchmark.name, filter))
+            continue;
+
+        Result result = RunBenchmark(benchmark, targetSeconds);
+        f64 perSecond = 1e9 / result.nsPerOp;
+
+        if (csv)
+        {
+            printf("%s,%s,%.3f,%.1f,%.4f\n", benchmark.name, benchmark.unit, result.nsPerOp, perSecond, result.allocationsPerOp);
+        }
+        else
+        {
+            char throughput[32];
+            snprintf(throughput, sizeof(throughput), "%.0f %s/s", perSecond, benchmark.unit);
+            printf("%-22s %14.1f %18s %12.2f\n", benchmark.name, result.nsPerOp, throughput, result.allocationsPerOp);
+        }
+
+        fflush(stdout);
+    }
+
+    PlatformFree(scratch);
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,519 @@
+// Checks the quality of the hash functions in containers/hashing.h and how
+// fast they are, next to the Hasher specializations they replaced.
+//
+// Usage: hash_bench [--csv] [--filter <text>] [--time <seconds>]
+//
+// Quality comes first:
+//     - avalanche flips every input bit of random keys and reports how far
+//       the worst and average output bit is from flipping half the time
+//       (0 is ideal, around 0.03 is noise at this sample count, 0.5 means
+//       an output bit never changes)
+//     - buckets hashes structured key sets (counters, strided ids, character
+//       pairs, texture paths) and reports chi squared over degrees of
+//       freedom for the low bits, which pick groups in HashTable, and the
+//       top 7 bits, which are the tags. Around 1 is uniform, higher is
+//       clustered.
+//
+// Then throughput, as a table or with --csv one line per benchmark
+// (name,unit,ns_per_op,ops_per_sec,bytes_per_sec). --filter only runs
+// benchmarks with the text in their name, and --time is how long each one
+// runs for (0.5 s by default).
+
+#include "core/types.h"
+#include "containers/hash.h"
+#include "containers/hashing.h"
+#include "containers/hashtable.h"
+#include "containers/string.h"
+#include "math/random.h"
+#include "platform/platform.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The old hashers, kept here to compare against
+
+static constexpr u32 legacyBytes[4] = {
+    0x000000FF,
+    0x0000FF00,
+    0x00FF0000,
+    0xFF000000
+};
+
+static inline u32 LegacyShuffle(u32 hash)
+{
+    return ((hash & legacyBytes[0]) << 16) |
+           ((hash & legacyBytes[1]) >>  8) |
+           ((hash & legacyBytes[2]) <<  8) |
+           ((hash & legacyBytes[3]) >> 16);
+}
+
+static inline u32 LegacyS32(s32 key)
+{
+    return LegacyShuffle((u32) key);
+}
+
+// The old one read whole u32s past the end, so this copies into a zeroed buffer first
+static u32 LegacyString(const char* str, u64 size)
+{
+    u32 padded[72] = {};
+    memcpy(padded, str, (size < sizeof(padded) - 4) ? size : sizeof(padded) - 4);
+
+    const u32* ptr = padded;
+    u64 count = (size / 4) + 1;
+
+    u32 hash = (u32) 0x8BDC195DFull;
+    while (count)
+    {
+        u32 val = *ptr;
+
+        hash = hash + hash * val * val * (u32) count * (u32) count;
+        hash = LegacyShuffle(hash);
+
+        count--;
+        ptr++;
+    }
+
+    return hash;
+}
+
+// Results get folded in here so the compiler can't drop the work
+static volatile u64 sink;
+
+// Quality
+
+static constexpr s32 avalancheSamples = 4096;
+static constexpr s32 keySetSize = 1 << 16;
+static constexpr s32 bucketBits = 12;
+
+using BytesHash = u64 (*)(const u8* key, u64 size);
+
+static u64 NewBytes(const u8* key, u64 size)    { return Hashing::Bytes(key, size); }
+static u64 NewMix(const u8* key, u64 size)      { u64 value = 0; memcpy(&value, key, size); return Hashing::Mix(value); }
+static u64 OldS32(const u8* key, u64 size)      { s32 value; memcpy(&value, key, 4); return LegacyS32(value); }
+static u64 OldString(const u8* key, u64 size)   { return LegacyString((const char*) key, size); }
+
+struct Avalanche
+{
+    f64 worstBias;
+    f64 meanBias;
+};
+
+// outputBits is 32 for the legacy hashes, the rest are 64
+static Avalanche MeasureAvalanche(BytesHash hash, u64 size, s32 outputBits)
+{
+    static u32 flips[64 * 8][64];
+    memset(flips, 0, sizeof(flips));
+
+    Math::RandomState random = Math::SeedRandom(0xA7A1A2C3 + size);
+    s32 inputBits = (s32) size * 8;
+
+    u8 key[64];
+    for (s32 sample = 0; sample < avalancheSamples; sample++)
+    {
+        for (u64 i = 0; i < size; i++)
+            key[i] = (u8) Math::RandomU32(random);
+
+        u64 base = hash(key, size);
+
+        for (s32 bit = 0; bit < inputBits; bit++)
+        {
+            key[bit / 8] ^= (u8) (1 << (bit % 8));
+            u64 changed = base ^ hash(key, size);
+            key[bit / 8] ^= (u8) (1 << (bit % 8));
+
+            for (s32 out = 0; out < outputBits; out++)
+                flips[bit][out] += (changed >> out) & 1;
+        }
+    }
+
+    Avalanche result = { 0.0, 0.0 };
+    for (s32 bit = 0; bit < inputBits; bit++)
+    {
+        for (s32 out = 0; out < outputBits; out++)
+        {
+            f64 bias = fabs((f64) flips[bit][out] / avalancheSamples - 0.5);
+            result.worstBias = (bias > result.worstBias) ? bias : result.worstBias;
+            result.meanBias += bias;
+        }
+    }
+
+    result.meanBias /= (f64) inputBits * outputBits;
+    return result;
+}
+
+// Chi squared over degrees of freedom, for the bucket counts of some hashes
+static f64 GetChiSquared(const u32* counts, s32 bucketCount, s32 keyCount)
+{
+    f64 expected = (f64) keyCount / bucketCount;
+
+    f64 sum = 0.0;
+    for (s32 i = 0; i < bucketCount; i++)
+        sum += (counts[i] - expected) * (counts[i] - expected) / expected;
+
+    return sum / (bucketCount - 1);
+}
+
+struct Distribution
+{
+    f64 lowBits;
+    f64 tagBits;
+};
+
+static Distribution MeasureDistribution(const u64* hashes, s32 count, s32 outputBits)
+{
+    static u32 low[1 << bucketBits];
+    static u32 tags[128];
+    memset(low, 0, sizeof(low));
+    memset(tags, 0, sizeof(tags));
+
+    for (s32 i = 0; i < count; i++)
+    {
+        low[hashes[i] & ((1 << bucketBits) - 1)]++;
+        tags[(hashes[i] >> (outputBits - 7)) & 0x7F]++;
+    }
+
+    Distribution result;
+    result.lowBits = GetChiSquared(low, 1 << bucketBits, count);
+    result.tagBits = GetChiSquared(tags, 128, count);
+    return result;
+}
+
+enum struct KeySet
+{
+    COUNTER,        // 0, 1, 2, ...
+    STRIDED,        // Ids 4096 apart
+    PAIRS,          // Character pairs, first << 16 | second
+    PATHS           // "assets/textures/tile_00042.png"
+};
+
+static const char* keySetNames[] = { "counter", "strided", "pairs", "paths" };
+
+static s32 MakeIntKey(KeySet set, s32 i)
+{
+    switch (set)
+    {
+        case KeySet::COUNTER: return i;
+        case KeySet::STRIDED: return i << 12;
+        case KeySet::PAIRS:   return ((32 + (i >> 8)) << 16) | (i & 0xFF);
+        default:              return i;
+    }
+}
+
+static void PrintQuality()
+{
+    static u64 hashes[keySetSize];
+
+    printf("Avalanche (worst / mean bias, 0 is ideal, %d samples)\n", avalancheSamples);
+
+    struct AvalancheCase { const char* name; BytesHash hash; u64 size; s32 outputBits; };
+    const AvalancheCase cases[] = {
+        { "mix/u32",         NewMix,    4,  64 },
+        { "mix/u64",         NewMix,    8,  64 },
+        { "bytes/3",         NewBytes,  3,  64 },
+        { "bytes/8",         NewBytes,  8,  64 },
+        { "bytes/16",        NewBytes,  16, 64 },
+        { "bytes/40",        NewBytes,  40, 64 },
+        { "legacy/s32",      OldS32,    4,  32 },
+        { "legacy/string/8", OldString, 8,  32 },
+        { "legacy/string/16",OldString, 16, 32 },
+    };
+
+    for (const AvalancheCase& c : cases)
+    {
+        Avalanche result = MeasureAvalanche(c.hash, c.size, c.outputBits);
+        printf("  %-22s %8.4f %8.4f\n", c.name, result.worstBias, result.meanBias);
+    }
+
+    printf("\nBuckets (chi squared / df, about 1 is uniform, %d keys)\n", keySetSize);
+    printf("  %-22s %10s %10s\n", "", "low bits", "tag bits");
+
+    for (s32 set = 0; set < 4; set++)
+    {
+        for (s32 legacy = 0; legacy < 2; legacy++)
+        {
+            char key[64];
+            for (s32 i = 0; i < keySetSize; i++)
+            {
+                if ((KeySet) set == KeySet::PATHS)
+                {
+                    s32 size = snprintf(key, sizeof(key), "assets/textures/tile_%05d.png", i);
+                    hashes[i] = legacy ? LegacyString(key, size) : Hashing::Bytes(key, size);
+                }
+                else
+                {
+                    s32 value = MakeIntKey((KeySet) set, i);
+                    hashes[i] = legacy ? LegacyS32(value) : Hasher<s32>()(value);
+                }
+            }
+
+            Distribution result = MeasureDistribution(hashes, keySetSize, legacy ? 32 : 64);
+
+            char name[64];
+            snprintf(name, sizeof(name), "%s/%s", legacy ? "legacy" : "new", keySetNames[set]);
+            printf("  %-22s %10.2f %10.2f\n", name, result.lowBits, result.tagBits);
+        }
+    }
+
+    printf("\n");
+}
+
+// Throughput
+
+static constexpr s32 inputCount = 4096;
+static constexpr s32 inputMask = inputCount - 1;
+static constexpr u64 byteBufferSize = 1 << 16;
+
+static struct
+{
+    u64 keys64[inputCount];
+    u32 keys32[inputCount];
+    u64 hashes[inputCount];
+    u8 bytes[byteBufferSize + 1024];
+
+    HashTable<s32, s32>* intTable;
+    HashTable<String, s32>* pathTable;
+    String* paths;
+} inputs;
+
+static constexpr s32 tableKeyCount = 1 << 20;
+static constexpr s32 pathCount = 1 << 16;
+
+static void GenerateInputs()
+{
+    Math::RandomState random = Math::SeedRandom(0x68617368);
+
+    for (s32 i = 0; i < inputCount; i++)
+    {
+        inputs.keys64[i] = Math::RandomU64(random);
+        inputs.keys32[i] = (u32) inputs.keys64[i];
+    }
+
+    for (u64 i = 0; i < sizeof(inputs.bytes); i++)
+        inputs.bytes[i] = (u8) Math::RandomU32(random);
+
+    // Counters are the worst case for hashers that only shuffle bits
+    inputs.intTable = new HashTable<s32, s32>();
+    for (s32 i = 0; i < tableKeyCount; i++)
+        inputs.intTable->Place(i, i);
+
+    inputs.pathTable = new HashTable<String, s32>();
+    inputs.paths = new String[pathCount];
+    for (s32 i = 0; i < pathCount; i++)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "assets/textures/tile_%05d.png", i);
+        inputs.paths[i] = String(path);
+        inputs.pathTable->Place(inputs.paths[i], i);
+    }
+}
+
+static void MixScalar(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+        total += Hashing::Mix(inputs.keys64[i & inputMask]);
+
+    sink = sink + total;
+}
+
+static void MixBulk64(s64 count)
+{
+    u64 total = 0;
+    for (s64 done = 0; done < count; done += inputCount)
+    {
+        Hashing::MixMany(inputs.keys64, inputs.hashes, inputCount);
+        total += inputs.hashes[done & inputMask];
+    }
+
+    sink = sink + total;
+}
+
+static void MixBulk32(s64 count)
+{
+    u64 total = 0;
+    for (s64 done = 0; done < count; done += inputCount)
+    {
+        Hashing::MixMany(inputs.keys32, inputs.hashes, inputCount);
+        total += inputs.hashes[done & inputMask];
+    }
+
+    sink = sink + total;
+}
+
+static void LegacyInts(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+        total += LegacyS32((s32) inputs.keys32[i & inputMask]);
+
+    sink = sink + total;
+}
+
+template <u64 size>
+static void HashBytes(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+        total += Hashing::Bytes(inputs.bytes + ((i * 61) & (byteBufferSize - 1)), size);
+
+    sink = sink + total;
+}
+
+template <u64 size>
+static void HashLegacyString(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+        total += LegacyString((const char*) inputs.bytes + ((i * 61) & (byteBufferSize - 1)), size);
+
+    sink = sink + total;
+}
+
+static void FindInts(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+    {
+        auto it = inputs.intTable->Find((s32) (inputs.keys32[i & inputMask] & (2 * tableKeyCount - 1)));
+        total += it ? it.value() : 1;
+    }
+
+    sink = sink + total;
+}
+
+static void FindPaths(s64 count)
+{
+    u64 total = 0;
+    for (s64 i = 0; i < count; i++)
+    {
+        auto it = inputs.pathTable->Find(inputs.paths[inputs.keys32[i & inputMask] & (pathCount - 1)]);
+        total += it ? it.value() : 1;
+    }
+
+    sink = sink + total;
+}
+
+struct Benchmark
+{
+    const char* name;
+    const char* unit;           // What one operation is
+    u64 bytesPerOp;             // 0 if bytes per second doesn't mean anything for it
+    void (*run)(s64 count);
+};
+
+static const Benchmark benchmarks[] = {
+    { "mix/scalar",          "key",    8,    MixScalar },
+    { "mix/bulk_u64",        "key",    8,    MixBulk64 },
+    { "mix/bulk_u32",        "key",    4,    MixBulk32 },
+    { "legacy/s32",          "key",    4,    LegacyInts },
+    { "bytes/4",             "key",    4,    HashBytes<4> },
+    { "bytes/8",             "key",    8,    HashBytes<8> },
+    { "bytes/16",            "key",    16,   HashBytes<16> },
+    { "bytes/32",            "key",    32,   HashBytes<32> },
+    { "bytes/64",            "key",    64,   HashBytes<64> },
+    { "bytes/256",           "key",    256,  HashBytes<256> },
+    { "bytes/1024",          "key",    1024, HashBytes<1024> },
+    { "legacy/string/16",    "key",    16,   HashLegacyString<16> },
+    { "legacy/string/64",    "key",    64,   HashLegacyString<64> },
+    { "table/find_counter",  "lookup", 0,    FindInts },
+    { "table/find_path",     "lookup", 0,    FindPaths },
+};
+
+static f64 TimeRun(const Benchmark& benchmark, s64 count)
+{
+    auto start = std::chrono::steady_clock::now();
+    benchmark.run(count);
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<f64>(end - start).count();
+}
+
+static f64 RunBenchmark(const Benchmark& benchmark, f64 targetSeconds)
+{
+    // Double the count until a run is long enough to scale from, which also warms things up
+    s64 count = 1;
+    f64 seconds = TimeRun(benchmark, count);
+
+    while (seconds < targetSeconds / 10.0 && count < (1ll << 40))
+    {
+        count *= 2;
+        seconds = TimeRun(benchmark, count);
+    }
+
+    s64 scaled = (s64) (count * targetSeconds / ((seconds > 0.0) ? seconds : 1e-9));
+    count = (scaled > count) ? scaled : count;
+
+    seconds = TimeRun(benchmark, count);
+    return seconds * 1e9 / count;
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    const char* filter = nullptr;
+    f64 targetSeconds = 0.5;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else if (strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            filter = argv[++i];
+        else if (strcmp(argv[i], "--time") == 0 && i + 1 < argc)
+            targetSeconds = atof(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Usage: hash_bench [--csv] [--filter <text>] [--time <seconds>]\n");
+            return 1;
+        }
+    }
+
+    if (!csv)
+        PrintQuality();
+
+    GenerateInputs();
+
+    if (csv)
+        printf("name,unit,ns_per_op,ops_per_sec,bytes_per_sec\n");
+    else
+        printf("%.2f s per benchmark\n\n%-22s %14s %18s %12s\n", targetSeconds, "Benchmark", "ns/op", "throughput", "GB/s");
+
+    constexpr s32 benchmarkCount = sizeof(benchmarks) / sizeof(benchmarks[0]);
+
+    for (s32 i = 0; i < benchmarkCount; i++)
+    {
+        const Benchmark& benchmark = benchmarks[i];
+        if (filter && !strstr(benchmark.name, filter))
+            continue;
+
+        f64 nsPerOp = RunBenchmark(benchmark, targetSeconds);
+        f64 perSecond = 1e9 / nsPerOp;
+        f64 bytesPerSecond = perSecond * benchmark.bytesPerOp;
+
+        if (csv)
+        {
+            printf("%s,%s,%.3f,%.1f,%.1f\n", benchmark.name, benchmark.unit, nsPerOp, perSecond, bytesPerSecond);
+        }
+        else
+        {
+            char throughput[32];
+            snprintf(throughput, sizeof(throughput), "%.0f %s/s", perSecond, benchmark.unit);
+
+            if (benchmark.bytesPerOp)
+                printf("%-22s %14.2f %18s %12.2f\n", benchmark.name, nsPerOp, throughput, bytesPerSecond / 1e9);
+            else
+                printf("%-22s %14.2f %18s %12s\n", benchmark.name, nsPerOp, throughput, "-");
+        }
+
+        fflush(stdout);
+    }
+
+    delete[] inputs.paths;
+    delete inputs.pathTable;
+    delete inputs.intTable;
+
+    return 0;
+}
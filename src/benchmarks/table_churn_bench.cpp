@@ -0,0 +1,167 @@
+// Benchmarks hash tables that have keys removed and added all the time,
+// like session tables on a server: HashTable, which leaves tombstones behind
+// and clears them by rehashing, against RobinHoodTable, which never has any.
+//
+// Usage: table_churn_bench [--csv] [--keys N]
+//
+// A table is filled with N keys, then every churn step removes the oldest
+// key and adds a new one, so the size stays at N. After 0, 1, 4, 16 and 64
+// times N steps it reports the average time of a step, the time of the
+// slowest batch of 256 steps (where rehashes show up), and lookups of keys
+// that are there and keys that aren't. N defaults to 2^16 and 2^20, and
+// --keys runs one size instead.
+
+#include "core/types.h"
+#include "containers/hashing.h"
+#include "containers/hashtable.h"
+#include "containers/robinhoodtable.h"
+#include "platform/platform.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static constexpr s32 batchSize = 256;
+static constexpr s32 lookupCount = 1 << 16;
+static constexpr s32 checkpoints[] = { 0, 1, 4, 16, 64 };
+
+// Results get folded in here so the compiler can't drop the work
+static volatile u64 sink;
+
+static inline f64 GetSeconds()
+{
+    return std::chrono::duration<f64>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Session ids: a counter scrambled so consecutive ids look unrelated, like ids from a random source
+static inline u64 MakeKey(u64 counter)
+{
+    return Hashing::Mix(counter ^ 0x5E5510Bull);
+}
+
+struct Checkpoint
+{
+    s32 churned;            // Multiples of the key count
+    f64 churnNs;
+    f64 worstBatchUs;
+    f64 hitNs;
+    f64 missNs;
+    u64 capacity;
+};
+
+template <typename Table>
+static f64 TimeLookups(const Table& table, u64 first, u64 count, bool hits)
+{
+    u64 found = 0;
+    f64 start = GetSeconds();
+
+    for (s32 i = 0; i < lookupCount; i++)
+    {
+        // Misses are ids that were removed long ago or haven't been handed out yet
+        u64 counter = hits ? first + (u64) (i * 2654435761u) % count : first + count + 1000000 + i;
+        found += (bool) table.Find(MakeKey(counter));
+    }
+
+    f64 seconds = GetSeconds() - start;
+    sink = sink + found;
+
+    return seconds * 1e9 / lookupCount;
+}
+
+template <typename Table>
+static void RunChurn(const char* name, u64 keyCount, bool csv)
+{
+    Table* table = new Table();
+
+    for (u64 i = 0; i < keyCount; i++)
+        table->Place(MakeKey(i), i);
+
+    u64 oldest = 0;         // Counter of the oldest key still in the table
+    s32 done = 0;           // Multiples of keyCount churned so far
+
+    for (s32 c = 0; c < (s32) (sizeof(checkpoints) / sizeof(checkpoints[0])); c++)
+    {
+        Checkpoint checkpoint = {};
+        checkpoint.churned = checkpoints[c];
+
+        u64 steps = (u64) (checkpoints[c] - done) * keyCount;
+        f64 start = GetSeconds();
+
+        for (u64 step = 0; step < steps; step += batchSize)
+        {
+            f64 batchStart = GetSeconds();
+
+            u64 batch = (steps - step < batchSize) ? steps - step : batchSize;
+            for (u64 i = 0; i < batch; i++)
+            {
+                table->Remove(MakeKey(oldest));
+                table->Place(MakeKey(oldest + keyCount), oldest + keyCount);
+                oldest++;
+            }
+
+            f64 batchUs = (GetSeconds() - batchStart) * 1e6;
+            checkpoint.worstBatchUs = (batchUs > checkpoint.worstBatchUs) ? batchUs : checkpoint.worstBatchUs;
+        }
+
+        checkpoint.churnNs = steps ? (GetSeconds() - start) * 1e9 / steps : 0.0;
+        done = checkpoints[c];
+
+        checkpoint.hitNs = TimeLookups(*table, oldest, keyCount, true);
+        checkpoint.missNs = TimeLookups(*table, oldest, keyCount, false);
+        checkpoint.capacity = table->capacity();
+
+        if (csv)
+        {
+            printf("%s,%llu,%d,%.2f,%.2f,%.2f,%.2f,%llu\n", name, (unsigned long long) keyCount, checkpoint.churned,
+                   checkpoint.churnNs, checkpoint.worstBatchUs, checkpoint.hitNs, checkpoint.missNs,
+                   (unsigned long long) checkpoint.capacity);
+        }
+        else
+        {
+            printf("%-10s %9llu %7dx %11.1f %13.1f %9.1f %9.1f %10llu\n", name, (unsigned long long) keyCount,
+                   checkpoint.churned, checkpoint.churnNs, checkpoint.worstBatchUs, checkpoint.hitNs, checkpoint.missNs,
+                   (unsigned long long) checkpoint.capacity);
+        }
+
+        fflush(stdout);
+    }
+
+    delete table;
+}
+
+int main(int argc, char** argv)
+{
+    bool csv = false;
+    u64 keyCounts[2] = { 1 << 16, 1 << 20 };
+    s32 sizeCount = 2;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--csv") == 0)
+            csv = true;
+        else if (strcmp(argv[i], "--keys") == 0 && i + 1 < argc)
+        {
+            keyCounts[0] = strtoull(argv[++i], nullptr, 10);
+            sizeCount = 1;
+        }
+        else
+        {
+            fprintf(stderr, "Usage: table_churn_bench [--csv] [--keys N]\n");
+            return 1;
+        }
+    }
+
+    if (csv)
+        printf("table,keys,churned,churn_ns,worst_batch_us,hit_ns,miss_ns,capacity\n");
+    else
+        printf("%-10s %9s %8s %11s %13s %9s %9s %10s\n", "Table", "Keys", "Churned", "Churn ns", "Worst batch us", "Hit ns", "Miss ns", "Capacity");
+
+    for (s32 s = 0; s < sizeCount; s++)
+    {
+        RunChurn<HashTable<u64, u64>>("swiss", keyCounts[s], csv);
+        RunChurn<RobinHoodTable<u64, u64>>("robinhood", keyCounts[s], csv);
+    }
+
+    return 0;
+}
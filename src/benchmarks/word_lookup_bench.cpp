@@ -0,0 +1,105 @@
+// Microbenchmark: guess validation with the word index vs the old linear scan over wordList,
+// and the SIMD equality scan over packedWordList
+
+#include "core/types.h"
+#include "game/wordlist.h"
+#include "game/word_index.h"
+#include "game/packed_word.h"
+#include "game/word_kernels.h"
+#include "game/word_dawg.h"
+
+#include <chrono>
+#include <cstdio>
+
+static bool LinearScanContains(const char* word)
+{
+    bool found = false;
+
+    for (int i = 0; !found && i < wordListSize; i++)
+    {
+        found = true;
+
+        for (int s = 0; s < 5; s++)
+        {
+            if (word[s] != wordList[i][s])
+            {
+                found = false;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+static bool PackedScanContains(const char* word)
+{
+    return WordKernels::FindWord(packedWordList, packedWordListSize, PackWord(word)) >= 0;
+}
+
+static constexpr s32 queryCount = 4096;
+static char queries[queryCount][6];
+
+static void GenerateQueries()
+{
+    // Half valid words spread across the whole list, half near misses that are never valid
+    for (s32 i = 0; i < queryCount; i++)
+    {
+        const char* word = wordList[(i * 7919) % wordListSize];
+        for (int s = 0; s < 5; s++)
+            queries[i][s] = word[s];
+
+        if (i & 1)
+            queries[i][4] = 'Q';
+
+        queries[i][5] = '\0';
+    }
+}
+
+template <typename Func>
+static f64 TimePerQuery(Func contains, s32 rounds, s32& hits)
+{
+    hits = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (s32 r = 0; r < rounds; r++)
+    {
+        for (s32 i = 0; i < queryCount; i++)
+            hits += contains(queries[i]);
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    f64 ns = std::chrono::duration<f64, std::nano>(end - start).count();
+
+    return ns / ((f64) rounds * queryCount);
+}
+
+int main()
+{
+    BuildWordList();
+    GenerateQueries();
+
+    auto buildStart = std::chrono::steady_clock::now();
+    WordIndex::Build();
+    auto buildEnd = std::chrono::steady_clock::now();
+
+    s32 linearHits, packedHits, indexHits;
+    f64 linearNs = TimePerQuery(LinearScanContains, 4, linearHits);
+    f64 packedNs = TimePerQuery(PackedScanContains, 40, packedHits);
+    f64 indexNs  = TimePerQuery(WordIndex::Contains, 1000, indexHits);
+
+    s32 dawgHits;
+    f64 dawgNs   = TimePerQuery(WordDawg::Contains, 1000, dawgHits);
+
+    printf("Index build:  %.1f us\n", std::chrono::duration<f64, std::micro>(buildEnd - buildStart).count());
+    printf("Linear scan:  %10.1f ns/lookup (%d hits)\n", linearNs, linearHits / 4);
+    printf("Packed scan:  %10.1f ns/lookup (%d hits)\n", packedNs, packedHits / 40);
+    printf("Word index:   %10.1f ns/lookup (%d hits)\n", indexNs, indexHits / 1000);
+    printf("Word DAWG:    %10.1f ns/lookup (%d hits)\n", dawgNs, dawgHits / 1000);
+    printf("Speedup:      %10.1fx\n", linearNs / indexNs);
+
+    bool agree = (linearHits / 4 == indexHits / 1000) && (linearHits / 4 == packedHits / 40) &&
+                 (linearHits / 4 == dawgHits / 1000);
+    return agree ? 0 : 1;
+}
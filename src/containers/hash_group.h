@@ -0,0 +1,135 @@
+#pragma once
+
+/*
+
+Hash Group.
+
+Control bytes shared by HashTable and HashSet. Every slot has one byte
+saying whether it's empty, deleted, or full, and for full slots the low
+7 bits of the hash live in it too. Slots are probed 16 at a time: one
+16 byte load brings in a whole group, and one SSE2 compare plus
+movemask gives a bit per slot whose tag matches. Keys are only compared
+for those, which is almost never more than the one being looked for.
+
+Probing goes from group to group, never slot to slot, so a lookup can
+stop as soon as the group it's looking at has an empty slot.
+
+Looking up many keys at once can prefetch each key's first group a few
+keys before probing it, so the cache misses overlap instead of being
+paid one after another (FindMany and ContainsMany).
+
+Hashes are used as they are, so they need good high and low bits (see
+hashing.h).
+
+*/
+
+#include <emmintrin.h>
+
+#include "core/types.h"
+#include "math/bits.h"
+#include "hash.h"
+
+namespace HashGroup
+{
+
+constexpr u64 size = 16;
+
+constexpr u8 EMPTY   = 0x80;
+constexpr u8 DELETED = 0xFE;
+// Full slots are 0x00 - 0x7F, the tag
+
+// The top 7 bits pick the tag, the low bits pick the group
+inline u8 GetTag(Hash hash)
+{
+    return (u8) (hash >> 57);
+}
+
+inline u64 GetStartGroup(Hash hash, u64 groupMask)
+{
+    return hash & groupMask;
+}
+
+// Triangular steps (1, 2, 3, ...) visit every group when the group count is a power of 2
+inline u64 GetNextGroup(u64 group, u64 step, u64 groupMask)
+{
+    return (group + step) & groupMask;
+}
+
+inline bool IsFull(u8 control)
+{
+    return control < 0x80;
+}
+
+struct Group
+{
+    __m128i controls;
+
+    // Groups start on multiples of 16 slots, so the load never splits a cache line
+    explicit Group(const u8* controls)
+    :   controls(_mm_loadu_si128((const __m128i*) controls))
+    {
+    }
+
+    // A bit per slot holding this tag
+    inline u32 Match(u8 tag) const
+    {
+        return (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8((char) tag)));
+    }
+
+    inline u32 MatchEmpty() const
+    {
+        return Match(EMPTY);
+    }
+
+    // Both have the top bit set, full slots don't
+    inline u32 MatchFree() const
+    {
+        return (u32) _mm_movemask_epi8(controls);
+    }
+
+    inline u32 MatchFull() const
+    {
+        return ~MatchFree() & 0xFFFF;
+    }
+};
+
+// Starts bringing the cache line in without waiting for it
+inline void Prefetch(const void* address)
+{
+    _mm_prefetch((const char*) address, _MM_HINT_T0);
+}
+
+// Rounds up to a power of 2, and at least a whole group
+inline u64 GetCapacity(u64 requested)
+{
+    u64 capacity = size;
+    while (capacity < requested)
+        capacity *= 2;
+
+    return capacity;
+}
+
+// Elements a table can hold before it has to grow, 7/8 of the slots
+inline u64 GetMaxLoad(u64 capacity)
+{
+    return capacity - capacity / 8;
+}
+
+// Slot index of the next full slot at or after index, capacity if there's none
+inline u64 FindFull(const u8* controls, u64 index, u64 capacity)
+{
+    while (index < capacity)
+    {
+        u64 groupStart = index & ~(size - 1);
+        u32 full = Group(controls + groupStart).MatchFull() >> (index - groupStart);
+
+        if (full)
+            return index + CountTrailingZeros(full);
+
+        index = groupStart + size;
+    }
+
+    return capacity;
+}
+
+} // namespace HashGroup
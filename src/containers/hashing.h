@@ -0,0 +1,268 @@
+#pragma once
+
+/*
+
+Hashing.
+
+Hash functions behind the Hasher specializations in hash.h, usable on
+their own too.
+
+    - Bytes is a 64 bit hash for strings and other byte ranges, after
+      wyhash: 16 bytes at a time folded in with 64 x 64 -> 128 bit
+      multiplies. Keys up to 16 bytes take a couple of loads and two
+      multiplies. It never reads outside [data, data + size).
+    - Mix scrambles an integer with SplitMix64's finalizer. It's a
+      bijection, so different keys never collide, and every input bit
+      flips every output bit about half the time.
+    - MixMany is Mix over an array, 2 keys at a time with SSE2 or 4 with
+      AVX2. Results match Mix exactly, so hashes from either can go into
+      the same table.
+
+Tables pick groups with the low bits and tags with the high bits of the
+hash, so every bit has to be good, which these are.
+
+*/
+
+#include <cstring>
+
+#include "core/types.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Hashing
+{
+
+constexpr u64 secret[4] = {
+    0x2D358DCCAA6C78A5ull,
+    0x8BB84B93962EACC9ull,
+    0x4B33A62ED433D4A3ull,
+    0x4D5A2DA51DE1AA47ull
+};
+
+constexpr u64 mixMultiplier0 = 0xBF58476D1CE4E5B9ull;
+constexpr u64 mixMultiplier1 = 0x94D049BB133111EBull;
+
+// Full 128 bit product of a and b, low half in a, high half in b
+inline void Multiply128(u64& a, u64& b)
+{
+#ifdef _MSC_VER
+    u64 high;
+    a = _umul128(a, b, &high);
+    b = high;
+#else
+    __uint128_t product = (__uint128_t) a * b;
+    a = (u64) product;
+    b = (u64) (product >> 64);
+#endif
+}
+
+// Both halves of the product folded together
+inline u64 MultiplyFold(u64 a, u64 b)
+{
+    Multiply128(a, b);
+    return a ^ b;
+}
+
+inline u64 Read64(const u8* ptr)
+{
+    u64 value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline u64 Read32(const u8* ptr)
+{
+    u32 value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+// 1 to 3 bytes, the first, middle and last cover all of them
+inline u64 ReadSmall(const u8* ptr, u64 size)
+{
+    return ((u64) ptr[0] << 16) | ((u64) ptr[size >> 1] << 8) | ptr[size - 1];
+}
+
+inline u64 Bytes(const void* data, u64 size, u64 seed = 0)
+{
+    const u8* ptr = (const u8*) data;
+    seed ^= MultiplyFold(seed ^ secret[0], secret[1]);
+
+    u64 a, b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // Two overlapping reads from each end cover 4 to 16 bytes
+            u64 offset = (size >> 3) << 2;
+            a = (Read32(ptr) << 32) | Read32(ptr + offset);
+            b = (Read32(ptr + size - 4) << 32) | Read32(ptr + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            a = ReadSmall(ptr, size);
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        u64 remaining = size;
+
+        // Three independent lanes so the multiplies overlap
+        if (remaining > 48)
+        {
+            u64 seed1 = seed;
+            u64 seed2 = seed;
+
+            do
+            {
+                seed  = MultiplyFold(Read64(ptr)      ^ secret[1], Read64(ptr + 8)  ^ seed);
+                seed1 = MultiplyFold(Read64(ptr + 16) ^ secret[2], Read64(ptr + 24) ^ seed1);
+                seed2 = MultiplyFold(Read64(ptr + 32) ^ secret[3], Read64(ptr + 40) ^ seed2);
+
+                ptr += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16)
+        {
+            seed = MultiplyFold(Read64(ptr) ^ secret[1], Read64(ptr + 8) ^ seed);
+
+            ptr += 16;
+            remaining -= 16;
+        }
+
+        // The last 16 bytes, overlapping what's already been read if it has to
+        a = Read64(ptr + remaining - 16);
+        b = Read64(ptr + remaining - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    Multiply128(a, b);
+
+    return MultiplyFold(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+inline u64 Mix(u64 key)
+{
+    key = (key ^ (key >> 30)) * mixMultiplier0;
+    key = (key ^ (key >> 27)) * mixMultiplier1;
+    return key ^ (key >> 31);
+}
+
+// SIMD Mix
+
+// Neither instruction set has a 64 bit multiply, so it's put together
+// from 32 x 32 -> 64 bit ones:
+//     low 64 bits of a * b = aLow * bLow + ((aHigh * bLow + aLow * bHigh) << 32)
+
+#ifdef __AVX2__
+
+constexpr u64 mixLanes = 4;
+
+inline __m256i MultiplyLanes(__m256i a, u64 b)
+{
+    __m256i bLow  = _mm256_set1_epi64x((s64) (b & 0xFFFFFFFF));
+    __m256i bHigh = _mm256_set1_epi64x((s64) (b >> 32));
+
+    __m256i low   = _mm256_mul_epu32(a, bLow);
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), bLow), _mm256_mul_epu32(a, bHigh));
+
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+inline __m256i MixLanes(__m256i key)
+{
+    key = MultiplyLanes(_mm256_xor_si256(key, _mm256_srli_epi64(key, 30)), mixMultiplier0);
+    key = MultiplyLanes(_mm256_xor_si256(key, _mm256_srli_epi64(key, 27)), mixMultiplier1);
+    return _mm256_xor_si256(key, _mm256_srli_epi64(key, 31));
+}
+
+#else
+
+constexpr u64 mixLanes = 2;
+
+inline __m128i MultiplyLanes(__m128i a, u64 b)
+{
+    __m128i bLow  = _mm_set1_epi64x((s64) (b & 0xFFFFFFFF));
+    __m128i bHigh = _mm_set1_epi64x((s64) (b >> 32));
+
+    __m128i low   = _mm_mul_epu32(a, bLow);
+    __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), bLow), _mm_mul_epu32(a, bHigh));
+
+    return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+}
+
+inline __m128i MixLanes(__m128i key)
+{
+    key = MultiplyLanes(_mm_xor_si128(key, _mm_srli_epi64(key, 30)), mixMultiplier0);
+    key = MultiplyLanes(_mm_xor_si128(key, _mm_srli_epi64(key, 27)), mixMultiplier1);
+    return _mm_xor_si128(key, _mm_srli_epi64(key, 31));
+}
+
+#endif
+
+// hashes[i] = Mix(keys[i])
+inline void MixMany(const u64* keys, u64* hashes, u64 count)
+{
+    u64 i = 0;
+
+#ifdef __AVX2__
+    for (; i + mixLanes <= count; i += mixLanes)
+    {
+        __m256i key = _mm256_loadu_si256((const __m256i*) (keys + i));
+        _mm256_storeu_si256((__m256i*) (hashes + i), MixLanes(key));
+    }
+#else
+    for (; i + mixLanes <= count; i += mixLanes)
+    {
+        __m128i key = _mm_loadu_si128((const __m128i*) (keys + i));
+        _mm_storeu_si128((__m128i*) (hashes + i), MixLanes(key));
+    }
+#endif
+
+    for (; i < count; i++)
+        hashes[i] = Mix(keys[i]);
+}
+
+// hashes[i] = Mix(keys[i]), with the keys zero extended like Hasher<u32> does
+inline void MixMany(const u32* keys, u64* hashes, u64 count)
+{
+    u64 i = 0;
+
+#ifdef __AVX2__
+    for (; i + mixLanes <= count; i += mixLanes)
+    {
+        __m256i key = _mm256_cvtepu32_epi64(_mm_loadu_si128((const __m128i*) (keys + i)));
+        _mm256_storeu_si256((__m256i*) (hashes + i), MixLanes(key));
+    }
+#else
+    for (; i + mixLanes <= count; i += mixLanes)
+    {
+        __m128i key = _mm_unpacklo_epi32(_mm_loadl_epi64((const __m128i*) (keys + i)), _mm_setzero_si128());
+        _mm_storeu_si128((__m128i*) (hashes + i), MixLanes(key));
+    }
+#endif
+
+    for (; i < count; i++)
+        hashes[i] = Mix(keys[i]);
+}
+
+} // namespace Hashing
@@ -1,34 +1,31 @@
 #pragma once
 
+#include <new>
+#include <utility>
 #include "hash.h"
+#include "hash_group.h"
 #include "core/logging.h"
 #include "core/types.h"
 #include "platform/platform.h"
 
+// Open addressing with a control byte per slot, probed a group of 16 at a time (see hash_group.h)
 template <typename T, typename Hasher = Hasher<T>>
 class HashSet
 {
 private:
     static constexpr u64 START_CAP = 16;
-    static constexpr f32 GROWTH_RATE = 2.0f;
-    static constexpr f32 MAX_LOAD_FACTOR = 0.8f;
-
-    enum struct State : u8
-    {
-        EMPTY,
-        TOMBSTONE,
-        FILLED
-    };
+    static constexpr u64 GROWTH_RATE = 2;
+    static constexpr u64 PREFETCH_DISTANCE = 16;  // How many elements ahead ContainsMany prefetches, a power of 2
 
     struct SetData
     {
-        State* states { nullptr };
-        Hash* hashes  { nullptr };
+        u8* controls  { nullptr };
+        Hash* hashes  { nullptr };      // Only read when rehashing, so elements never have to be hashed twice
         T* elements   { nullptr };
 
         inline SetData& operator=(const SetData& other)
         {
-            states = other.states;
+            controls = other.controls;
             hashes = other.hashes;
             elements = other.elements;
 
@@ -63,13 +60,13 @@ public:
 
         inline T& operator*()
         {
-            AssertWithMessage(_index <= _set->_last, "Trying to dereference a non existant value!");
+            AssertWithMessage(_index < _set->_capacity, "Trying to dereference a non existant value!");
             return _set->_set.elements[_index];
         }
 
         inline const T& operator*() const
         {
-            AssertWithMessage(_index <= _set->_last, "Trying to dereference a non existant value!");
+            AssertWithMessage(_index < _set->_capacity, "Trying to dereference a non existant value!");
             return _set->_set.elements[_index];
         }
 
@@ -104,16 +101,13 @@ public:
         }
 
     private:
+        // Skips whole groups of free slots at once
         inline void advance()
         {
-            if (_index > _set->_last)
+            if (_index >= _set->_capacity)
                 return;
-            
-            _index++;
 
-            while (_set->_set.states[_index] != State::FILLED &&
-                   _index <= _set->_last)
-                _index++;
+            _index = HashGroup::FindFull(_set->_set.controls, _index + 1, _set->_capacity);
         }
 
     private:
@@ -121,242 +115,144 @@ public:
         u64 _index;
     };
 
-    inline const iterator begin() const { return iterator(this, _first); }
-    inline       iterator begin()       { return iterator(this, _first); }
+    inline const iterator begin() const { return iterator(this, HashGroup::FindFull(_set.controls, 0, _capacity)); }
+    inline       iterator begin()       { return iterator(this, HashGroup::FindFull(_set.controls, 0, _capacity)); }
 
-    inline const iterator end() const { return iterator(this, _last + 1); }
-    inline       iterator end()       { return iterator(this, _last + 1); }
+    inline const iterator end() const { return iterator(this, _capacity); }
+    inline       iterator end()       { return iterator(this, _capacity); }
 
 public:
     // Getters
     inline u64 size()     const { return _size; }
     inline u64 capacity() const { return _capacity; }
 
+    // Capacity is rounded up to a power of 2 with room for every element
     inline void Rehash(u64 capacity)
     {
+        capacity = HashGroup::GetCapacity(capacity);
+        while (HashGroup::GetMaxLoad(capacity) <= _size)
+            capacity *= 2;
+
         SetData newSet;
         Allocate(newSet, capacity);
 
-        u64 newFirst = capacity;
-        u64 newLast = 0;
-
-        for (u64 i = _first; i <= _last; i++)
+        for (u64 i = 0; i < _capacity; i++)
         {
-            if (_set.states[i] != State::FILLED)
+            if (!HashGroup::IsFull(_set.controls[i]))
                 continue;
-            
-            const Hash& hash = _set.hashes[i];
-            u64 startIndex = hash % capacity;
 
-            for (u64 j = startIndex + 1; j != startIndex; j = (j + 1) % capacity)
-            {
-                if (newSet.states[j] == State::EMPTY)
-                {
-                    newSet.states[j] = State::FILLED;
-                    newSet.hashes[j] = hash;
-                    newSet.elements[j] = std::move(_set.elements[i]);
+            Hash hash = _set.hashes[i];
+            u64 j = FindFree(newSet, capacity, hash);
 
-                    newFirst = std::min(newFirst, j);
-                    newLast = std::max(newLast, j);
+            newSet.controls[j] = HashGroup::GetTag(hash);
+            newSet.hashes[j] = hash;
+            new (newSet.elements + j) T(std::move(_set.elements[i]));
 
-                    break;
-                }
-            }
+            _set.elements[i].~T();
         }
 
-        _capacity = capacity;
-
-        _first = newFirst;
-        _last = newLast;
-
         Deallocate(_set);
         _set = newSet;
+
+        _capacity = capacity;
+        _growthLeft = HashGroup::GetMaxLoad(capacity) - _size;
     }
 
     inline iterator Find(const T& elem) const
     {
-        u64 hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
+        return iterator(this, FindIndex(elem, hasher(elem)));
+    }
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
-        {
-            const State& currentElementState = _set.states[i];
-            if (currentElementState == State::EMPTY)
-                return end();
+    // Looks up count elements at once, contains[i] says whether elems[i] is in the set.
+    // Returns how many were found. Costs about the same as calling Find for each
+    // element while the set fits in cache, and gets faster once it doesn't.
+    inline u64 ContainsMany(const T* elems, u64 count, bool* contains) const
+    {
+        u64 found = 0;
 
-            if (currentElementState == State::TOMBSTONE)
-                continue;
-            
-            if (_set.hashes[i] == hash &&
-                _set.elements[i] == elem)
-                return iterator(this, i);
-        }
+        FindEach(elems, count, [&](u64 i, u64 index) {
+            contains[i] = index < _capacity;
+            found += contains[i];
+        });
 
-        // Shouldn't reach this point
-        return end();
+        return found;
     }
-    
+
     inline T& Place(const T& elem)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
         Hash hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
+        u64 i = FindIndex(elem, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            State& currentElementState = _set.states[i];
-            if (currentElementState != State::FILLED)
-            {
-                currentElementState = State::FILLED;
-                _set.hashes[i] = hash;
-                _set.elements[i] = elem;
-
-                _first = std::min(_first, i);
-                _last = std::max(_last, i);
-
-                _size++;
-                return _set.elements[i];
-            }
-
-            if (_set.hashes[i]   == hash &&
-                _set.elements[i] == elem)
-                return _set.elements[i];
+            i = Claim(hash);
+            new (_set.elements + i) T(elem);
         }
 
-        // Shouldn't reach this point
-        return _set.elements[_capacity];
+        return _set.elements[i];
     }
 
     inline T& Place(T&& elem)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
         Hash hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
+        u64 i = FindIndex(elem, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            State& currentElementState = _set.states[i];
-            if (currentElementState != State::FILLED)
-            {
-                currentElementState = State::FILLED;
-                _set.hashes[i] = hash;
-                _set.elements[i] = std::move(elem);
-
-                _first = std::min(_first, i);
-                _last = std::max(_last, i);
-
-                _size++;
-                return _set.elements[i];
-            }
-
-            if (_set.hashes[i]   == hash &&
-                _set.elements[i] == elem)
-                return _set.elements[i];
+            i = Claim(hash);
+            new (_set.elements + i) T(std::move(elem));
         }
 
-        // Shouldn't reach this point
-        return _set.elements[_capacity];
+        return _set.elements[i];
     }
 
     template <typename... Args>
     inline T& Emplace(Args&&... args)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
         T elem(std::forward<Args>(args)...);
-
-        Hash hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
-
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
-        {
-            State& currentElementState = _set.states[i];
-            if (currentElementState != State::FILLED)
-            {
-                currentElementState = State::FILLED;
-                _set.hashes[i] = hash;
-                _set.elements[i] = std::move(elem);
-
-                _first = std::min(_first, i);
-                _last = std::max(_last, i);
-
-                _size++;
-                return _set.elements[i];
-            }
-
-            if (_set.hashes[i]   == hash &&
-                _set.elements[i] == elem)
-                return _set.elements[i];
-        }
-
-        // Shouldn't reach this point
-        return _set.elements[_capacity];
+        return Place(std::move(elem));
     }
 
     inline void Remove(const T& elem)
     {
-        iterator it = Find(elem);
+        u64 index = FindIndex(elem, hasher(elem));
 
-        if (it == end())
+        if (index == _capacity)
         {
             Warn("Trying to remove non-existant element in set.");
             return;
         }
 
-        u64 index = it.index();
-
-        _set.states[index] = State::TOMBSTONE;
         _set.elements[index].~T();
         _size--;
 
-        // Update First and Last
-        if (_size == 0)
-        {
-            _first = _capacity;
-            _last = 0;
-        }
-        else if (index == _first)
+        // Same as HashTable::Remove, slots only go back to empty if no probe could have gone past them
+        u64 groupStart = index & ~(HashGroup::size - 1);
+        if (HashGroup::Group(_set.controls + groupStart).MatchEmpty())
         {
-            for (u64 i = _first + 1; i <= _last; i++)
-            {
-                if (_set.states[i] == State::FILLED)
-                {
-                    _first = i;
-                    break;
-                }
-            }
-        }
-        else if (index == _last)
-        {
-            for (u64 i = _last - 1; i >= _first; i--)
-            {
-                if (_set.states[i] == State::FILLED)
-                {
-                    _last = i;
-                    break;
-                }
-            }
+            _set.controls[index] = HashGroup::EMPTY;
+            _growthLeft++;
         }
+        else
+            _set.controls[index] = HashGroup::DELETED;
     }
 
     // Constructors and Destructors
     HashSet(u64 capacity = START_CAP)
-    :   _size(0), _capacity(capacity)
-    ,   _first(capacity), _last(0)
     {
+        capacity = HashGroup::GetCapacity(capacity);
         Allocate(_set, capacity);
+
+        _capacity = capacity;
+        _size = 0;
+        _growthLeft = HashGroup::GetMaxLoad(capacity);
     }
 
     ~HashSet()
     {
-        for (u64 i = _first; i < _last; i++)
+        for (u64 i = 0; i < _capacity; i++)
         {
-            if (_set.states[i] == State::FILLED)
+            if (HashGroup::IsFull(_set.controls[i]))
                 _set.elements[i].~T();
         }
 
@@ -364,30 +260,131 @@ public:
     }
 
 private:
-    inline float GetLoadFactor() const
+    // Index of the element, or _capacity if it's not in the set
+    inline u64 FindIndex(const T& elem, Hash hash) const
     {
-        return (float) _size / (float) _capacity;
+        u64 groupCount = _capacity / HashGroup::size;
+        u64 groupMask = groupCount - 1;
+        u8 tag = HashGroup::GetTag(hash);
+
+        u64 group = HashGroup::GetStartGroup(hash, groupMask);
+        for (u64 step = 1; step <= groupCount; step++)
+        {
+            u64 groupStart = group * HashGroup::size;
+            HashGroup::Group controls(_set.controls + groupStart);
+
+            for (u32 match = controls.Match(tag); match; match &= match - 1)
+            {
+                u64 i = groupStart + CountTrailingZeros(match);
+                if (_set.elements[i] == elem)
+                    return i;
+            }
+
+            if (controls.MatchEmpty())
+                break;
+
+            group = HashGroup::GetNextGroup(group, step, groupMask);
+        }
+
+        return _capacity;
     }
 
+    // Calls resolve(i, FindIndex(elems[i])) for every element in order. Each element is
+    // hashed and its first group prefetched PREFETCH_DISTANCE elements before it's probed,
+    // so probing one overlaps with the cache misses of the ones after it.
+    template <typename Resolve>
+    inline void FindEach(const T* elems, u64 count, Resolve resolve) const
+    {
+        Hash hashes[PREFETCH_DISTANCE];
+        u64 groupMask = _capacity / HashGroup::size - 1;
+
+        auto prefetch = [&](u64 i) {
+            Hash hash = hasher(elems[i]);
+            hashes[i % PREFETCH_DISTANCE] = hash;
+
+            u64 groupStart = HashGroup::GetStartGroup(hash, groupMask) * HashGroup::size;
+            HashGroup::Prefetch(_set.controls + groupStart);
+            HashGroup::Prefetch(_set.elements + groupStart);
+        };
+
+        u64 ahead = (count < PREFETCH_DISTANCE) ? count : PREFETCH_DISTANCE;
+        for (u64 i = 0; i < ahead; i++)
+            prefetch(i);
+
+        for (u64 i = 0; i < count; i++)
+        {
+            Hash hash = hashes[i % PREFETCH_DISTANCE];
+
+            if (i + PREFETCH_DISTANCE < count)
+                prefetch(i + PREFETCH_DISTANCE);
+
+            resolve(i, FindIndex(elems[i], hash));
+        }
+    }
+
+    // First empty or deleted slot along the element's probe sequence
+    static inline u64 FindFree(const SetData& set, u64 capacity, Hash hash)
+    {
+        u64 groupMask = capacity / HashGroup::size - 1;
+        u64 group = HashGroup::GetStartGroup(hash, groupMask);
+
+        for (u64 step = 1; ; step++)
+        {
+            u64 groupStart = group * HashGroup::size;
+            u32 free = HashGroup::Group(set.controls + groupStart).MatchFree();
+
+            if (free)
+                return groupStart + CountTrailingZeros(free);
+
+            group = HashGroup::GetNextGroup(group, step, groupMask);
+        }
+    }
+
+    // Takes a slot for an element that isn't in the set yet, the caller constructs it
+    inline u64 Claim(Hash hash)
+    {
+        if (_growthLeft == 0)
+        {
+            // Mostly tombstones (lots of removes) get cleaned up in place instead of growing
+            if (_size < HashGroup::GetMaxLoad(_capacity) / 2)
+                Rehash(_capacity);
+            else
+                Rehash(_capacity * GROWTH_RATE);
+        }
+
+        u64 i = FindFree(_set, _capacity, hash);
+
+        // Reusing a tombstone doesn't make probes any longer
+        if (_set.controls[i] == HashGroup::EMPTY)
+            _growthLeft--;
+
+        _set.controls[i] = HashGroup::GetTag(hash);
+        _set.hashes[i] = hash;
+        _size++;
+
+        return i;
+    }
+
+    // Capacity is a multiple of 16, so everything after the controls stays 16 byte aligned
     static inline void Allocate(SetData& set, u64 elements)
     {
-        State* ptr = (State*) PlatformAllocate(elements * (sizeof(T) + sizeof(Hash) + sizeof(State)));
+        u8* ptr = (u8*) PlatformAllocate(elements * (sizeof(u8) + sizeof(Hash) + sizeof(T)));
         AssertWithMessage(ptr, "Couldn't allocate set.");
 
-        set.states = ptr;
-        set.hashes = (Hash*)(set.states + elements);
+        set.controls = ptr;
+        set.hashes = (Hash*)(set.controls + elements);
         set.elements = (T*)(set.hashes + elements);
 
-        PlatformSetMemory(set.states, (int) State::EMPTY, elements * sizeof(State));
+        PlatformSetMemory(set.controls, HashGroup::EMPTY, elements * sizeof(u8));
     }
 
     static inline void Deallocate(SetData& set)
     {
-        if (set.states)
+        if (set.controls)
         {
-            PlatformFree(set.states);
+            PlatformFree(set.controls);
 
-            set.states = nullptr;
+            set.controls = nullptr;
             set.hashes = nullptr;
             set.elements = nullptr;
         }
@@ -395,28 +392,8 @@ private:
 
 private:
     SetData _set;
-    u64 _first, _last;
     u64 _size, _capacity;
+    u64 _growthLeft;        // Empty slots that can still be filled before the set has to grow
 
     Hasher hasher;
 };
-
-/*
-
-Optimization Strategy for later.
-
-Vectorization strategy:
-Buckets are of size 16 bytes.
-
-Steps for Find:
-- Find starting bucket and start loop
-- Index mask = (-1 << index)    -> i mask   only for first bucket
-- Check for EMPTY in bucket     -> e mask   1 batch SSE
-- Check for FILLED in bucket    -> f mask   1 batch SSE
-- Check hashes in bucket        -> h mask   2 batches AVX
-- res = i & (((e & (-e)) << 1) - 1) & f & h;
-- Go through all set bits in res to find answer
-- If found, return element
-- Else if e != 0, end loop (NOT FOUND)
-
-*/
\ No newline at end of file
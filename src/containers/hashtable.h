@@ -2,37 +2,35 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <new>
+#include <utility>
 #include "hash.h"
+#include "hash_group.h"
 #include "core/logging.h"
+#include "platform/platform.h"
 
+// Open addressing with a control byte per slot, probed a group of 16 at a time (see hash_group.h)
 template <typename Key, typename Value, typename Hasher = Hasher<Key>>
 class HashTable
 {
 private:
     static constexpr u64 START_CAP = 16;
-    static constexpr f32 GROWTH_RATE = 2.0f;
-    static constexpr f32 MAX_LOAD_FACTOR = 0.8f;
-
-    enum struct State : u8
-    {
-        EMPTY,
-        TOMBSTONE,
-        FILLED
-    };
+    static constexpr u64 GROWTH_RATE = 2;
+    static constexpr u64 PREFETCH_DISTANCE = 16;  // How many keys ahead FindMany prefetches, a power of 2
 
     struct TableData
     {
-        State* states { nullptr };
-        Hash*  hashes { nullptr };
-        Key*   keys   { nullptr };
-        Value* values { nullptr };
+        u8*    controls { nullptr };
+        Hash*  hashes   { nullptr };     // Only read when rehashing, so keys never have to be hashed twice
+        Key*   keys     { nullptr };
+        Value* values   { nullptr };
 
         inline TableData& operator=(const TableData& other)
         {
-            states = other.states;
-            hashes = other.hashes;
-            keys   = other.keys;
-            values = other.values;
+            controls = other.controls;
+            hashes   = other.hashes;
+            keys     = other.keys;
+            values   = other.values;
 
             return *this;
         }
@@ -77,13 +75,13 @@ public:
 
         inline KeyValuePair operator*()
         {
-            AssertWithMessage(_index <= _table->_last, "Trying to dereference a non existant value!");
+            AssertWithMessage(_index < _table->_capacity, "Trying to dereference a non existant value!");
             return KeyValuePair(_table->_table.keys[_index], _table->_table.values[_index]);
         }
 
         inline const KeyValuePair operator*() const
         {
-            AssertWithMessage(_index <= _table->_last, "Trying to dereference a non existant value!");
+            AssertWithMessage(_index < _table->_capacity, "Trying to dereference a non existant value!");
             return KeyValuePair(_table->_table.keys[_index], _table->_table.values[_index]);
         }
 
@@ -104,7 +102,7 @@ public:
         {
             return *this != _table->end();
         }
-        
+
         // Getters
         inline u64 index() const
         {
@@ -133,15 +131,13 @@ public:
         }
 
     private:
+        // Skips whole groups of free slots at once
         inline void advance()
         {
-            if (_index > _table->_last)
+            if (_index >= _table->_capacity)
                 return;
-            
-            _index++;
-            while (_table->_table.states[_index] != State::FILLED &&
-                   _index <= _table->_last)
-                _index++;
+
+            _index = HashGroup::FindFull(_table->_table.controls, _index + 1, _table->_capacity);
         }
 
     private:
@@ -149,11 +145,11 @@ public:
         u64 _index;
     };
 
-    inline const iterator begin() const { return iterator(this, _first); }
-    inline       iterator begin()       { return iterator(this, _first); }
+    inline const iterator begin() const { return iterator(this, HashGroup::FindFull(_table.controls, 0, _capacity)); }
+    inline       iterator begin()       { return iterator(this, HashGroup::FindFull(_table.controls, 0, _capacity)); }
 
-    inline const iterator end() const { return iterator(this, _last + 1); }
-    inline       iterator end()       { return iterator(this, _last + 1); }
+    inline const iterator end() const { return iterator(this, _capacity); }
+    inline       iterator end()       { return iterator(this, _capacity); }
 
 public:
     // Getters
@@ -165,311 +161,205 @@ public:
     {
         return Find(key).value();
     }
-    
+
     inline Value& operator[](const Key& key)
     {
         return At(key).value();
     }
 
     // Explicit Functions
+
+    // For tables in memory that was never constructed (like in a union)
     inline void ManualInit(u64 capacity = START_CAP)
     {
+        capacity = HashGroup::GetCapacity(capacity);
         Allocate(_table, capacity);
-        
+
         _capacity = capacity;
         _size = 0;
-
-        _first = capacity;
-        _last = 0;
+        _growthLeft = HashGroup::GetMaxLoad(capacity);
     }
 
+    // Capacity is rounded up to a power of 2 with room for every element
     inline void Rehash(u64 capacity)
     {
+        capacity = HashGroup::GetCapacity(capacity);
+        while (HashGroup::GetMaxLoad(capacity) <= _size)
+            capacity *= 2;
+
         TableData newTable;
         Allocate(newTable, capacity);
 
-        u64 newFirst = capacity;
-        u64 newLast = 0;
-
-        for (u64 i = _first; i <= _last; i++)
+        for (u64 i = 0; i < _capacity; i++)
         {
-            if (_table.states[i] != State::FILLED)
+            if (!HashGroup::IsFull(_table.controls[i]))
                 continue;
-            
-            const Hash& hash = _table.hashes[i];
-            u64 startIndex = hash % capacity;
 
-            for (u64 j = startIndex + 1; j != startIndex; j = (j + 1) % capacity)
-            {
-                if (newTable.states[j] == State::EMPTY)
-                {
-                    newTable.states[j] = State::FILLED;
-                    newTable.hashes[j] = hash;
-                    newTable.keys[j] = std::move(_table.keys[i]);
-                    newTable.values[j] = std::move(_table.values[i]);
-
-                    newFirst = std::min(newFirst, j);
-                    newLast = std::max(newLast, j);
-
-                    break;
-                }
-            }
-        }
+            Hash hash = _table.hashes[i];
+            u64 j = FindFree(newTable, capacity, hash);
 
-        _capacity = capacity;
+            newTable.controls[j] = HashGroup::GetTag(hash);
+            newTable.hashes[j] = hash;
+            new (newTable.keys + j) Key(std::move(_table.keys[i]));
+            new (newTable.values + j) Value(std::move(_table.values[i]));
 
-        _first = newFirst;
-        _last = newLast;
+            _table.keys[i].~Key();
+            _table.values[i].~Value();
+        }
 
         Deallocate(_table);
         _table = newTable;
+
+        _capacity = capacity;
+        _growthLeft = HashGroup::GetMaxLoad(capacity) - _size;
     }
 
     // Tries to find the element
     // If not found, returns end()
     inline iterator Find(const Key& key) const
     {
-        u64 hash = hasher(key);
-        u64 startIndex = hash % _capacity;
+        return iterator(this, FindIndex(key, hasher(key)));
+    }
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
-        {
-            const State& currentPairState = _table.states[i];
+    // Looks up count keys at once. values[i] points to the value of keys[i],
+    // or is null if it's not in the table. Returns how many were found.
+    // Costs about the same as calling Find for each key and keeping the result
+    // while the table fits in cache, and gets faster once it doesn't. A Find
+    // loop that uses each value straight away still wins on small tables.
+    inline u64 FindMany(const Key* keys, u64 count, Value** values) const
+    {
+        u64 found = 0;
 
-            if (currentPairState == State::EMPTY)
-                return end();
-            
-            if (currentPairState == State::TOMBSTONE)
-                continue;
-            
-            if (_table.hashes[i] == hash &&
-                _table.keys[i] == key)
-                return iterator(this, i);
-        }
+        // No branch on whether each key was found, with a mix of hits and misses it'd be
+        // mispredicted half the time. Prefetching one past the end for a miss is harmless.
+        FindEach(keys, count, [&](u64 i, u64 index) {
+            Value* value = _table.values + index;
+            HashGroup::Prefetch(value);     // The caller's going to read it next
 
-        // Shouldn't reach this point
-        return end();
+            bool hit = index < _capacity;
+            values[i] = hit ? value : nullptr;
+            found += hit;
+        });
+
+        return found;
+    }
+
+    // Same as FindMany, but only says whether each key is there
+    inline u64 ContainsMany(const Key* keys, u64 count, bool* contains) const
+    {
+        u64 found = 0;
+
+        FindEach(keys, count, [&](u64 i, u64 index) {
+            contains[i] = index < _capacity;
+            found += contains[i];
+        });
+
+        return found;
     }
 
     // Tries to find the element
     // If not found, places an empty element and returns that
     inline iterator At(const Key& key)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
-        u64 hash = hasher(key);
-        u64 startIndex = hash % _capacity;
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            const State& currentPairState = _table.states[i];
-
-            if (currentPairState != State::FILLED)
-            {
-                CopyKey(i, key);
-
-                _table.states[i] = State::FILLED;
-                _table.hashes[i] = hash;
-                _table.values[i] = Value();     // Represents empty value
-
-                _first = std::min(_first, i);
-                _last  = std::max(_last, i);
-
-                _size++;
-
-                return iterator(this, i);
-            }
-            
-            if (_table.hashes[i] == hash &&
-                _table.keys[i] == key)
-                return iterator(this, i);
+            i = Claim(key, hash);
+            new (_table.values + i) Value();     // Represents empty value
         }
 
-        // Shouldn't reach this point
-        return end();
+        return iterator(this, i);
     }
 
     inline Value& Place(const Key& key, const Value& value)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
         Hash hash = hasher(key);
-        u64 startIndex = hash % _capacity;
+        u64 i = FindIndex(key, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            State& currentPairState = _table.states[i];
-            if (currentPairState !=  State::FILLED)
-            {
-                CopyKey(i, key);
-
-                currentPairState = State::FILLED;
-                _table.hashes[i] = hash;
-                _table.values[i] = value;
-
-                _first = std::min(_first, i);
-                _last  = std::max(_last, i);
-
-                _size++;
-                return _table.values[i];
-            }
-
-            if (_table.hashes[i] == hash &&
-                _table.key[i] == key)
-            {
-                if (_table.values[i] != value)
-                    _table.values[i] = value;
-                
-                return _table.values[i];
-            }
+            i = Claim(key, hash);
+            new (_table.values + i) Value(value);
         }
+        else if (_table.values[i] != value)
+            _table.values[i] = value;
 
-        // Shouldn't reach this point
-        return _table.values[_capacity];
+        return _table.values[i];
     }
 
     inline Value& Place(const Key& key, Value&& value)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
-        Hash hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            State& currentPairState = _table.states[i];
-            if (currentPairState != State::FILLED)
-            {
-                CopyKey(i, key);
-
-                currentPairState = State::FILLED;
-                _table.hashes[i] = hash;
-                _table.values[i] = std::move(value);
-
-                _first = std::min(_first, i);
-                _last = std::max(_last, i);
-
-                _size++;
-                return _table.values[i];
-            }
-
-            if (_table.hashes[i] == hash &&
-                _table.keys[i] == key)
-            {
-                _table.values[i] = std::move(value);
-
-                return _table.values[i];
-            }
+            i = Claim(key, hash);
+            new (_table.values + i) Value(std::move(value));
         }
+        else
+            _table.values[i] = std::move(value);
 
-        // Shouldn't reach this point
-        return _table.values[_capacity];
+        return _table.values[i];
     }
 
     template <typename... Args>
     inline Value& Emplace(const Key& key, Args&&... args)
     {
-        if (GetLoadFactor() >= MAX_LOAD_FACTOR)
-            Rehash(_capacity * GROWTH_RATE);
-
-        T elem(std::forward<Args>(args)...);
-
-        Hash hash = hasher(elem);
-        u64 startIndex = hash % _capacity;
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
 
-        for (u64 i = (startIndex + 1) % _capacity; i != startIndex; i = (i + 1) % _capacity)
+        if (i == _capacity)
         {
-            State& currentPairState = _table.states[i];
-            if (currentPairState != State::FILLED)
-            {
-                CopyKey(key);
-
-                currentPairState = State::FILLED;
-                _table.hashes[i] = hash;
-                new(&_table.values + i) Value(std::forward<Args>(args)...);
-
-                _first = std::min(_first, i);
-                _last = std::max(_last, i);
-
-                _size++;
-                return _table.elements[i];
-            }
-
-            if (_table.hashes[i]   == hash &&
-                _table.elements[i] == elem)
-            {
-                _table.values[i] = Value(std::forward<Args>(args)...);
-                return _table.values[i];
-            }
+            i = Claim(key, hash);
+            new (_table.values + i) Value(std::forward<Args>(args)...);
         }
+        else
+            _table.values[i] = Value(std::forward<Args>(args)...);
 
-        // Shouldn't reach this point
-        return _table.values[_capacity];
+        return _table.values[i];
     }
 
     inline void Remove(const Key& key)
     {
-        iterator it = Find(key);
+        u64 index = FindIndex(key, hasher(key));
 
-        if (it == end())
+        if (index == _capacity)
         {
             Warn("Trying to remove non-existant key in table.");
             return;
         }
 
-        u64 index = it.index();
-
-        _table.states[index] = State::TOMBSTONE;
         _table.keys[index].~Key();
         _table.values[index].~Value();
         _size--;
 
-        // Update First and Last
-        if (_size == 0)
+        // Lookups stop at groups with an empty slot, so if this group has one nothing
+        // ever probed past it and the slot can be empty again. Otherwise it has to
+        // stay a tombstone until the next rehash.
+        u64 groupStart = index & ~(HashGroup::size - 1);
+        if (HashGroup::Group(_table.controls + groupStart).MatchEmpty())
         {
-            _first = _capacity;
-            _last = 0;
-        }
-        else if (index == _first)
-        {
-            for (u64 i = _first + 1; i <= _last; i++)
-            {
-                if (_table.states[i] == State::FILLED)
-                {
-                    _first = i;
-                    break;
-                }
-            }
-        }
-        else if (index == _last)
-        {
-            for (u64 i = _last - 1; i >= _first; i--)
-            {
-                if (_table.states[i] == State::FILLED)
-                {
-                    _last = i;
-                    break;
-                }
-            }
+            _table.controls[index] = HashGroup::EMPTY;
+            _growthLeft++;
         }
+        else
+            _table.controls[index] = HashGroup::DELETED;
     }
 
     // Constructors and Destructors
     HashTable(u64 capacity = START_CAP)
-    :   _size(0), _capacity(capacity)
-    ,   _first(capacity), _last(0)
     {
-        Allocate(_table, capacity);
+        ManualInit(capacity);
     }
 
     ~HashTable()
     {
-        for (u64 i = _first; i < _last; i++)
+        for (u64 i = 0; i < _capacity; i++)
         {
-            if (_table.states[i] == State::FILLED)
+            if (HashGroup::IsFull(_table.controls[i]))
             {
                 _table.keys[i].~Key();
                 _table.values[i].~Value();
@@ -480,49 +370,143 @@ public:
     }
 
 private:
-    inline float GetLoadFactor() const
+    // Index of the key, or _capacity if it's not in the table
+    inline u64 FindIndex(const Key& key, Hash hash) const
+    {
+        u64 groupCount = _capacity / HashGroup::size;
+        u64 groupMask = groupCount - 1;
+        u8 tag = HashGroup::GetTag(hash);
+
+        u64 group = HashGroup::GetStartGroup(hash, groupMask);
+        for (u64 step = 1; step <= groupCount; step++)
+        {
+            u64 groupStart = group * HashGroup::size;
+            HashGroup::Group controls(_table.controls + groupStart);
+
+            for (u32 match = controls.Match(tag); match; match &= match - 1)
+            {
+                u64 i = groupStart + CountTrailingZeros(match);
+                if (_table.keys[i] == key)
+                    return i;
+            }
+
+            if (controls.MatchEmpty())
+                break;
+
+            group = HashGroup::GetNextGroup(group, step, groupMask);
+        }
+
+        return _capacity;
+    }
+
+    // Calls resolve(i, FindIndex(keys[i])) for every key in order. Each key is hashed and
+    // its first group prefetched PREFETCH_DISTANCE keys before it's probed, so probing one
+    // key overlaps with the cache misses of the ones after it.
+    template <typename Resolve>
+    inline void FindEach(const Key* keys, u64 count, Resolve resolve) const
     {
-        return (float) _size / (float) _capacity;
+        Hash hashes[PREFETCH_DISTANCE];
+        u64 groupMask = _capacity / HashGroup::size - 1;
+
+        auto prefetch = [&](u64 i) {
+            Hash hash = hasher(keys[i]);
+            hashes[i % PREFETCH_DISTANCE] = hash;
+
+            u64 groupStart = HashGroup::GetStartGroup(hash, groupMask) * HashGroup::size;
+            HashGroup::Prefetch(_table.controls + groupStart);
+            HashGroup::Prefetch(_table.keys + groupStart);
+        };
+
+        u64 ahead = (count < PREFETCH_DISTANCE) ? count : PREFETCH_DISTANCE;
+        for (u64 i = 0; i < ahead; i++)
+            prefetch(i);
+
+        for (u64 i = 0; i < count; i++)
+        {
+            Hash hash = hashes[i % PREFETCH_DISTANCE];
+
+            if (i + PREFETCH_DISTANCE < count)
+                prefetch(i + PREFETCH_DISTANCE);
+
+            resolve(i, FindIndex(keys[i], hash));
+        }
     }
 
-    inline void CopyKey(u64 index, const Key& key)
+    // First empty or deleted slot along the key's probe sequence
+    static inline u64 FindFree(const TableData& table, u64 capacity, Hash hash)
     {
-        if (_table.states[index] == State::EMPTY)
-            new (_table.keys + index) Key(key);
-        else
-            _table.keys[index] = key;
+        u64 groupMask = capacity / HashGroup::size - 1;
+        u64 group = HashGroup::GetStartGroup(hash, groupMask);
+
+        for (u64 step = 1; ; step++)
+        {
+            u64 groupStart = group * HashGroup::size;
+            u32 free = HashGroup::Group(table.controls + groupStart).MatchFree();
+
+            if (free)
+                return groupStart + CountTrailingZeros(free);
+
+            group = HashGroup::GetNextGroup(group, step, groupMask);
+        }
+    }
+
+    // Takes a slot for a key that isn't in the table yet, the caller constructs the value
+    inline u64 Claim(const Key& key, Hash hash)
+    {
+        if (_growthLeft == 0)
+        {
+            // Mostly tombstones (lots of removes) get cleaned up in place instead of growing
+            if (_size < HashGroup::GetMaxLoad(_capacity) / 2)
+                Rehash(_capacity);
+            else
+                Rehash(_capacity * GROWTH_RATE);
+        }
+
+        u64 i = FindFree(_table, _capacity, hash);
+
+        // Reusing a tombstone doesn't make probes any longer
+        if (_table.controls[i] == HashGroup::EMPTY)
+            _growthLeft--;
+
+        _table.controls[i] = HashGroup::GetTag(hash);
+        _table.hashes[i] = hash;
+        new (_table.keys + i) Key(key);
+        _size++;
+
+        return i;
     }
 
+    // Capacity is a multiple of 16, so everything after the controls stays 16 byte aligned
     static inline void Allocate(TableData& table, u64 elements)
     {
-        State* ptr = (State*) PlatformAllocate(elements * (sizeof(Key) + sizeof(Value) + sizeof(Hash) + sizeof(State)));
+        u8* ptr = (u8*) PlatformAllocate(elements * (sizeof(u8) + sizeof(Hash) + sizeof(Key) + sizeof(Value)));
         AssertWithMessage(ptr, "Couldn't allocate table.");
 
-        table.states = ptr;
-        table.hashes = (Hash*)(table.states + elements);
-        table.keys   = (Key*)(table.hashes + elements);
-        table.values = (Value*)(table.keys + elements);
+        table.controls = ptr;
+        table.hashes   = (Hash*)(table.controls + elements);
+        table.keys     = (Key*)(table.hashes + elements);
+        table.values   = (Value*)(table.keys + elements);
 
-        PlatformSetMemory(table.states, (int) State::EMPTY, elements * sizeof(State));
+        PlatformSetMemory(table.controls, HashGroup::EMPTY, elements * sizeof(u8));
     }
 
     static inline void Deallocate(TableData& table)
     {
-        if (table.states)
+        if (table.controls)
         {
-            PlatformFree(table.states);
+            PlatformFree(table.controls);
 
-            table.states = nullptr;
-            table.hashes = nullptr;
-            table.keys   = nullptr;
-            table.values = nullptr;
+            table.controls = nullptr;
+            table.hashes   = nullptr;
+            table.keys     = nullptr;
+            table.values   = nullptr;
         }
     }
 
 private:
     TableData _table;
-    u64 _first, _last;
     u64 _size, _capacity;
+    u64 _growthLeft;        // Empty slots that can still be filled before the table has to grow
 
     Hasher hasher;
-};
\ No newline at end of file
+};
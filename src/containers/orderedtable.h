@@ -0,0 +1,510 @@
+#pragma once
+
+/*
+
+Ordered Table.
+
+Same interface as HashTable, for tables that get iterated a lot (JSON
+objects, anything printed or saved) or that should come back out in
+the order things were put in. Split into two arrays:
+
+    - entries: key and value of every element, in insertion order with
+      nothing in between except holes left by removes
+    - index: the open addressing part, but each slot only holds the
+      number of an entry, in a u8, u16 or u32 depending on how many
+      slots there are
+
+Iterating walks the entries array front to back. Index slots are tiny,
+so the index can stay sparse while the entries array only has to be as
+big as the number of elements, which makes the whole thing about half
+the size of a HashTable with the same elements.
+
+Hashes aren't stored, keys get hashed again when the index is rebuilt.
+Removes leave a hole in the entries (marked in a bit array that only
+exists once something's been removed) and a tombstone in the index.
+Both get squeezed out the next time the entries array fills up.
+
+*/
+
+#include <new>
+#include <utility>
+#include "hash.h"
+#include "core/logging.h"
+#include "core/types.h"
+#include "platform/platform.h"
+
+template <typename Key, typename Value, typename Hasher = Hasher<Key>>
+class OrderedTable
+{
+private:
+    static constexpr u64 START_CAP = 8;
+    static constexpr f32 GROWTH_RATE = 1.5f;
+
+    // Index slots hold the entry number + 2
+    static constexpr u32 EMPTY = 0;
+    static constexpr u32 DELETED = 1;
+    static constexpr u32 FIRST_ENTRY = 2;
+
+    struct Entry
+    {
+        Key   key;
+        Value value;
+    };
+
+public:
+    // Data structure for dereferencing iterators
+    struct KeyValuePair
+    {
+        Key& key;
+        Value& value;
+
+        KeyValuePair(Key& key, Value& value)
+        :   key(key), value(value)
+        {
+        }
+    };
+
+    // C++11 Iterators
+
+    // These are meant to be used temporarily. DON'T store them in
+    // variables to reference elements in the set outside a loop.
+    // Elements come out in the order they were put in.
+    class iterator
+    {
+    public:
+        // Operators
+
+        // Pre Increment (++it)
+        inline iterator& operator++(int)
+        {
+            advance();
+            return *this;
+        }
+
+        // Post Increment (it++)
+        inline iterator operator++()
+        {
+            iterator it = *this;
+            advance();
+            return it;
+        }
+
+        inline KeyValuePair operator*()
+        {
+            AssertWithMessage(_index < _table->_entryCount, "Trying to dereference a non existant value!");
+            return KeyValuePair(_table->_entries[_index].key, _table->_entries[_index].value);
+        }
+
+        inline const KeyValuePair operator*() const
+        {
+            AssertWithMessage(_index < _table->_entryCount, "Trying to dereference a non existant value!");
+            return KeyValuePair(_table->_entries[_index].key, _table->_entries[_index].value);
+        }
+
+        inline bool operator==(const iterator& other) const
+        {
+            return _table == other._table &&
+                   _index == other._index;
+        }
+
+        inline bool operator!=(const iterator& other) const
+        {
+            return _table != other._table ||
+                   _index != other._index;
+        }
+
+        // Conversions
+        inline operator bool() const
+        {
+            return *this != _table->end();
+        }
+
+        // Getters
+        inline u64 index() const
+        {
+            return _index;
+        }
+
+        inline Key& key() const
+        {
+            return _table->_entries[_index].key;
+        }
+
+        inline Value& value() const
+        {
+            return _table->_entries[_index].value;
+        }
+
+        // Constructors
+        iterator(const OrderedTable* table, u64 index)
+        :   _table(table), _index(index)
+        {
+        }
+
+        iterator(const iterator& other)
+        :   _table(other._table), _index(other._index)
+        {
+        }
+
+    private:
+        inline void advance()
+        {
+            if (_index >= _table->_entryCount)
+                return;
+
+            _index = _table->FindFilled(_index + 1);
+        }
+
+    private:
+        const OrderedTable* _table;
+        u64 _index;
+    };
+
+    inline const iterator begin() const { return iterator(this, FindFilled(0)); }
+    inline       iterator begin()       { return iterator(this, FindFilled(0)); }
+
+    inline const iterator end() const { return iterator(this, _entryCount); }
+    inline       iterator end()       { return iterator(this, _entryCount); }
+
+public:
+    // Getters
+    inline u64 size()     const { return _size; }
+    inline u64 capacity() const { return _entryCapacity; }
+
+    // Operators
+    inline const Value& operator[](const Key& key) const
+    {
+        return Find(key).value();
+    }
+
+    inline Value& operator[](const Key& key)
+    {
+        return At(key).value();
+    }
+
+    // Explicit Functions
+
+    // For tables in memory that was never constructed (like in a union)
+    inline void ManualInit(u64 capacity = START_CAP)
+    {
+        _entries = nullptr;
+        _index = nullptr;
+        _removed = nullptr;
+        _size = _entryCount = _entryCapacity = _indexCapacity = 0;
+
+        Rebuild(capacity > START_CAP ? capacity : START_CAP);
+    }
+
+    // Makes room for capacity elements (or all the ones already in there) and squeezes out holes
+    inline void Rehash(u64 capacity)
+    {
+        capacity = (capacity > _size) ? capacity : _size;
+        Rebuild(capacity > START_CAP ? capacity : START_CAP);
+    }
+
+    // Tries to find the element
+    // If not found, returns end()
+    inline iterator Find(const Key& key) const
+    {
+        u64 slot = FindSlot(key, hasher(key));
+        return iterator(this, (slot == _indexCapacity) ? _entryCount : GetSlot(slot) - FIRST_ENTRY);
+    }
+
+    // Tries to find the element
+    // If not found, places an empty element and returns that
+    inline iterator At(const Key& key)
+    {
+        Hash hash = hasher(key);
+        u64 slot = FindSlot(key, hash);
+
+        u64 i;
+        if (slot == _indexCapacity)
+        {
+            i = Claim(key, hash);
+            new (&_entries[i].value) Value();     // Represents empty value
+        }
+        else
+            i = GetSlot(slot) - FIRST_ENTRY;
+
+        return iterator(this, i);
+    }
+
+    inline Value& Place(const Key& key, const Value& value)
+    {
+        Hash hash = hasher(key);
+        u64 slot = FindSlot(key, hash);
+
+        if (slot == _indexCapacity)
+        {
+            u64 i = Claim(key, hash);
+            new (&_entries[i].value) Value(value);
+            return _entries[i].value;
+        }
+
+        Value& existing = _entries[GetSlot(slot) - FIRST_ENTRY].value;
+        if (existing != value)
+            existing = value;
+
+        return existing;
+    }
+
+    inline Value& Place(const Key& key, Value&& value)
+    {
+        Hash hash = hasher(key);
+        u64 slot = FindSlot(key, hash);
+
+        if (slot == _indexCapacity)
+        {
+            u64 i = Claim(key, hash);
+            new (&_entries[i].value) Value(std::move(value));
+            return _entries[i].value;
+        }
+
+        Value& existing = _entries[GetSlot(slot) - FIRST_ENTRY].value;
+        existing = std::move(value);
+
+        return existing;
+    }
+
+    template <typename... Args>
+    inline Value& Emplace(const Key& key, Args&&... args)
+    {
+        Hash hash = hasher(key);
+        u64 slot = FindSlot(key, hash);
+
+        if (slot == _indexCapacity)
+        {
+            u64 i = Claim(key, hash);
+            new (&_entries[i].value) Value(std::forward<Args>(args)...);
+            return _entries[i].value;
+        }
+
+        Value& existing = _entries[GetSlot(slot) - FIRST_ENTRY].value;
+        existing = Value(std::forward<Args>(args)...);
+
+        return existing;
+    }
+
+    inline void Remove(const Key& key)
+    {
+        u64 slot = FindSlot(key, hasher(key));
+
+        if (slot == _indexCapacity)
+        {
+            Warn("Trying to remove non-existant key in table.");
+            return;
+        }
+
+        u64 i = GetSlot(slot) - FIRST_ENTRY;
+        _entries[i].key.~Key();
+        _entries[i].value.~Value();
+
+        if (!_removed)
+        {
+            _removed = (u64*) PlatformAllocate(GetRemovedWords(_entryCapacity) * sizeof(u64));
+            AssertWithMessage(_removed, "Couldn't allocate table.");
+            PlatformZeroMemory(_removed, GetRemovedWords(_entryCapacity) * sizeof(u64));
+        }
+
+        _removed[i / 64] |= 1ull << (i % 64);
+
+        SetSlot(slot, DELETED);
+        _size--;
+    }
+
+    // Constructors and Destructors
+    OrderedTable(u64 capacity = START_CAP)
+    {
+        ManualInit(capacity);
+    }
+
+    ~OrderedTable()
+    {
+        for (u64 i = 0; i < _entryCount; i++)
+        {
+            if (!IsRemoved(i))
+            {
+                _entries[i].key.~Key();
+                _entries[i].value.~Value();
+            }
+        }
+
+        PlatformFree(_entries);
+        PlatformFree(_index);
+        PlatformFree(_removed);
+    }
+
+private:
+    static inline u64 GetRemovedWords(u64 entryCapacity)
+    {
+        return (entryCapacity + 63) / 64;
+    }
+
+    inline bool IsRemoved(u64 index) const
+    {
+        return _removed && (_removed[index / 64] & (1ull << (index % 64)));
+    }
+
+    // Index slots are kept at most 2/3 full, they're small enough that short probes are worth it
+    static inline u64 GetMaxLoad(u64 indexCapacity)
+    {
+        return indexCapacity - indexCapacity / 3;
+    }
+
+    // Bytes per index slot, just enough to count every entry the index can have
+    static inline u8 GetSlotWidth(u64 indexCapacity)
+    {
+        if (indexCapacity <= 0x100)
+            return sizeof(u8);
+
+        if (indexCapacity <= 0x10000)
+            return sizeof(u16);
+
+        return sizeof(u32);
+    }
+
+    inline u32 GetSlot(u64 slot) const
+    {
+        switch (_slotWidth)
+        {
+            case sizeof(u8):  return ((const u8*) _index)[slot];
+            case sizeof(u16): return ((const u16*) _index)[slot];
+            default:          return ((const u32*) _index)[slot];
+        }
+    }
+
+    inline void SetSlot(u64 slot, u32 value)
+    {
+        switch (_slotWidth)
+        {
+            case sizeof(u8):  ((u8*) _index)[slot] = (u8) value;   break;
+            case sizeof(u16): ((u16*) _index)[slot] = (u16) value; break;
+            default:          ((u32*) _index)[slot] = value;       break;
+        }
+    }
+
+    // Entry index of the next element at or after index, _entryCount if there's none
+    inline u64 FindFilled(u64 index) const
+    {
+        while (index < _entryCount && IsRemoved(index))
+            index++;
+
+        return index;
+    }
+
+    // Index slot pointing at the key, or _indexCapacity if it's not in the table
+    inline u64 FindSlot(const Key& key, Hash hash) const
+    {
+        u64 mask = _indexCapacity - 1;
+
+        for (u64 slot = hash & mask; ; slot = (slot + 1) & mask)
+        {
+            u32 value = GetSlot(slot);
+
+            if (value == EMPTY)
+                return _indexCapacity;
+
+            if (value == DELETED)
+                continue;
+
+            if (_entries[value - FIRST_ENTRY].key == key)
+                return slot;
+        }
+    }
+
+    // First empty or deleted index slot along the hash's probe sequence
+    inline u64 FindFree(Hash hash) const
+    {
+        u64 mask = _indexCapacity - 1;
+        u64 slot = hash & mask;
+
+        while (GetSlot(slot) != EMPTY && GetSlot(slot) != DELETED)
+            slot = (slot + 1) & mask;
+
+        return slot;
+    }
+
+    // Adds an entry for a key that isn't in the table yet, the caller constructs the value
+    inline u64 Claim(const Key& key, Hash hash)
+    {
+        if (_entryCount == _entryCapacity)
+        {
+            // Mostly holes (lots of removes) get squeezed out instead of growing
+            if (_size < _entryCapacity / 2)
+                Rebuild(_entryCapacity);
+            else
+                Rebuild((u64) (_entryCapacity * GROWTH_RATE));
+        }
+
+        u64 i = _entryCount++;
+        new (&_entries[i].key) Key(key);
+        _size++;
+
+        SetSlot(FindFree(hash), (u32) (i + FIRST_ENTRY));
+
+        return i;
+    }
+
+    // Moves the elements into a new entries array without the holes and rebuilds the index for it,
+    // hashing every key again
+    inline void Rebuild(u64 entryCapacity)
+    {
+        Entry* entries = (Entry*) PlatformAllocate(entryCapacity * sizeof(Entry));
+        AssertWithMessage(entries, "Couldn't allocate table entries.");
+
+        u64 count = 0;
+        for (u64 i = 0; i < _entryCount; i++)
+        {
+            if (IsRemoved(i))
+                continue;
+
+            Entry& entry = _entries[i];
+            new (&entries[count].key) Key(std::move(entry.key));
+            new (&entries[count].value) Value(std::move(entry.value));
+            count++;
+
+            entry.key.~Key();
+            entry.value.~Value();
+        }
+
+        PlatformFree(_entries);
+        PlatformFree(_removed);
+
+        _entries = entries;
+        _removed = nullptr;
+        _entryCount = count;
+        _entryCapacity = entryCapacity;
+
+        u64 indexCapacity = 16;
+        while (GetMaxLoad(indexCapacity) < entryCapacity)
+            indexCapacity *= 2;
+
+        if (indexCapacity != _indexCapacity)
+        {
+            PlatformFree(_index);
+
+            _indexCapacity = indexCapacity;
+            _slotWidth = GetSlotWidth(indexCapacity);
+            _index = PlatformAllocate(indexCapacity * _slotWidth);
+            AssertWithMessage(_index, "Couldn't allocate table index.");
+        }
+
+        PlatformSetMemory(_index, EMPTY, _indexCapacity * _slotWidth);
+
+        for (u64 i = 0; i < _entryCount; i++)
+            SetSlot(FindFree(hasher(_entries[i].key)), (u32) (i + FIRST_ENTRY));
+    }
+
+private:
+    Entry* _entries;
+    void*  _index;
+    u64*   _removed;        // A bit per entry, set for holes. Null until something's removed
+
+    u64 _size;
+    u64 _entryCount;        // Elements and holes, the end of the used part of the entries array
+    u64 _entryCapacity;
+    u64 _indexCapacity;
+    u8  _slotWidth;
+
+    Hasher hasher;
+};
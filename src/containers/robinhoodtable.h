@@ -0,0 +1,498 @@
+#pragma once
+
+/*
+
+Robin Hood Table.
+
+Same interface as HashTable, for tables that see a lot of removes
+(sessions, per frame assets, caches). Linear probing where every slot
+remembers how far it is from its home slot:
+
+    - inserts take slots from elements closer to home than the new one
+      would be, so how far anything sits from home evens out
+    - lookups stop as soon as they reach a slot that's closer to home
+      than the key would be by then, so misses are as short as hits
+    - removes shift the run after the slot back by one instead of leaving
+      a tombstone, so the table after a remove looks exactly like one the
+      element was never put in
+
+Nothing builds up under churn, so probe lengths only depend on the load.
+
+*/
+
+#include <new>
+#include <utility>
+#include "hash.h"
+#include "core/logging.h"
+#include "core/types.h"
+#include "platform/platform.h"
+
+template <typename Key, typename Value, typename Hasher = Hasher<Key>>
+class RobinHoodTable
+{
+private:
+    static constexpr u64 START_CAP = 16;
+    static constexpr u64 GROWTH_RATE = 2;
+    static constexpr u8  MAX_DISTANCE = 255;     // Growing is cheaper than a probe this long
+
+    struct TableData
+    {
+        u8*    distances { nullptr };   // Distance from home + 1, 0 for empty slots
+        Hash*  hashes    { nullptr };
+        Key*   keys      { nullptr };
+        Value* values    { nullptr };
+    };
+
+public:
+    // Data structure for dereferencing iterators
+    struct KeyValuePair
+    {
+        Key& key;
+        Value& value;
+
+        KeyValuePair(Key& key, Value& value)
+        :   key(key), value(value)
+        {
+        }
+    };
+
+    // C++11 Iterators
+
+    // These are meant to be used temporarily. DON'T store them in
+    // variables to reference elements in the set outside a loop.
+    // Removing shifts elements around, so that invalidates them too.
+    class iterator
+    {
+    public:
+        // Operators
+
+        // Pre Increment (++it)
+        inline iterator& operator++(int)
+        {
+            advance();
+            return *this;
+        }
+
+        // Post Increment (it++)
+        inline iterator operator++()
+        {
+            iterator it = *this;
+            advance();
+            return it;
+        }
+
+        inline KeyValuePair operator*()
+        {
+            AssertWithMessage(_index < _table->_capacity, "Trying to dereference a non existant value!");
+            return KeyValuePair(_table->_table.keys[_index], _table->_table.values[_index]);
+        }
+
+        inline const KeyValuePair operator*() const
+        {
+            AssertWithMessage(_index < _table->_capacity, "Trying to dereference a non existant value!");
+            return KeyValuePair(_table->_table.keys[_index], _table->_table.values[_index]);
+        }
+
+        inline bool operator==(const iterator& other) const
+        {
+            return _table == other._table &&
+                   _index == other._index;
+        }
+
+        inline bool operator!=(const iterator& other) const
+        {
+            return _table != other._table ||
+                   _index != other._index;
+        }
+
+        // Conversions
+        inline operator bool() const
+        {
+            return *this != _table->end();
+        }
+
+        // Getters
+        inline u64 index() const
+        {
+            return _index;
+        }
+
+        inline Key& key() const
+        {
+            return _table->_table.keys[_index];
+        }
+
+        inline Value& value() const
+        {
+            return _table->_table.values[_index];
+        }
+
+        // Constructors
+        iterator(const RobinHoodTable* table, u64 index)
+        :   _table(table), _index(index)
+        {
+        }
+
+        iterator(const iterator& other)
+        :   _table(other._table), _index(other._index)
+        {
+        }
+
+    private:
+        inline void advance()
+        {
+            if (_index >= _table->_capacity)
+                return;
+
+            _index = _table->FindFilled(_index + 1);
+        }
+
+    private:
+        const RobinHoodTable* _table;
+        u64 _index;
+    };
+
+    inline const iterator begin() const { return iterator(this, FindFilled(0)); }
+    inline       iterator begin()       { return iterator(this, FindFilled(0)); }
+
+    inline const iterator end() const { return iterator(this, _capacity); }
+    inline       iterator end()       { return iterator(this, _capacity); }
+
+public:
+    // Getters
+    inline u64 size()     const { return _size; }
+    inline u64 capacity() const { return _capacity; }
+
+    // Operators
+    inline const Value& operator[](const Key& key) const
+    {
+        return Find(key).value();
+    }
+
+    inline Value& operator[](const Key& key)
+    {
+        return At(key).value();
+    }
+
+    // Explicit Functions
+
+    // For tables in memory that was never constructed (like in a union)
+    inline void ManualInit(u64 capacity = START_CAP)
+    {
+        capacity = GetCapacity(capacity);
+        Allocate(_table, capacity);
+
+        _capacity = capacity;
+        _size = 0;
+    }
+
+    // Capacity is rounded up to a power of 2 with room for every element
+    inline void Rehash(u64 capacity)
+    {
+        capacity = GetCapacity(capacity);
+        while (GetMaxLoad(capacity) <= _size)
+            capacity *= 2;
+
+        TableData oldTable = _table;
+        u64 oldCapacity = _capacity;
+
+        Allocate(_table, capacity);
+        _capacity = capacity;
+
+        for (u64 i = 0; i < oldCapacity; i++)
+        {
+            if (oldTable.distances[i] == 0)
+                continue;
+
+            u64 j = Insert(oldTable.hashes[i]);
+            AssertWithMessage(j < _capacity, "Too many keys hash to the same place!");
+
+            new (_table.keys + j) Key(std::move(oldTable.keys[i]));
+            new (_table.values + j) Value(std::move(oldTable.values[i]));
+
+            oldTable.keys[i].~Key();
+            oldTable.values[i].~Value();
+        }
+
+        Deallocate(oldTable);
+    }
+
+    // Tries to find the element
+    // If not found, returns end()
+    inline iterator Find(const Key& key) const
+    {
+        return iterator(this, FindIndex(key, hasher(key)));
+    }
+
+    // Tries to find the element
+    // If not found, places an empty element and returns that
+    inline iterator At(const Key& key)
+    {
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
+
+        if (i == _capacity)
+        {
+            i = Claim(key, hash);
+            new (_table.values + i) Value();     // Represents empty value
+        }
+
+        return iterator(this, i);
+    }
+
+    inline Value& Place(const Key& key, const Value& value)
+    {
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
+
+        if (i == _capacity)
+        {
+            i = Claim(key, hash);
+            new (_table.values + i) Value(value);
+        }
+        else if (_table.values[i] != value)
+            _table.values[i] = value;
+
+        return _table.values[i];
+    }
+
+    inline Value& Place(const Key& key, Value&& value)
+    {
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
+
+        if (i == _capacity)
+        {
+            i = Claim(key, hash);
+            new (_table.values + i) Value(std::move(value));
+        }
+        else
+            _table.values[i] = std::move(value);
+
+        return _table.values[i];
+    }
+
+    template <typename... Args>
+    inline Value& Emplace(const Key& key, Args&&... args)
+    {
+        Hash hash = hasher(key);
+        u64 i = FindIndex(key, hash);
+
+        if (i == _capacity)
+        {
+            i = Claim(key, hash);
+            new (_table.values + i) Value(std::forward<Args>(args)...);
+        }
+        else
+            _table.values[i] = Value(std::forward<Args>(args)...);
+
+        return _table.values[i];
+    }
+
+    inline void Remove(const Key& key)
+    {
+        u64 index = FindIndex(key, hasher(key));
+
+        if (index == _capacity)
+        {
+            Warn("Trying to remove non-existant key in table.");
+            return;
+        }
+
+        _table.keys[index].~Key();
+        _table.values[index].~Value();
+        _size--;
+
+        // Pull the rest of the run back a slot, until an empty slot or one already at home
+        u64 mask = _capacity - 1;
+        u64 i = index;
+        u64 next = (i + 1) & mask;
+
+        while (_table.distances[next] > 1)
+        {
+            _table.distances[i] = _table.distances[next] - 1;
+            _table.hashes[i] = _table.hashes[next];
+            Move(next, i);
+
+            i = next;
+            next = (next + 1) & mask;
+        }
+
+        _table.distances[i] = 0;
+    }
+
+    // Constructors and Destructors
+    RobinHoodTable(u64 capacity = START_CAP)
+    {
+        ManualInit(capacity);
+    }
+
+    ~RobinHoodTable()
+    {
+        for (u64 i = 0; i < _capacity; i++)
+        {
+            if (_table.distances[i])
+            {
+                _table.keys[i].~Key();
+                _table.values[i].~Value();
+            }
+        }
+
+        Deallocate(_table);
+    }
+
+private:
+    // Rounds up to a power of 2
+    static inline u64 GetCapacity(u64 requested)
+    {
+        u64 capacity = START_CAP;
+        while (capacity < requested)
+            capacity *= 2;
+
+        return capacity;
+    }
+
+    // Robin Hood tables stay fast up to fairly high loads, 7/8 of the slots
+    static inline u64 GetMaxLoad(u64 capacity)
+    {
+        return capacity - capacity / 8;
+    }
+
+    // Slot index of the next filled slot at or after index, capacity if there's none
+    inline u64 FindFilled(u64 index) const
+    {
+        while (index < _capacity && _table.distances[index] == 0)
+            index++;
+
+        return index;
+    }
+
+    // Index of the key, or _capacity if it's not in the table
+    inline u64 FindIndex(const Key& key, Hash hash) const
+    {
+        u64 mask = _capacity - 1;
+        u64 i = hash & mask;
+
+        // Anything closer to home than the key would be here was put in after
+        // it would have been, and would have had to push it along
+        for (u64 distance = 1; distance <= _table.distances[i]; distance++)
+        {
+            if (_table.hashes[i] == hash &&
+                _table.keys[i] == key)
+                return i;
+
+            i = (i + 1) & mask;
+        }
+
+        return _capacity;
+    }
+
+    // Moves the key and value in slot from into the (unconstructed) slot to
+    inline void Move(u64 from, u64 to)
+    {
+        new (_table.keys + to) Key(std::move(_table.keys[from]));
+        new (_table.values + to) Value(std::move(_table.values[from]));
+
+        _table.keys[from].~Key();
+        _table.values[from].~Value();
+    }
+
+    // Finds the slot for a new hash and makes room in it by pushing the rest of
+    // its run along a slot. Returns the slot, whose key and value the caller
+    // constructs, or _capacity if a distance would get too long to store.
+    inline u64 Insert(Hash hash)
+    {
+        u64 mask = _capacity - 1;
+        u64 i = hash & mask;
+        u64 distance = 1;
+
+        // Skip past everything at least as far from home as the new element would be
+        while (_table.distances[i] >= distance)
+        {
+            i = (i + 1) & mask;
+            distance++;
+        }
+
+        if (distance >= MAX_DISTANCE)
+            return _capacity;
+
+        // Every element from here to the next empty slot moves one further from home
+        u64 end = i;
+        while (_table.distances[end])
+        {
+            if (_table.distances[end] + 1 >= MAX_DISTANCE)
+                return _capacity;
+
+            end = (end + 1) & mask;
+        }
+
+        while (end != i)
+        {
+            u64 prev = (end - 1) & mask;
+
+            _table.distances[end] = _table.distances[prev] + 1;
+            _table.hashes[end] = _table.hashes[prev];
+            Move(prev, end);
+
+            end = prev;
+        }
+
+        _table.distances[i] = (u8) distance;
+        _table.hashes[i] = hash;
+
+        return i;
+    }
+
+    // Takes a slot for a key that isn't in the table yet, the caller constructs the value
+    inline u64 Claim(const Key& key, Hash hash)
+    {
+        if (_size >= GetMaxLoad(_capacity))
+            Rehash(_capacity * GROWTH_RATE);
+
+        u64 i = Insert(hash);
+        while (i == _capacity)
+        {
+            // Only happens with a terrible hasher, spreading out is the best that can be done
+            Rehash(_capacity * GROWTH_RATE);
+            i = Insert(hash);
+        }
+
+        new (_table.keys + i) Key(key);
+        _size++;
+
+        return i;
+    }
+
+    // Capacity is a multiple of 16, so everything after the distances stays 16 byte aligned
+    static inline void Allocate(TableData& table, u64 elements)
+    {
+        u8* ptr = (u8*) PlatformAllocate(elements * (sizeof(u8) + sizeof(Hash) + sizeof(Key) + sizeof(Value)));
+        AssertWithMessage(ptr, "Couldn't allocate table.");
+
+        table.distances = ptr;
+        table.hashes    = (Hash*)(table.distances + elements);
+        table.keys      = (Key*)(table.hashes + elements);
+        table.values    = (Value*)(table.keys + elements);
+
+        PlatformSetMemory(table.distances, 0, elements * sizeof(u8));
+    }
+
+    static inline void Deallocate(TableData& table)
+    {
+        if (table.distances)
+        {
+            PlatformFree(table.distances);
+
+            table.distances = nullptr;
+            table.hashes    = nullptr;
+            table.keys      = nullptr;
+            table.values    = nullptr;
+        }
+    }
+
+private:
+    TableData _table;
+    u64 _size, _capacity;
+
+    Hasher hasher;
+};
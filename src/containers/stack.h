@@ -128,15 +128,15 @@ public:
     }
 
     Stack(const Stack& other)
-    :   _stack(Allocate(other._capacity)),
+    :   _stack(Allocate(other._capacity))
     ,   _size(other._size), _capacity(other._capacity)
     {
         CopyStack(other._stack, other._size);
     }
 
     Stack(Stack&& other)
-    :   _stack(other._stack),
-    :   _size(other._size), _capacity(other._capacity)
+    :   _stack(other._stack)
+    ,   _size(other._size), _capacity(other._capacity)
     {
         other._size = other._capacity = 0;
         other._stack = nullptr;
@@ -20,6 +20,7 @@ same buffer can be reused for other strings in the future.
 
 */
 
+#include <cstring>
 #include <ostream>
 #include <emmintrin.h>
 
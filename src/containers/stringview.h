@@ -161,7 +161,7 @@ public:
     }
 
     // SubString
-    inline StringView SubString(u64 start, u64 count = 18446744073709551615Ui64) const
+    inline StringView SubString(u64 start, u64 count = 18446744073709551615ull) const
     {
         return StringView(_bufferPtr + start, count);
     }
@@ -234,7 +234,7 @@ public:
     {
     }
 
-    StringView(const String& str, u64 start, u64 count = 18446744073709551615Ui64)
+    StringView(const String& str, u64 start, u64 count = 18446744073709551615ull)
     :   _bufferPtr(str.cstr() + start)
     ,   _length((str._length - start <= count) ? str._length - start : count)
     {
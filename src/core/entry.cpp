@@ -2,20 +2,19 @@
 #include "application_internal.h"
 #include "input.h"
 #include "input_processing.h"
+#include "jobs.h"
 #include "engine/engine.h"
 #include "graphics/graphics.h"
 #include "platform/platform.h"
 #include "physics/physics.h"
-
-// For random numbers
-#include <ctime>
+#include "math/random.h"
 
 extern void CreateApp(Application& app);
 
 int main()
 {
-    // For Random Numbers
-    srand(time(0));
+    // Default random streams differ every run, anything that needs to be reproducible seeds its own state
+    Math::SetDefaultRandomSeed(Math::GetTimeSeed());
 
     Application app;
     CreateApp(app);
@@ -38,6 +37,7 @@ int main()
     GraphicsSetVsync(true);
 
     Engine::Init(app);
+    Jobs::Init();
 
     #ifdef GN_USE_PHYSICS
     Physics::Init();
@@ -74,6 +74,7 @@ int main()
     Physics::Shutdown();
     #endif
 
+    Jobs::Shutdown();
     Engine::Shutdown();
 
     PlatformWindowShutdown(pstate);
@@ -0,0 +1,176 @@
+#include "jobs.h"
+
+#include "types.h"
+#include "logging.h"
+#include "containers/function.h"
+#include "platform/platform.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Jobs
+{
+
+struct Job
+{
+    JobFunction function = nullptr;
+    void* data = nullptr;
+
+    s32 count = 0;
+    s32 chunkSize = 1;
+
+    std::atomic<s32> next { 0 };        // Start of the next chunk to hand out
+    std::atomic<s32> running { 0 };     // Workers still inside this job
+};
+
+static struct
+{
+    std::thread* workers = nullptr;
+    s32 workerCount = 0;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::mutex submitMutex;             // Only one ParallelFor at a time
+
+    Job job;
+    u64 generation = 0;                 // Bumped for every new job so workers don't run one twice
+    bool quit = false;
+} pool;
+
+static thread_local s32 currentThreadIndex = 0;
+static thread_local bool insideJob = false;
+
+static void RunChunks(Job& job, s32 threadIndex)
+{
+    insideJob = true;
+
+    while (true)
+    {
+        s32 begin = job.next.fetch_add(job.chunkSize);
+        if (begin >= job.count)
+            break;
+
+        s32 end = (begin + job.chunkSize < job.count) ? begin + job.chunkSize : job.count;
+        job.function(job.data, begin, end, threadIndex);
+    }
+
+    insideJob = false;
+}
+
+static void WorkerLoop(s32 threadIndex)
+{
+    currentThreadIndex = threadIndex;
+    u64 seenGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(pool.mutex);
+            pool.wake.wait(lock, [&]() { return pool.quit || pool.generation != seenGeneration; });
+
+            if (pool.quit)
+                return;
+
+            seenGeneration = pool.generation;
+        }
+
+        RunChunks(pool.job, threadIndex);
+
+        if (pool.job.running.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            pool.done.notify_one();
+        }
+    }
+}
+
+void Init(s32 threadCount)
+{
+    AssertWithMessage(pool.workers == nullptr, "Worker pool is already initialized!");
+
+    if (threadCount <= 0)
+        threadCount = (s32) std::thread::hardware_concurrency();
+
+    // The calling thread counts as one of the threads
+    pool.workerCount = (threadCount > 1) ? threadCount - 1 : 0;
+    pool.quit = false;
+
+    if (pool.workerCount == 0)
+        return;
+
+    pool.workers = (std::thread*) PlatformAllocate(pool.workerCount * sizeof(std::thread));
+    AssertWithMessage(pool.workers, "Failed to allocate worker threads!");
+
+    for (s32 i = 0; i < pool.workerCount; i++)
+        new (pool.workers + i) std::thread(WorkerLoop, i + 1);
+}
+
+void Shutdown()
+{
+    if (!pool.workers)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.quit = true;
+    }
+    pool.wake.notify_all();
+
+    for (s32 i = 0; i < pool.workerCount; i++)
+    {
+        pool.workers[i].join();
+        pool.workers[i].~thread();
+    }
+
+    PlatformFree(pool.workers);
+    pool.workers = nullptr;
+    pool.workerCount = 0;
+}
+
+s32 GetThreadCount()
+{
+    return pool.workerCount + 1;
+}
+
+void ParallelFor(s32 count, s32 chunkSize, JobFunction job, void* data)
+{
+    if (count <= 0)
+        return;
+
+    if (chunkSize < 1)
+        chunkSize = 1;
+
+    // Nested calls and single threaded pools just run everything here
+    if (!pool.workers || insideJob || count <= chunkSize)
+    {
+        job(data, 0, count, currentThreadIndex);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(pool.submitMutex);
+
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+
+        pool.job.function = job;
+        pool.job.data = data;
+        pool.job.count = count;
+        pool.job.chunkSize = chunkSize;
+        pool.job.next = 0;
+        pool.job.running = pool.workerCount;
+
+        pool.generation++;
+    }
+    pool.wake.notify_all();
+
+    RunChunks(pool.job, 0);
+
+    // Wait for the workers to leave the job before it can be replaced
+    std::unique_lock<std::mutex> lock(pool.mutex);
+    pool.done.wait(lock, []() { return pool.job.running.load() == 0; });
+}
+
+} // namespace Jobs
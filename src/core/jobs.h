@@ -0,0 +1,37 @@
+#pragma once
+
+#include "types.h"
+#include "containers/function.h"
+
+/*
+
+Worker Pool.
+
+A fixed set of worker threads that split a range of indices between them.
+The calling thread works on the range too, so a pool with N workers runs
+ParallelFor on N + 1 threads.
+
+Jobs are plain function pointers plus a data pointer, like Application's
+callbacks, so no allocation happens per call.
+
+*/
+
+namespace Jobs
+{
+
+// [begin, end) is the range this call should work on, threadIndex is in [0, GetThreadCount())
+using JobFunction = Function<void(void* data, s32 begin, s32 end, s32 threadIndex)>;
+
+// threadCount <= 0 uses every hardware thread
+void Init(s32 threadCount = 0);
+void Shutdown();
+
+// Number of threads that take part in ParallelFor (workers + the calling thread)
+s32 GetThreadCount();
+
+// Calls job on chunks of [0, count) from every thread and waits for all of them.
+// Runs inline on the calling thread if the pool wasn't initialized, or if it's
+// called from inside another job.
+void ParallelFor(s32 count, s32 chunkSize, JobFunction job, void* data);
+
+} // namespace Jobs
@@ -20,20 +20,22 @@ inline static void Warn_Internal(const char* file, const char* function, const i
     std::cout << "Line: " << line << '\n';
 }
 
-// Defining a compiler agnostic way for haulting the program
+// Defining a compiler agnostic way for haulting the program and naming the function
 #ifdef _MSC_VER
 #include <intrin.h>
 #define DebugBreak() __debugbreak()
+#define FunctionSignature __FUNCSIG__
 #else
 #define DebugBreak() __builtin_trap()
+#define FunctionSignature __PRETTY_FUNCTION__
 #endif
 
-#define AssertWithMessage(x, msg)  if (!(x)) { Assert_Internal(__FILE__, __FUNCSIG__, __LINE__, msg); DebugBreak(); }
-#define Assert(x)  if (!(x)) { Assert_Internal(__FILE__, __FUNCSIG__, __LINE__, #x); DebugBreak(); }
-#define AssertNotImplemented() { Assert_Internal(__FILE__, __FUNCSIG__, __LINE__, "Function not implemented!"); DebugBreak(); }
+#define AssertWithMessage(x, msg)  if (!(x)) { Assert_Internal(__FILE__, FunctionSignature, __LINE__, msg); DebugBreak(); }
+#define Assert(x)  if (!(x)) { Assert_Internal(__FILE__, FunctionSignature, __LINE__, #x); DebugBreak(); }
+#define AssertNotImplemented() { Assert_Internal(__FILE__, FunctionSignature, __LINE__, "Function not implemented!"); DebugBreak(); }
 
-#define WarnIf(cond, msg) if ((cond)) { Warn_Internal(__FILE__, __FUNCSIG__, __LINE__, msg); }
-#define Warn(msg) Warn_Internal(__FILE__, __FUNCSIG__, __LINE__, msg)
+#define WarnIf(cond, msg) if ((cond)) { Warn_Internal(__FILE__, FunctionSignature, __LINE__, msg); }
+#define Warn(msg) Warn_Internal(__FILE__, FunctionSignature, __LINE__, msg)
 
 #else
 
@@ -41,7 +43,7 @@ inline static void Warn_Internal(const char* file, const char* function, const i
 #define Assert(x) (x)
 #define AssertNotImplemented()
 
-#define WarnIf(cond, msg)
+#define WarnIf(cond, msg) (void) (cond)
 #define Warn(msg)
 
 #endif // GN_RELEASE
\ No newline at end of file
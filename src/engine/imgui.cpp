@@ -363,11 +363,13 @@ Vector2 GetRenderedCharSize(char ch, Font& font, f32 size)
     return Vector2(size * glyph.advance, size * font.lineHeight);
 }
 
-static void PushUIQuad(ImguiBatchData& batch, const Rect& rect, const Vector4& texCoords, const Texture& tex, const Vector4& color)
+// Makes room for quadCount more quads and returns the slot tex is bound to
+static int ReserveUIQuads(ImguiBatchData& batch, const Texture& tex, s32 quadCount)
 {
     AssertWithMessage(activeApp, "Imgui was never initialized!");
+    AssertWithMessage(quadCount <= maxQuadCount, "Too many quads for one batch!");
 
-    if (batch.elemCount >= maxQuadCount)
+    if (batch.elemCount + quadCount > maxQuadCount)
     {
         End();
         Begin();
@@ -399,6 +401,11 @@ static void PushUIQuad(ImguiBatchData& batch, const Rect& rect, const Vector4& t
         batch.nextActiveTexSlot++;
     }
 
+    return textureSlot;
+}
+
+static void WriteUIQuad(ImguiBatchData& batch, const Rect& rect, const Vector4& texCoords, int textureSlot, const Vector4& color)
+{
     f32 top    = 1.0f - 2.0f * (rect.topLeft.y / activeApp->window.refHeight);
     f32 left   = 2.0f * (rect.topLeft.x / activeApp->window.refWidth) - 1.0f;
     f32 right  = 2.0f * ((rect.topLeft.x + rect.size.x) / activeApp->window.refWidth) - 1.0f;
@@ -433,12 +440,27 @@ static void PushUIQuad(ImguiBatchData& batch, const Rect& rect, const Vector4& t
     batch.elemCount++;
 }
 
+static void PushUIQuad(ImguiBatchData& batch, const Rect& rect, const Vector4& texCoords, const Texture& tex, const Vector4& color)
+{
+    int textureSlot = ReserveUIQuads(batch, tex, 1);
+    WriteUIQuad(batch, rect, texCoords, textureSlot, color);
+}
+
 void RenderRect(const Rect& rect, const Vector4& color)
 {
     Vector4 texCoords { 0.0f, 0.0f, 1.0f, 1.0f };
     PushUIQuad(uidata.quadBatch, rect, texCoords, uidata.whiteTexture, color);
 }
 
+void RenderRects(const Rect* rects, const Vector4* colors, s32 count)
+{
+    Vector4 texCoords { 0.0f, 0.0f, 1.0f, 1.0f };
+
+    int textureSlot = ReserveUIQuads(uidata.quadBatch, uidata.whiteTexture, count);
+    for (s32 i = 0; i < count; i++)
+        WriteUIQuad(uidata.quadBatch, rects[i], texCoords, textureSlot, colors[i]);
+}
+
 void RenderImage(const Image& image, const Vector3& topLeft, const Vector2& scale, const Vector4& tint)
 {
     // Since these will be used for all images
@@ -71,6 +71,9 @@ Vector2 GetRenderedTextSize(StringView text, Font& font, f32 size = -1.0f);
 Vector2 GetRenderedCharSize(char ch, Font& font, f32 size = -1.0f);
 
 void RenderRect(const Rect& rect, const Vector4& color);
+
+// Same as calling RenderRect for each one, but the rects are guaranteed to land in the same draw call
+void RenderRects(const Rect* rects, const Vector4* colors, s32 count);
 void RenderImage(const Image& image, const Vector3& topLeft, const Vector2& scale = Vector2(1.0f), const Vector4& tint = Vector4(1.0f));
 bool RenderButton(ID id, const Rect& rect, const Vector4& defaultColor = Vector4(0.5f, 0.5f, 0.5f, 1.0f), const Vector4& hoverColor = Vector4(0.75f, 0.75f, 0.75f, 1.0f), const Vector4& pressedColor = Vector4(0.35f, 0.35f, 0.35f, 1.0f));
 
@@ -0,0 +1,126 @@
+#include "absurdle.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "feedback_matrix.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace Absurdle
+{
+
+// How much a feedback gives away, lower is better for the adversary.
+// Correct letters count for more than any number of placed ones.
+struct RevealTable
+{
+    u8 revealed[Scoring::feedbackCount];
+
+    constexpr RevealTable() : revealed()
+    {
+        for (s32 f = 0; f < Scoring::feedbackCount; f++)
+        {
+            s32 digits = f;
+            for (s32 i = 0; i < wordLength; i++, digits /= 3)
+                revealed[f] += (digits % 3 == 2) ? (wordLength + 1) : (digits % 3);
+        }
+    }
+};
+
+static constexpr RevealTable revealTable;
+
+void PartitionByFeedback(s32 guessIndex, const u16* candidates, s32 count, Partition& partition)
+{
+    AssertWithMessage(count >= 0 && count <= answersEnd, "Too many candidates to partition!");
+
+    Scoring::Feedback* feedback = partition.feedback;
+
+    // Feedback for every candidate, gathered from one matrix row (candidates are
+    // ascending, so this walks it forwards) or scored in one batch
+    if (FeedbackMatrix::IsLoaded())
+    {
+        const Scoring::Feedback* row = FeedbackMatrix::GetRow(guessIndex);
+        for (s32 i = 0; i < count; i++)
+            feedback[i] = row[candidates[i]];
+    }
+    else
+    {
+        for (s32 i = 0; i < count; i++)
+            partition.packedWords[i] = packedWordList[candidates[i]];
+
+        Scoring::ScoreBatch(packedWordList[guessIndex], partition.packedWords, count, feedback);
+    }
+
+    // Counting sort: sizes, offsets, then a stable scatter
+    s32 binSizes[Scoring::feedbackCount] = {};
+    for (s32 i = 0; i < count; i++)
+        binSizes[feedback[i]]++;
+
+    s32 offset = 0;
+    for (s32 f = 0; f < Scoring::feedbackCount; f++)
+    {
+        partition.binStart[f] = offset;
+        offset += binSizes[f];
+    }
+
+    partition.binStart[Scoring::feedbackCount] = offset;
+
+    s32* next = binSizes;   // Reused as the write position of each bin
+    for (s32 f = 0; f < Scoring::feedbackCount; f++)
+        next[f] = partition.binStart[f];
+
+    for (s32 i = 0; i < count; i++)
+        partition.words[next[feedback[i]]++] = candidates[i];
+}
+
+Scoring::Feedback PickBin(const Partition& partition)
+{
+    Scoring::Feedback best = 0;
+    s32 bestSize = -1;
+
+    for (s32 f = 0; f < Scoring::feedbackCount; f++)
+    {
+        s32 size = partition.binStart[f + 1] - partition.binStart[f];
+
+        if (size > bestSize || (size == bestSize && revealTable.revealed[f] < revealTable.revealed[best]))
+        {
+            best = (Scoring::Feedback) f;
+            bestSize = size;
+        }
+    }
+
+    return best;
+}
+
+} // namespace Absurdle
+
+void AbsurdleBoard::Reset()
+{
+    for (s32 i = 0; i < answersEnd; i++)
+        candidates[i] = (u16) i;
+
+    candidateCount = answersEnd;
+    guessCount = 0;
+    status = BoardStatus::PLAYING;
+}
+
+Scoring::Feedback AbsurdleBoard::Guess(s32 guessIndex, Absurdle::Partition& partition)
+{
+    AssertWithMessage(status == BoardStatus::PLAYING, "Game is already over!");
+    AssertWithMessage(guessIndex >= 0 && guessIndex < wordListSize, "Guess is not in the word list!");
+
+    Absurdle::PartitionByFeedback(guessIndex, candidates, candidateCount, partition);
+    Scoring::Feedback result = Absurdle::PickBin(partition);
+
+    s32 start = partition.binStart[result];
+    candidateCount = partition.binStart[result + 1] - start;
+    PlatformCopyMemory(candidates, partition.words + start, candidateCount * sizeof(u16));
+
+    guessCount++;
+
+    if (result == Scoring::allCorrectFeedback)
+        status = BoardStatus::WON;
+
+    return result;
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+/*
+
+Absurdle.
+
+An adversarial board that never commits to an answer. Every guess splits
+the answers that are still possible by the feedback they would give, and
+the board keeps the largest bucket, so the player only wins once a
+single word is left and they guess it.
+
+Partitioning is a counting sort into the 243 feedback bins: one pass
+scores and counts, a prefix sum gives each bin its offset, and a second
+pass scatters the candidates into place. The kept bin ends up as one
+contiguous range, still in ascending order. Everything lives in a
+reusable Partition, so a guess never allocates.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace Absurdle
+{
+
+// Scratch for partitioning, big enough for every answer
+struct Partition
+{
+    u16 words[answersEnd];                          // Candidates grouped by feedback
+    Scoring::Feedback feedback[answersEnd];         // Feedback of each candidate, in input order
+    PackedWord packedWords[answersEnd];             // Only used when the feedback matrix isn't loaded
+    s32 binStart[Scoring::feedbackCount + 1];       // Bin f is words[binStart[f]..binStart[f + 1])
+};
+
+// Buckets count answer indices by the feedback wordList[guessIndex] gets against each of them
+void PartitionByFeedback(s32 guessIndex, const u16* candidates, s32 count, Partition& partition);
+
+// The bin the adversary keeps: the largest one, with ties going to the
+// feedback that shows the fewest correct, then placed, letters
+Scoring::Feedback PickBin(const Partition& partition);
+
+} // namespace Absurdle
+
+struct AbsurdleBoard
+{
+    u16 candidates[answersEnd];     // Answer indices still possible, ascending
+    s32 candidateCount;
+
+    s32 guessCount;
+    BoardStatus status;             // Never LOST, there's no guess limit
+
+    // Starts a new game with every answer still possible
+    void Reset();
+
+    // Plays wordList[guessIndex], which has to be a valid word, keeps the largest
+    // bucket and returns the feedback it was given. partition is only used as scratch.
+    Scoring::Feedback Guess(s32 guessIndex, Absurdle::Partition& partition);
+};
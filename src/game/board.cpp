@@ -0,0 +1,42 @@
+#include "board.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "candidates.h"
+#include "feedback_matrix.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+void Board::Reset(s32 answerIndex)
+{
+    AssertWithMessage(answerIndex >= 0 && answerIndex < answersEnd, "Answer has to be one of the answer words!");
+
+    this->answerIndex = answerIndex;
+    guessCount = 0;
+    status = BoardStatus::PLAYING;
+
+    candidates.Reset();
+}
+
+Scoring::Feedback Board::Guess(s32 guessIndex)
+{
+    AssertWithMessage(status == BoardStatus::PLAYING, "Game is already over!");
+    AssertWithMessage(guessIndex >= 0 && guessIndex < wordListSize, "Guess is not in the word list!");
+
+    Scoring::Feedback result = FeedbackMatrix::IsLoaded()
+                             ? FeedbackMatrix::Get(guessIndex, answerIndex)
+                             : Scoring::Score(packedWordList[guessIndex], packedWordList[answerIndex]);
+
+    guesses[guessCount] = guessIndex;
+    feedback[guessCount] = result;
+    guessCount++;
+
+    candidates.Apply(packedWordList[guessIndex], result);
+
+    if (result == Scoring::allCorrectFeedback)
+        status = BoardStatus::WON;
+    else if (guessCount >= maxGuesses)
+        status = BoardStatus::LOST;
+
+    return result;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+/*
+
+Board.
+
+One game of Wordle without any windowing, input or rendering attached.
+The game UI drives one of these, and so can simulators that play
+thousands of games a second.
+
+A board has no pointers and never allocates, so it can be copied or
+reused freely.
+
+*/
+
+#include "core/types.h"
+#include "candidates.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+constexpr s32 maxGuesses = 6;
+
+enum struct BoardStatus
+{
+    PLAYING,
+    WON,
+    LOST
+};
+
+// Rules a game is played with. Values are stored in replay logs, only add to the end.
+enum struct GameMode : u8
+{
+    CLASSIC,
+    ABSURDLE
+};
+
+struct Board
+{
+    s32 guesses[maxGuesses];                // Indices into wordList
+    Scoring::Feedback feedback[maxGuesses];
+    CandidateSet candidates;                // Answers that still fit every guess so far
+
+    s32 answerIndex;
+    s32 guessCount;
+    BoardStatus status;
+
+    // Starts a new game with wordList[answerIndex] as the answer
+    void Reset(s32 answerIndex);
+
+    // Plays wordList[guessIndex], which has to be a valid word, and returns its feedback.
+    // Must only be called while the board is still being played.
+    Scoring::Feedback Guess(s32 guessIndex);
+};
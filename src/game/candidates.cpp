@@ -0,0 +1,124 @@
+#include "candidates.h"
+
+#include "core/types.h"
+#include "math/bits.h"
+#include "platform/platform.h"
+#include "packed_word.h"
+#include "scoring.h"
+#include "word_kernels.h"
+
+namespace CandidateIndex
+{
+
+// No word has more than 3 copies of a letter, but a 5 letter word could
+static constexpr s32 maxLetterCopies = wordLength;
+
+static struct
+{
+    u64 letterAt[wordLength][26][candidateBlockCount];
+    u64 atLeast[26][maxLetterCopies + 1][candidateBlockCount];     // atLeast[l][0] is every answer
+    u64 all[candidateBlockCount];
+    bool built = false;
+} index;
+
+void Build()
+{
+    if (index.built)
+        return;
+
+    BuildPackedWordList();
+
+    for (s32 p = 0; p < wordLength; p++)
+    {
+        for (s32 l = 0; l < 26; l++)
+            WordKernels::MatchLetterAt(packedWordList, answersEnd, p, l, index.letterAt[p][l]);
+    }
+
+    for (s32 a = 0; a < answersEnd; a++)
+    {
+        u8 copies[26] = {};
+        for (s32 p = 0; p < wordLength; p++)
+            copies[GetLetter(packedWordList[a], p)]++;
+
+        u64 bit = 1ull << (a & 63);
+        for (s32 l = 0; l < 26; l++)
+        {
+            for (s32 n = 0; n <= copies[l]; n++)
+                index.atLeast[l][n][a / 64] |= bit;
+        }
+
+        index.all[a / 64] |= bit;
+    }
+
+    index.built = true;
+}
+
+} // namespace CandidateIndex
+
+using namespace CandidateIndex;
+
+static inline void And(u64* bits, const u64* other)
+{
+    for (s32 i = 0; i < candidateBlockCount; i++)
+        bits[i] &= other[i];
+}
+
+static inline void AndNot(u64* bits, const u64* other)
+{
+    for (s32 i = 0; i < candidateBlockCount; i++)
+        bits[i] &= ~other[i];
+}
+
+void CandidateSet::Reset()
+{
+    CandidateIndex::Build();
+
+    PlatformCopyMemory(bits, index.all, sizeof(bits));
+    count = answersEnd;
+}
+
+void CandidateSet::Apply(PackedWord guess, Scoring::Feedback feedback)
+{
+    // Marked (correct or placed) copies of each letter, and whether any copy was wrong
+    u8 marked[26] = {};
+    bool capped[26] = {};
+
+    for (s32 p = 0; p < wordLength; p++, feedback /= 3)
+    {
+        s32 letter = GetLetter(guess, p);
+
+        if (feedback % 3 == 2)
+        {
+            And(bits, index.letterAt[p][letter]);
+            marked[letter]++;
+        }
+        else
+        {
+            // Placed and wrong both mean the letter isn't here
+            AndNot(bits, index.letterAt[p][letter]);
+
+            if (feedback % 3 == 1)
+                marked[letter]++;
+            else
+                capped[letter] = true;
+        }
+    }
+
+    for (s32 l = 0; l < 26; l++)
+    {
+        if (marked[l] == 0 && !capped[l])
+            continue;
+
+        // At least as many copies as were marked...
+        if (marked[l] > 0)
+            And(bits, index.atLeast[l][marked[l]]);
+
+        // ...and exactly that many if one of them came back wrong
+        if (capped[l] && marked[l] < maxLetterCopies)
+            AndNot(bits, index.atLeast[l][marked[l] + 1]);
+    }
+
+    count = 0;
+    for (s32 i = 0; i < candidateBlockCount; i++)
+        count += PopCount(bits[i]);
+}
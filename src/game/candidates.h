@@ -0,0 +1,122 @@
+#pragma once
+
+/*
+
+Candidate Set.
+
+Tracks which answers (wordList[0..answersEnd)) are still possible
+after a number of guesses, as a bitset with one bit per answer.
+
+Every feedback row narrows the set with a handful of AND / AND NOT
+passes against precomputed bitsets:
+
+    - one per (position, letter): answers with that letter at that position
+    - one per (letter, n): answers with at least n copies of that letter
+
+so an update is a few dozen passes over ~37 u64s.
+
+*/
+
+#include "core/types.h"
+#include "math/bits.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+constexpr s32 candidateBlockCount = (answersEnd + 63) / 64;
+
+namespace CandidateIndex
+{
+
+// Builds the shared bitsets. Safe to call more than once.
+void Build();
+
+} // namespace CandidateIndex
+
+struct CandidateSet
+{
+    u64 bits[candidateBlockCount];
+    s32 count;
+
+    // Iterates over the answer indices still in the set, in ascending order
+    class iterator
+    {
+    public:
+        inline s32 operator*() const
+        {
+            return _index;
+        }
+
+        inline iterator& operator++()
+        {
+            advance();
+            return *this;
+        }
+
+        inline bool operator==(const iterator& other) const
+        {
+            return _index == other._index;
+        }
+
+        inline bool operator!=(const iterator& other) const
+        {
+            return _index != other._index;
+        }
+
+        iterator(const CandidateSet* set, s32 index)
+        :   _set(set), _index(index)
+        {
+            if (_index < answersEnd && !_set->Contains(_index))
+                advance();
+        }
+
+    private:
+        inline void advance()
+        {
+            s32 block = (_index + 1) / 64;
+            if (block >= candidateBlockCount)
+            {
+                _index = answersEnd;
+                return;
+            }
+
+            // Mask off everything up to and including the current index
+            u64 remaining = _set->bits[block] & (~0ull << ((_index + 1) & 63));
+
+            while (!remaining)
+            {
+                if (++block >= candidateBlockCount)
+                {
+                    _index = answersEnd;
+                    return;
+                }
+
+                remaining = _set->bits[block];
+            }
+
+            _index = block * 64 + CountTrailingZeros(remaining);
+        }
+
+    private:
+        const CandidateSet* _set;
+        s32 _index;
+    };
+
+    inline iterator begin() const { return iterator(this, 0); }
+    inline iterator end()   const { return iterator(this, answersEnd); }
+
+    // Every answer is possible again
+    void Reset();
+
+    // Removes every answer that wouldn't have given this feedback for the guess
+    void Apply(PackedWord guess, Scoring::Feedback feedback);
+
+    inline s32 Count() const
+    {
+        return count;
+    }
+
+    inline bool Contains(s32 answer) const
+    {
+        return (bits[answer / 64] >> (answer & 63)) & 1;
+    }
+};
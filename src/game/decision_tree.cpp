@@ -0,0 +1,158 @@
+#include "decision_tree.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <cstdio>
+
+namespace DecisionTree
+{
+
+static constexpr char fileMagic[4] = { 'D', 'T', 'R', 'E' };
+static constexpr u64 nodesOffset = 64;
+
+static_assert(sizeof(FileHeader) <= nodesOffset, "Decision tree header doesn't fit before the nodes!");
+static_assert(sizeof(Node) == 8, "Decision tree nodes should be tightly packed!");
+
+static struct
+{
+    PlatformMappedFile file;
+    const FileHeader* header = nullptr;
+    const Node* nodes = nullptr;
+    const Edge* edges = nullptr;
+} tree;
+
+bool Save(const char* filepath, const Node* nodes, u32 nodeCount, const Edge* edges, u32 edgeCount,
+          u32 totalGuesses, u32 maxDepth)
+{
+    AssertWithMessage(nodeCount > 0 && nodeCount <= maxNodeCount, "Decision tree has too many nodes!");
+
+    FILE* file = fopen(filepath, "wb");
+    if (!file)
+        return false;
+
+    u8 header[nodesOffset] = {};
+
+    FileHeader& fileHeader = *(FileHeader*) header;
+    PlatformCopyMemory(fileHeader.magic, fileMagic, sizeof(fileMagic));
+    fileHeader.version = fileVersion;
+    fileHeader.wordListChecksum = GetWordListChecksum();
+    fileHeader.nodeCount = nodeCount;
+    fileHeader.edgeCount = edgeCount;
+    fileHeader.totalGuesses = totalGuesses;
+    fileHeader.maxDepth = maxDepth;
+    fileHeader.nodesOffset = nodesOffset;
+    fileHeader.edgesOffset = nodesOffset + (u64) nodeCount * sizeof(Node);
+
+    bool success = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                   fwrite(nodes, sizeof(Node), nodeCount, file) == nodeCount &&
+                   fwrite(edges, sizeof(Edge), edgeCount, file) == edgeCount;
+
+    fclose(file);
+    return success;
+}
+
+bool Load(const char* filepath)
+{
+    Free();
+
+    PlatformMappedFile file;
+    if (!PlatformMapFile(filepath, file))
+        return false;
+
+    const FileHeader& header = *(const FileHeader*) file.data;
+
+    bool valid = file.size >= sizeof(FileHeader) &&
+                 header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+                 header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+                 header.version == fileVersion &&
+                 header.nodeCount > 0 && header.nodeCount <= maxNodeCount &&
+                 header.nodesOffset + (u64) header.nodeCount * sizeof(Node) <= header.edgesOffset &&
+                 header.edgesOffset + (u64) header.edgeCount * sizeof(Edge) <= file.size &&
+                 header.wordListChecksum == GetWordListChecksum();
+
+    if (!valid)
+    {
+        Warn("Decision tree file is out of date or corrupt, ignoring it.");
+        PlatformUnmapFile(file);
+        return false;
+    }
+
+    tree.file = file;
+    tree.header = &header;
+    tree.nodes = (const Node*) ((const u8*) file.data + header.nodesOffset);
+    tree.edges = (const Edge*) ((const u8*) file.data + header.edgesOffset);
+
+    return true;
+}
+
+void Free()
+{
+    PlatformUnmapFile(tree.file);
+
+    tree.header = nullptr;
+    tree.nodes = nullptr;
+    tree.edges = nullptr;
+}
+
+bool IsLoaded()
+{
+    return tree.header != nullptr;
+}
+
+const FileHeader* GetHeader()
+{
+    return tree.header;
+}
+
+// Index of the child reached with this feedback, or -1 if the tree has no such branch
+static s32 FindChild(const Node& node, Scoring::Feedback feedback)
+{
+    // Edges are sorted by feedback, and there are never more than a couple hundred
+    s32 low = node.firstEdge;
+    s32 high = node.firstEdge + node.edgeCount;
+
+    while (low < high)
+    {
+        s32 mid = (low + high) / 2;
+        Scoring::Feedback midFeedback = GetEdgeFeedback(tree.edges[mid]);
+
+        if (midFeedback == feedback)
+            return GetEdgeChild(tree.edges[mid]);
+
+        if (midFeedback < feedback)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return -1;
+}
+
+s32 GetMove(const Board& board)
+{
+    if (!IsLoaded() || board.status != BoardStatus::PLAYING)
+        return -1;
+
+    u32 nodeIndex = 0;
+    for (s32 i = 0; i < board.guessCount; i++)
+    {
+        const Node& node = tree.nodes[nodeIndex];
+        if (node.guess != board.guesses[i] || node.firstEdge + node.edgeCount > tree.header->edgeCount)
+            return -1;
+
+        s32 child = FindChild(node, board.feedback[i]);
+        if (child < 0 || (u32) child >= tree.header->nodeCount)
+            return -1;
+
+        nodeIndex = child;
+    }
+
+    return tree.nodes[nodeIndex].guess;
+}
+
+} // namespace DecisionTree
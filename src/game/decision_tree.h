@@ -0,0 +1,96 @@
+#pragma once
+
+/*
+
+Decision Tree.
+
+A precomputed solver: the guess to make for every sequence of feedback,
+built offline by tools/build_decision_tree.cpp (see tree_builder.h) and
+memory mapped by the game, so looking up the solver's move is a short
+walk down the tree.
+
+Each node is a guess. Its edges are the feedback that guess can get back
+from the answers still possible at that point, except all correct, which
+ends the game. A node with no edges is a guess that has to be the answer.
+
+File layout (little endian):
+
+    FileHeader
+    padding up to header.nodesOffset
+    nodeCount Nodes (the root is node 0)
+    edgeCount Edges, each node's edges are contiguous and sorted by feedback
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "scoring.h"
+
+namespace DecisionTree
+{
+
+constexpr char defaultPath[] = "assets/decision_tree.bin";
+
+constexpr u32 fileVersion = 1;
+
+struct FileHeader
+{
+    char magic[4];          // "DTRE"
+    u32  version;
+    u64  wordListChecksum;  // GetWordListChecksum() of the list it was built from
+    u32  nodeCount;
+    u32  edgeCount;
+    u32  totalGuesses;      // Guesses needed to solve every answer, summed
+    u32  maxDepth;          // Most guesses any answer needs
+    u64  nodesOffset;
+    u64  edgesOffset;
+};
+
+struct Node
+{
+    u16 guess;              // Index into wordList
+    u8  edgeCount;
+    u8  depth;              // Guesses made before this one
+    u32 firstEdge;
+};
+
+// Feedback in the top 8 bits, child node index in the low 24
+using Edge = u32;
+
+constexpr u32 maxNodeCount = 1u << 24;
+
+inline Edge MakeEdge(Scoring::Feedback feedback, u32 child)
+{
+    return ((u32) feedback << 24) | child;
+}
+
+inline Scoring::Feedback GetEdgeFeedback(Edge edge)
+{
+    return (Scoring::Feedback) (edge >> 24);
+}
+
+inline u32 GetEdgeChild(Edge edge)
+{
+    return edge & (maxNodeCount - 1);
+}
+
+// Writes a tree, nodes[0] has to be the root
+bool Save(const char* filepath, const Node* nodes, u32 nodeCount, const Edge* edges, u32 edgeCount,
+          u32 totalGuesses, u32 maxDepth);
+
+// Maps a file written by Save. Returns false if it's missing, corrupt or was
+// built from a different word list, in which case nothing is loaded.
+bool Load(const char* filepath);
+
+void Free();
+
+bool IsLoaded();
+
+// The solver's next guess for a board, or -1 if the tree isn't loaded or the
+// board left the tree by making a guess the solver wouldn't have
+s32 GetMove(const Board& board);
+
+// Header of the loaded tree, nullptr if nothing is loaded
+const FileHeader* GetHeader();
+
+} // namespace DecisionTree
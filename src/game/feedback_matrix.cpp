@@ -0,0 +1,127 @@
+#include "feedback_matrix.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "core/jobs.h"
+#include "platform/platform.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <cstdio>
+
+namespace FeedbackMatrix
+{
+
+const Scoring::Feedback* matrix = nullptr;
+
+static constexpr char fileMagic[4] = { 'F', 'B', 'M', 'X' };
+static constexpr u64 dataOffset = 64;   // Keeps rows cache line aligned in the mapping
+static constexpr u64 dataSize = (u64) guessCount * rowStride;
+
+static_assert(sizeof(FileHeader) <= dataOffset, "Feedback matrix header doesn't fit before the data!");
+
+static struct
+{
+    PlatformMappedFile file;        // Set when the matrix was loaded from a file
+    Scoring::Feedback* owned = nullptr;     // Set when the matrix was built in memory
+} storage;
+
+static void BuildRows(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    Scoring::Feedback* rows = (Scoring::Feedback*) data;
+
+    for (s32 guess = begin; guess < end; guess++)
+        Scoring::ScoreBatch(packedWordList[guess], packedWordList, answerCount, rows + (u64) guess * rowStride);
+}
+
+void Build()
+{
+    Free();
+    BuildPackedWordList();
+
+    storage.owned = (Scoring::Feedback*) PlatformAllocate(dataSize);
+    AssertWithMessage(storage.owned, "Couldn't allocate feedback matrix!");
+
+    // Row padding is never read, but keep it deterministic for the file
+    PlatformZeroMemory(storage.owned, dataSize);
+
+    Jobs::ParallelFor(guessCount, 64, BuildRows, storage.owned);
+
+    matrix = storage.owned;
+}
+
+bool Save(const char* filepath)
+{
+    AssertWithMessage(matrix, "Feedback matrix was not built!");
+
+    FILE* file = fopen(filepath, "wb");
+    if (!file)
+        return false;
+
+    u8 header[dataOffset] = {};
+
+    FileHeader& fileHeader = *(FileHeader*) header;
+    PlatformCopyMemory(fileHeader.magic, fileMagic, sizeof(fileMagic));
+    fileHeader.version = fileVersion;
+    fileHeader.guessCount = guessCount;
+    fileHeader.answerCount = answerCount;
+    fileHeader.rowStride = rowStride;
+    fileHeader.wordListChecksum = GetWordListChecksum();
+    fileHeader.dataOffset = dataOffset;
+    fileHeader.dataSize = dataSize;
+
+    bool success = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                   fwrite(matrix, 1, dataSize, file) == dataSize;
+
+    fclose(file);
+    return success;
+}
+
+bool Load(const char* filepath)
+{
+    Free();
+
+    PlatformMappedFile file;
+    if (!PlatformMapFile(filepath, file))
+        return false;
+
+    const FileHeader& header = *(const FileHeader*) file.data;
+
+    bool valid = file.size >= sizeof(FileHeader) &&
+                 header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+                 header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+                 header.version == fileVersion &&
+                 header.guessCount == guessCount &&
+                 header.answerCount == answerCount &&
+                 header.rowStride == rowStride &&
+                 header.dataSize == dataSize &&
+                 header.dataOffset + header.dataSize <= file.size &&
+                 header.wordListChecksum == GetWordListChecksum();
+
+    if (!valid)
+    {
+        Warn("Feedback matrix file is out of date or corrupt, ignoring it.");
+        PlatformUnmapFile(file);
+        return false;
+    }
+
+    storage.file = file;
+    matrix = (const Scoring::Feedback*) ((const u8*) file.data + header.dataOffset);
+
+    return true;
+}
+
+void Free()
+{
+    PlatformUnmapFile(storage.file);
+
+    if (storage.owned)
+    {
+        PlatformFree(storage.owned);
+        storage.owned = nullptr;
+    }
+
+    matrix = nullptr;
+}
+
+} // namespace FeedbackMatrix
@@ -0,0 +1,80 @@
+#pragma once
+
+/*
+
+Feedback Matrix.
+
+Feedback for every allowed guess (rows, wordList order) against every
+answer (columns, wordList[0..answersEnd)). Rows are padded to rowStride
+bytes so they can be walked with aligned vector loads.
+
+The matrix is built offline by tools/build_feedback_matrix.cpp and
+memory mapped at startup, so solvers and hints turn into table lookups
+without paying for 30 million scorings on every launch.
+
+File layout (little endian):
+
+    FileHeader
+    padding up to header.dataOffset
+    guessCount rows of rowStride feedback bytes
+
+*/
+
+#include "core/types.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace FeedbackMatrix
+{
+
+constexpr char defaultPath[] = "assets/feedback_matrix.bin";
+
+constexpr u32 fileVersion = 1;
+constexpr s32 guessCount  = wordListSize;
+constexpr s32 answerCount = answersEnd;
+constexpr s32 rowStride   = (answerCount + 63) & ~63;
+
+struct FileHeader
+{
+    char magic[4];          // "FBMX"
+    u32  version;
+    u32  guessCount;
+    u32  answerCount;
+    u32  rowStride;
+    u32  reserved;
+    u64  wordListChecksum;  // GetWordListChecksum() of the list it was built from
+    u64  dataOffset;
+    u64  dataSize;
+};
+
+// Points at the loaded or built matrix, nullptr if neither happened yet
+extern const Scoring::Feedback* matrix;
+
+// Computes the matrix in memory across every worker thread
+void Build();
+
+// Writes the built (or loaded) matrix to a file
+bool Save(const char* filepath);
+
+// Maps a file written by Save. Returns false if it's missing, corrupt or was
+// built from a different word list, in which case nothing is loaded.
+bool Load(const char* filepath);
+
+void Free();
+
+inline bool IsLoaded()
+{
+    return matrix != nullptr;
+}
+
+inline const Scoring::Feedback* GetRow(s32 guess)
+{
+    return matrix + (u64) guess * rowStride;
+}
+
+inline Scoring::Feedback Get(s32 guess, s32 answer)
+{
+    return matrix[(u64) guess * rowStride + answer];
+}
+
+} // namespace FeedbackMatrix
@@ -0,0 +1,40 @@
+#include "game_state.h"
+
+#include "core/types.h"
+#include "math/random.h"
+#include "absurdle.h"
+#include "board.h"
+#include "multi_board.h"
+#include "wordlist.h"
+
+void StartGame(GameMode mode, s32 boardCount, Math::RandomState& random,
+               MultiBoard& boards, Board& board, AbsurdleBoard& absurdle)
+{
+    s32 answers[maxBoards];
+    for (s32 b = 0; b < boardCount; b++)
+    {
+        // Every board needs its own answer, with thousands to pick from this rarely retries
+        bool repeated;
+        do
+        {
+            answers[b] = (s32) Math::RandomBounded(random, answersEnd);
+
+            repeated = false;
+            for (s32 i = 0; i < b; i++)
+                repeated = repeated || answers[i] == answers[b];
+        } while (repeated);
+    }
+
+    if (mode == GameMode::ABSURDLE)
+    {
+        // The board's answer is only a placeholder until the first guess picks a bucket
+        absurdle.Reset();
+        boards.Reset(1, answers, absurdleGuessLimit);
+    }
+    else
+    {
+        boards.Reset(boardCount, answers);
+    }
+
+    board.Reset(answers[0]);
+}
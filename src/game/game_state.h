@@ -0,0 +1,25 @@
+#pragma once
+
+/*
+
+Game State.
+
+Starting a new game, the part of it that doesn't need a window: picking
+the answers and resetting the boards that get played. The game calls
+this from its own ResetGame, which also clears what's on screen, and
+game_bench times it directly, so the benchmark measures what ships.
+
+*/
+
+#include "core/types.h"
+#include "math/random.h"
+#include "absurdle.h"
+#include "board.h"
+#include "multi_board.h"
+
+constexpr s32 absurdleGuessLimit = 8;   // Absurdle has no limit, but the rows have to fit on screen
+
+// Picks a different answer for each of boardCount boards and starts boards and board
+// over with them. Absurdle plays one board, and absurdle starts over with every answer.
+void StartGame(GameMode mode, s32 boardCount, Math::RandomState& random,
+               MultiBoard& boards, Board& board, AbsurdleBoard& absurdle);
@@ -0,0 +1,249 @@
+#include "hints.h"
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "math/common.h"
+#include "platform/platform.h"
+#include "candidates.h"
+#include "feedback_matrix.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace Hints
+{
+
+static constexpr s32 cacheSize = 64;
+
+struct CacheEntry
+{
+    u64 bits[candidateBlockCount];
+    Hint hint;
+    bool used = false;
+};
+
+static struct
+{
+    CacheEntry entries[cacheSize];
+    s32 nextEntry = 0;      // Entries are replaced round robin
+
+    // Candidates for the current GetBestGuess call, shared by every worker
+    Scratch scratch;
+    f32 scores[wordListSize];
+} hints;
+
+// n * log2(n) for every possible bin size
+struct EntropyTable
+{
+    f32 nLog2n[answersEnd + 1];
+
+    EntropyTable()
+    {
+        nLog2n[0] = 0.0f;
+        for (s32 n = 1; n <= answersEnd; n++)
+            nLog2n[n] = n * Math::Log((f32) n) / Math::Log(2.0f);
+    }
+};
+
+static const EntropyTable& GetEntropyTable()
+{
+    // Built on first use, and safe even if that happens on several threads
+    static const EntropyTable table;
+    return table;
+}
+
+struct ScoreJob
+{
+    s32 count;
+    f32 log2Count;
+};
+
+// Gathers the candidates into the scratch arrays, returns how many there are
+static s32 GatherCandidates(const CandidateSet& candidates, Scratch& scratch)
+{
+    s32 count = 0;
+    for (s32 answer : candidates)
+    {
+        scratch.candidates[count] = answer;
+        scratch.candidateWords[count] = packedWordList[answer];
+        count++;
+    }
+
+    return count;
+}
+
+// Expected bits from a guess. histogram has to be all zeros, and is left that way.
+static f32 ScoreGuess(s32 guess, const Scratch& input, const ScoreJob& job,
+                      Scoring::Feedback* feedback, u16* histogram, Scoring::Feedback* usedBins)
+{
+    // Only bins that were hit get summed and cleared, late in the game that's a handful of the 243
+    s32 usedCount = 0;
+
+    if (FeedbackMatrix::IsLoaded())
+    {
+        const Scoring::Feedback* row = FeedbackMatrix::GetRow(guess);
+        for (s32 i = 0; i < job.count; i++)
+        {
+            Scoring::Feedback f = row[input.candidates[i]];
+            if (histogram[f]++ == 0)
+                usedBins[usedCount++] = f;
+        }
+    }
+    else
+    {
+        Scoring::ScoreBatch(packedWordList[guess], input.candidateWords, job.count, feedback);
+        for (s32 i = 0; i < job.count; i++)
+        {
+            Scoring::Feedback f = feedback[i];
+            if (histogram[f]++ == 0)
+                usedBins[usedCount++] = f;
+        }
+    }
+
+    const f32* nLog2n = GetEntropyTable().nLog2n;
+
+    f32 sum = 0.0f;
+    for (s32 i = 0; i < usedCount; i++)
+    {
+        sum += nLog2n[histogram[usedBins[i]]];
+        histogram[usedBins[i]] = 0;
+    }
+
+    return job.log2Count - sum / job.count;
+}
+
+// Expected bits for each guess in [begin, end) over the gathered candidates
+static void ScoreGuesses(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    const ScoreJob& job = *(const ScoreJob*) data;
+
+    u16 histogram[Scoring::feedbackCount] = {};
+    Scoring::Feedback usedBins[Scoring::feedbackCount];
+    Scoring::Feedback feedback[answersEnd];
+
+    for (s32 g = begin; g < end; g++)
+        hints.scores[g] = ScoreGuess(g, hints.scratch, job, feedback, histogram, usedBins);
+}
+
+// Hint for sets too small to be worth scoring, returns false if there are more candidates than that
+static bool GetTrivialHint(const CandidateSet& candidates, Hint& hint)
+{
+    hint.candidateCount = candidates.Count();
+    if (hint.candidateCount > 2)
+        return false;
+
+    // Nothing can beat guessing one of the last two
+    for (s32 answer : candidates)
+    {
+        hint.guessIndex = answer;
+        hint.bits = (hint.candidateCount == 2) ? 1.0f : 0.0f;
+        break;
+    }
+
+    return true;
+}
+
+// Possible answers win ties, since they might end the game right away
+static inline void ConsiderGuess(const CandidateSet& candidates, s32 guess, f32 score,
+                                 Hint& hint, bool& bestIsCandidate)
+{
+    bool isCandidate = guess < answersEnd && candidates.Contains(guess);
+
+    if (score > hint.bits + 1e-5f || (isCandidate && !bestIsCandidate && score > hint.bits - 1e-5f))
+    {
+        bestIsCandidate = isCandidate;
+
+        hint.guessIndex = guess;
+        hint.bits = score;
+    }
+}
+
+static const CacheEntry* FindCached(const CandidateSet& candidates)
+{
+    for (s32 e = 0; e < cacheSize; e++)
+    {
+        const CacheEntry& entry = hints.entries[e];
+        if (!entry.used || entry.hint.candidateCount != candidates.Count())
+            continue;
+
+        bool same = true;
+        for (s32 i = 0; same && i < candidateBlockCount; i++)
+            same = entry.bits[i] == candidates.bits[i];
+
+        if (same)
+            return &entry;
+    }
+
+    return nullptr;
+}
+
+static void AddCached(const CandidateSet& candidates, const Hint& hint)
+{
+    CacheEntry& entry = hints.entries[hints.nextEntry];
+    hints.nextEntry = (hints.nextEntry + 1) % cacheSize;
+
+    PlatformCopyMemory(entry.bits, candidates.bits, sizeof(entry.bits));
+    entry.hint = hint;
+    entry.used = true;
+}
+
+Hint GetBestGuess(const CandidateSet& candidates)
+{
+    if (const CacheEntry* entry = FindCached(candidates))
+        return entry->hint;
+
+    Hint hint;
+    if (GetTrivialHint(candidates, hint))
+    {
+        AddCached(candidates, hint);
+        return hint;
+    }
+
+    ScoreJob job;
+    job.count = GatherCandidates(candidates, hints.scratch);
+    job.log2Count = Math::Log((f32) job.count) / Math::Log(2.0f);
+
+    Jobs::ParallelFor(wordListSize, 256, ScoreGuesses, &job);
+
+    hint.bits = -1.0f;
+    bool bestIsCandidate = false;
+
+    for (s32 g = 0; g < wordListSize; g++)
+        ConsiderGuess(candidates, g, hints.scores[g], hint, bestIsCandidate);
+
+    AddCached(candidates, hint);
+    return hint;
+}
+
+Hint FindBestGuess(const CandidateSet& candidates, Scratch& scratch)
+{
+    Hint hint;
+    if (GetTrivialHint(candidates, hint))
+        return hint;
+
+    ScoreJob job;
+    job.count = GatherCandidates(candidates, scratch);
+    job.log2Count = Math::Log((f32) job.count) / Math::Log(2.0f);
+
+    PlatformZeroMemory(scratch.histogram, sizeof(scratch.histogram));
+
+    hint.bits = -1.0f;
+    bool bestIsCandidate = false;
+
+    for (s32 g = 0; g < wordListSize; g++)
+    {
+        f32 score = ScoreGuess(g, scratch, job, scratch.feedback, scratch.histogram, scratch.usedBins);
+        ConsiderGuess(candidates, g, score, hint, bestIsCandidate);
+    }
+
+    return hint;
+}
+
+void ClearCache()
+{
+    for (s32 e = 0; e < cacheSize; e++)
+        hints.entries[e].used = false;
+
+    hints.nextEntry = 0;
+}
+
+} // namespace Hints
@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+
+Hints.
+
+Ranks every allowed guess by the expected information (in bits) its
+feedback gives about the remaining candidates, and picks the best one.
+Guesses that could still be the answer win ties.
+
+Scoring every guess against every candidate is spread over the worker
+pool, and uses the feedback matrix when it's loaded. Results are
+remembered per candidate set, so asking again in the same state is free.
+
+*/
+
+#include "core/types.h"
+#include "candidates.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace Hints
+{
+
+struct Hint
+{
+    s32 guessIndex = -1;    // Index into wordList, -1 if there are no candidates
+    f32 bits = 0.0f;        // Expected information from the guess
+    s32 candidateCount = 0;
+};
+
+// Working memory for one thread ranking guesses
+struct Scratch
+{
+    s32 candidates[answersEnd];
+    PackedWord candidateWords[answersEnd];
+    Scoring::Feedback feedback[answersEnd];
+    u16 histogram[Scoring::feedbackCount];
+    Scoring::Feedback usedBins[Scoring::feedbackCount];
+};
+
+// Uses the worker pool and the shared cache, call it from one thread at a time
+Hint GetBestGuess(const CandidateSet& candidates);
+
+// Same ranking as GetBestGuess, but only on the calling thread and without the cache.
+// Any number of threads can call it at once as long as each has its own scratch.
+Hint FindBestGuess(const CandidateSet& candidates, Scratch& scratch);
+
+// Forgets every remembered hint
+void ClearCache();
+
+} // namespace Hints
@@ -0,0 +1,106 @@
+#include "multi_board.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "math/bits.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <emmintrin.h>
+
+// Scoring feedback to tile masks, one lookup per board instead of the digit loop
+struct FeedbackMaskTable
+{
+    u8 correct[Scoring::feedbackCount];
+    u8 placed[Scoring::feedbackCount];
+
+    constexpr FeedbackMaskTable() : correct(), placed()
+    {
+        for (s32 f = 0; f < Scoring::feedbackCount; f++)
+        {
+            correct[f] = Scoring::GetCorrectMask((Scoring::Feedback) f);
+            placed[f]  = Scoring::GetPlacedMask((Scoring::Feedback) f);
+        }
+    }
+};
+
+static constexpr FeedbackMaskTable feedbackMasks;
+
+static_assert(maxBoards == 32, "Solved boards are found with two 16 byte compares!");
+
+void MultiBoard::Reset(s32 boardCount, const s32* answerIndices, s32 guessLimit)
+{
+    AssertWithMessage(boardCount >= 1 && boardCount <= maxBoards, "Board count is out of range!");
+    AssertWithMessage(guessLimit >= 0 && guessLimit <= maxMultiGuesses, "Guess limit is out of range!");
+
+    this->boardCount = boardCount;
+    this->guessLimit = (guessLimit > 0) ? guessLimit : boardCount + maxGuesses - 1;
+    guessCount = 0;
+    solvedBits = 0;
+    status = BoardStatus::PLAYING;
+
+    for (s32 b = 0; b < maxBoards; b++)
+    {
+        if (b < boardCount)
+        {
+            AssertWithMessage(answerIndices[b] >= 0 && answerIndices[b] < answersEnd, "Answer has to be one of the answer words!");
+            this->answerIndices[b] = answerIndices[b];
+            answers[b] = packedWordList[answerIndices[b]];
+        }
+        else
+        {
+            this->answerIndices[b] = -1;
+            answers[b] = 0;
+        }
+
+        solvedAt[b] = -1;
+    }
+}
+
+void MultiBoard::SetAnswer(s32 board, s32 answerIndex)
+{
+    AssertWithMessage(board >= 0 && board < boardCount, "Board is out of range!");
+    AssertWithMessage(answerIndex >= 0 && answerIndex < answersEnd, "Answer has to be one of the answer words!");
+
+    answerIndices[board] = answerIndex;
+    answers[board] = packedWordList[answerIndex];
+}
+
+void MultiBoard::Guess(s32 guessIndex)
+{
+    AssertWithMessage(status == BoardStatus::PLAYING, "Game is already over!");
+    AssertWithMessage(guessIndex >= 0 && guessIndex < wordListSize, "Guess is not in the word list!");
+
+    Scoring::Feedback* row = feedback[guessCount];
+
+    // Rounded up to 8 so the batch never takes its scalar tail. The padding
+    // answers are 0, which the vector path scores as garbage without reading anything.
+    Scoring::ScoreBatch(packedWordList[guessIndex], answers, (boardCount + 7) & ~7, row);
+
+    for (s32 b = 0; b < boardCount; b++)
+    {
+        correctMasks[guessCount][b] = feedbackMasks.correct[row[b]];
+        placedMasks[guessCount][b]  = feedbackMasks.placed[row[b]];
+    }
+
+    // Every board this guess got right, in one pass over the row
+    const __m128i allCorrect = _mm_set1_epi8((char) Scoring::allCorrectFeedback);
+    u32 lowBits  = (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*) row), allCorrect));
+    u32 highBits = (u32) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*) (row + 16)), allCorrect));
+
+    u32 boardMask = (boardCount == 32) ? 0xFFFFFFFF : (1u << boardCount) - 1;
+    u32 newlySolved = (lowBits | (highBits << 16)) & boardMask & ~solvedBits;
+
+    for (u32 bits = newlySolved; bits; bits &= bits - 1)
+        solvedAt[CountTrailingZeros(bits)] = (s8) guessCount;
+
+    solvedBits |= newlySolved;
+    guesses[guessCount] = guessIndex;
+    guessCount++;
+
+    if (solvedBits == boardMask)
+        status = BoardStatus::WON;
+    else if (guessCount >= guessLimit)
+        status = BoardStatus::LOST;
+}
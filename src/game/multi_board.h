@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+
+Multi Board.
+
+Several boards played with the same guesses, from Dordle (2 boards) and
+Quordle (4) up to 32. Each board gets its own answer and every guess is
+scored against all of them at once.
+
+State is stored as structure of arrays. Per board data are columns of
+maxBoards entries, and every guess adds a row holding one entry per
+board, so a guess is one ScoreBatch over the answers column followed by
+one compare over the feedback row to find the boards it solved. Nothing
+is stored per board object, and nothing allocates.
+
+Like the usual variants, boardCount boards get boardCount + 5 guesses
+(6 for one board, 9 for Quordle, 37 for 32 boards) unless the game asks
+for a different limit.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+constexpr s32 maxBoards = 32;
+constexpr s32 maxMultiGuesses = maxBoards + maxGuesses - 1;
+
+struct MultiBoard
+{
+    // Columns, one entry per board. Answers past boardCount are 0.
+    alignas(32) PackedWord answers[maxBoards];
+    s32 answerIndices[maxBoards];
+    s8  solvedAt[maxBoards];                                // Guess that solved the board, or -1
+
+    // Rows, one per guess, each holding an entry per board
+    alignas(32) Scoring::Feedback feedback[maxMultiGuesses][maxBoards];
+    u8  correctMasks[maxMultiGuesses][maxBoards];
+    u8  placedMasks[maxMultiGuesses][maxBoards];
+    s32 guesses[maxMultiGuesses];                           // Indices into wordList
+
+    u32 solvedBits;                                         // Bit b is set once board b is solved
+    s32 boardCount;
+    s32 guessLimit;
+    s32 guessCount;
+    BoardStatus status;
+
+    // Starts a new game where board b has wordList[answerIndices[b]] as its answer.
+    // guessLimit is boardCount + 5 if it's 0.
+    void Reset(s32 boardCount, const s32* answerIndices, s32 guessLimit = 0);
+
+    // Swaps a board's answer mid game. Only makes sense if the new answer gives the same
+    // feedback to every guess so far, which is how Absurdle avoids committing to one.
+    void SetAnswer(s32 board, s32 answerIndex);
+
+    // Plays wordList[guessIndex] on every board. Must only be called while the game is still being played.
+    void Guess(s32 guessIndex);
+
+    inline bool IsSolved(s32 board) const
+    {
+        return solvedBits & (1u << board);
+    }
+
+    // Rows the board has filled in: every guess so far, or up to the one that solved it
+    inline s32 GetFilledRows(s32 board) const
+    {
+        return (solvedAt[board] >= 0) ? solvedAt[board] + 1 : guessCount;
+    }
+};
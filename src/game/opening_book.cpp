@@ -0,0 +1,160 @@
+#include "opening_book.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "hints.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <cstdio>
+
+namespace OpeningBook
+{
+
+static constexpr char fileMagic[4] = { 'O', 'B', 'O', 'K' };
+
+static_assert(sizeof(FileHeader) == 32, "Opening book header should be tightly packed!");
+static_assert(sizeof(Entry) == 12, "Opening book entries should be tightly packed!");
+
+static struct
+{
+    PlatformMappedFile file;
+    const FileHeader* header = nullptr;
+    const Entry* entries = nullptr;
+} book;
+
+bool Save(const char* filepath, const Entry* entries, u32 entryCount, u32 openerCount, const Hints::Hint& opening)
+{
+    AssertWithMessage(opening.guessIndex >= 0 && opening.guessIndex < wordListSize, "Opening guess is not in the word list!");
+
+    for (u32 i = 1; i < entryCount; i++)
+        AssertWithMessage(entries[i - 1].key < entries[i].key, "Opening book entries have to be sorted!");
+
+    FILE* file = fopen(filepath, "wb");
+    if (!file)
+        return false;
+
+    FileHeader header = {};
+    PlatformCopyMemory(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.wordListChecksum = GetWordListChecksum();
+    header.entryCount = entryCount;
+    header.openerCount = openerCount;
+    header.openingGuess = (u16) opening.guessIndex;
+    header.openingCandidates = (u16) opening.candidateCount;
+    header.openingBits = opening.bits;
+
+    bool success = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(entries, sizeof(Entry), entryCount, file) == entryCount;
+
+    fclose(file);
+    return success;
+}
+
+bool Load(const char* filepath)
+{
+    Free();
+
+    PlatformMappedFile file;
+    if (!PlatformMapFile(filepath, file))
+        return false;
+
+    const FileHeader& header = *(const FileHeader*) file.data;
+
+    bool valid = file.size >= sizeof(FileHeader) &&
+                 header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+                 header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+                 header.version == fileVersion &&
+                 header.openingGuess < wordListSize &&
+                 sizeof(FileHeader) + (u64) header.entryCount * sizeof(Entry) <= file.size &&
+                 header.wordListChecksum == GetWordListChecksum();
+
+    if (!valid)
+    {
+        Warn("Opening book file is out of date or corrupt, ignoring it.");
+        PlatformUnmapFile(file);
+        return false;
+    }
+
+    book.file = file;
+    book.header = &header;
+    book.entries = (const Entry*) ((const u8*) file.data + sizeof(FileHeader));
+
+    return true;
+}
+
+void Free()
+{
+    PlatformUnmapFile(book.file);
+
+    book.header = nullptr;
+    book.entries = nullptr;
+}
+
+bool IsLoaded()
+{
+    return book.header != nullptr;
+}
+
+const FileHeader* GetHeader()
+{
+    return book.header;
+}
+
+s32 GetOpeningGuess()
+{
+    return IsLoaded() ? book.header->openingGuess : -1;
+}
+
+// Entry with this key, or nullptr if the book doesn't have it
+static const Entry* FindEntry(u32 key)
+{
+    s32 low = 0;
+    s32 high = (s32) book.header->entryCount;
+
+    while (low < high)
+    {
+        s32 mid = (low + high) / 2;
+        u32 midKey = book.entries[mid].key;
+
+        if (midKey == key)
+            return &book.entries[mid];
+
+        if (midKey < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return nullptr;
+}
+
+bool GetHint(const Board& board, Hints::Hint& hint)
+{
+    if (!IsLoaded() || board.status != BoardStatus::PLAYING)
+        return false;
+
+    if (board.guessCount == 0)
+    {
+        hint.guessIndex = book.header->openingGuess;
+        hint.bits = book.header->openingBits;
+        hint.candidateCount = book.header->openingCandidates;
+        return true;
+    }
+
+    if (board.guessCount != 1)
+        return false;
+
+    const Entry* entry = FindEntry(MakeKey(board.guesses[0], board.feedback[0]));
+    if (!entry || entry->guess >= wordListSize)
+        return false;
+
+    hint.guessIndex = entry->guess;
+    hint.bits = entry->bits;
+    hint.candidateCount = entry->candidateCount;
+    return true;
+}
+
+} // namespace OpeningBook
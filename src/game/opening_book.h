@@ -0,0 +1,86 @@
+#pragma once
+
+/*
+
+Opening Book.
+
+The entropy hint for the first two guesses, precomputed by
+tools/build_opening_book.cpp so nothing has to be searched at the start
+of a game. Those are the most expensive hints to work out, since the
+candidate sets are at their largest.
+
+The book holds the best opening guess, and for each of a handful of
+openers the best follow up for every feedback that opener can get. The
+follow ups are a table of entries sorted by (first guess, feedback), so
+a lookup is a binary search over a memory mapped file.
+
+Entries only exist for feedback that leaves more than 2 candidates,
+smaller sets are already trivial for Hints.
+
+File layout (little endian):
+
+    FileHeader
+    entryCount Entries, sorted by key
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "hints.h"
+#include "scoring.h"
+
+namespace OpeningBook
+{
+
+constexpr char defaultPath[] = "assets/opening_book.bin";
+
+constexpr u32 fileVersion = 1;
+
+struct FileHeader
+{
+    char magic[4];              // "OBOK"
+    u32  version;
+    u64  wordListChecksum;      // GetWordListChecksum() of the list it was built from
+    u32  entryCount;
+    u32  openerCount;           // First guesses that have follow ups
+    u16  openingGuess;          // Best first guess
+    u16  openingCandidates;
+    f32  openingBits;
+};
+
+struct Entry
+{
+    u32 key;                    // MakeKey(first guess, feedback)
+    u16 guess;                  // Best second guess, index into wordList
+    u16 candidateCount;         // Candidates left after the first guess
+    f32 bits;                   // Expected information from the second guess
+};
+
+inline constexpr u32 MakeKey(s32 firstGuess, Scoring::Feedback feedback)
+{
+    return ((u32) firstGuess << 8) | feedback;
+}
+
+// entries have to be sorted by key
+bool Save(const char* filepath, const Entry* entries, u32 entryCount, u32 openerCount, const Hints::Hint& opening);
+
+// Maps a file written by Save. Returns false if it's missing, corrupt or was
+// built from a different word list, in which case nothing is loaded.
+bool Load(const char* filepath);
+
+void Free();
+
+bool IsLoaded();
+
+// Best first guess, -1 if no book is loaded
+s32 GetOpeningGuess();
+
+// The entropy hint for a board that has made at most one guess. Returns false
+// if the book isn't loaded, the board is further along or the book doesn't
+// cover its first guess, in which case the hint has to be searched for.
+bool GetHint(const Board& board, Hints::Hint& hint);
+
+// Header of the loaded book, nullptr if nothing is loaded
+const FileHeader* GetHeader();
+
+} // namespace OpeningBook
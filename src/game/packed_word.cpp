@@ -0,0 +1,47 @@
+#include "packed_word.h"
+
+#include "core/types.h"
+#include "word_kernels.h"
+#include "wordlist.h"
+
+alignas(32) PackedWord packedWordList[packedWordListSize];
+alignas(32) u32 wordLetterMasks[packedWordListSize];
+
+void BuildPackedWordList()
+{
+    static bool built = false;
+    if (built)
+        return;
+
+    BuildWordList();
+
+    // Padding stays 0 from static initialization
+    for (s32 i = 0; i < wordListSize; i++)
+        packedWordList[i] = PackWord(wordList[i]);
+
+    WordKernels::BuildLetterMasks(packedWordList, packedWordListSize, wordLetterMasks);
+
+    built = true;
+}
+
+u64 GetWordListChecksum()
+{
+    BuildPackedWordList();
+
+    u64 hash = 0xCBF29CE484222325;
+    auto mix = [&](u32 value) {
+        for (int i = 0; i < 4; i++)
+        {
+            hash ^= (value >> (8 * i)) & 0xFF;
+            hash *= 0x100000001B3;
+        }
+    };
+
+    for (s32 i = 0; i < wordListSize; i++)
+        mix(packedWordList[i]);
+
+    mix((u32) wordListSize);
+    mix((u32) answersEnd);
+
+    return hash;
+}
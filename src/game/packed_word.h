@@ -0,0 +1,88 @@
+#pragma once
+
+/*
+
+Packed Words.
+
+A 5 letter word fits in 25 bits, 5 bits per letter, with the
+first letter in the lowest bits. Letters are stored as
+(ch - 'A' + 1) so a packed word is never 0, which lets 0 be
+used for empty slots and padding.
+
+packedWordList mirrors wordList in the same order, padded with
+zeroes to a multiple of 8 so SIMD kernels never need a tail loop
+when they walk the whole list.
+
+*/
+
+#include "core/types.h"
+#include "wordlist.h"
+
+using PackedWord = u32;
+
+constexpr s32 wordLength = 5;
+constexpr u32 letterBits = 5;
+constexpr u32 letterFieldMask = 0x1F;
+
+constexpr s32 packedWordListSize = (wordListSize + 7) & ~7;
+
+inline constexpr PackedWord PackWord(const char* word)
+{
+    PackedWord packed = 0;
+    for (int i = 0; i < wordLength; i++)
+        packed |= (u32)(word[i] - 'A' + 1) << (letterBits * i);
+
+    return packed;
+}
+
+inline void UnpackWord(PackedWord word, char* output)
+{
+    for (int i = 0; i < wordLength; i++)
+        output[i] = (char)(((word >> (letterBits * i)) & letterFieldMask) - 1 + 'A');
+}
+
+// Returns the letter at the position as 0..25
+inline constexpr s32 GetLetter(PackedWord word, s32 position)
+{
+    return (s32)((word >> (letterBits * position)) & letterFieldMask) - 1;
+}
+
+// One bit per letter (bit 0 is 'A') for every letter present in the word
+inline constexpr u32 GetLetterMask(PackedWord word)
+{
+    u32 mask = 0;
+    for (int i = 0; i < wordLength; i++)
+        mask |= 1u << GetLetter(word, i);
+
+    return mask;
+}
+
+// Bit i is set if the words have the same letter at position i
+inline constexpr u32 GetMatchingPositions(PackedWord a, PackedWord b)
+{
+    u32 diff = a ^ b;
+
+    // Fold every field onto its lowest bit, which ends up set if the letters differ
+    diff |= diff >> 1;
+    diff |= diff >> 2;
+    diff |= diff >> 1;
+
+    u32 differs = ((diff >>  0) & 0x01) |
+                  ((diff >>  4) & 0x02) |
+                  ((diff >>  8) & 0x04) |
+                  ((diff >> 12) & 0x08) |
+                  ((diff >> 16) & 0x10);
+
+    return ~differs & 0x1F;
+}
+
+// Filled by BuildPackedWordList(), both are 32 byte aligned
+extern PackedWord packedWordList[packedWordListSize];
+extern u32 wordLetterMasks[packedWordListSize];
+
+// Packs wordList and computes letter masks. Safe to call more than once.
+void BuildPackedWordList();
+
+// FNV-1a over the packed words and answersEnd. Files generated from the
+// word list store this so they can tell when they're out of date.
+u64 GetWordListChecksum();
@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+
+Puzzle Protocol.
+
+Wire format between tools/puzzle_server.cpp and its clients. Every
+message in either direction is one fixed size 16 byte struct, and the
+server answers every request with exactly one reply, in the order the
+requests came in on that connection. Clients can send as many requests
+as they like without waiting, tags tell the replies apart.
+
+    NEW_GAME    starts a session with a random answer, the reply has its id
+    GUESS       plays word in a session, the reply has the feedback. Once the
+                game is over the reply reveals the answer and the session ends.
+    END         gives up on a session
+
+Sessions belong to the connection that started them, other connections
+get UNKNOWN_SESSION for them, and they end when it closes.
+
+Everything is little endian, the server only runs on Linux.
+
+*/
+
+#include "core/types.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+namespace PuzzleProtocol
+{
+
+constexpr char defaultSocketPath[] = "/tmp/bhordle.sock";
+constexpr u16 defaultPort = 7305;
+
+enum struct RequestType : u8
+{
+    NEW_GAME,
+    GUESS,
+    END
+};
+
+enum struct ReplyStatus : u8
+{
+    OK,
+    INVALID_WORD,       // Not in the word list, the guess doesn't count
+    UNKNOWN_SESSION,    // Never existed, already over, ended, or started by another connection
+    SERVER_FULL,        // No room for another session
+    BAD_REQUEST
+};
+
+struct Request
+{
+    RequestType type;
+    u8   reserved0[3];
+    u32  sessionId;
+    u32  tag;           // Sent back untouched in the reply
+    PackedWord word;    // PackWord() of the guess, upper case
+};
+
+struct Reply
+{
+    ReplyStatus status;
+    Scoring::Feedback feedback;
+    u8   guessCount;
+    u8   boardStatus;   // BoardStatus
+    u32  sessionId;
+    u32  tag;
+    u16  answerIndex;   // Index into wordList once the game is over, 0xFFFF until then
+    u16  candidateCount;
+};
+
+static_assert(sizeof(Request) == 16, "Requests have to be 16 bytes!");
+static_assert(sizeof(Reply) == 16, "Replies have to be 16 bytes!");
+
+} // namespace PuzzleProtocol
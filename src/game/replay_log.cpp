@@ -0,0 +1,437 @@
+#include "replay_log.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+#include "packed_word.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+namespace ReplayLog
+{
+
+static constexpr char fileMagic[4] = { 'R', 'P', 'L', 'Y' };
+static constexpr char indexMagic[4] = { 'R', 'I', 'D', 'X' };
+
+static constexpr s32 queueSize = 256;              // Records, has to be a power of 2
+static constexpr s32 slotsPerGroup = recordsPerIndex + 1;
+
+static_assert((queueSize & (queueSize - 1)) == 0, "Queue size has to be a power of 2!");
+
+// Index block for the group being written, filled in as records go out
+struct GroupState
+{
+    u32 groupIndex;
+    s32 recordCount;
+    u32 firstStartTime;
+    u32 lastStartTime;
+    u32 wonCount;
+    u64 checksum;
+};
+
+static struct
+{
+    FILE* file = nullptr;
+    std::thread writer;
+
+    // Single producer (the game thread), single consumer (the writer)
+    Record queue[queueSize];
+    std::atomic<u64> head { 0 };        // Next slot to append to
+    std::atomic<u64> tail { 0 };        // Next slot to write out
+    std::atomic<u64> dropped { 0 };
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::atomic<bool> quit { false };
+
+    GroupState group;
+    u64 recordCount = 0;
+} replays;
+
+u32 GetTimestamp()
+{
+    return (u32) std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static inline u64 ChecksumBytes(u64 hash, const void* data, u64 size)
+{
+    const u8* bytes = (const u8*) data;
+    for (u64 i = 0; i < size; i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+
+    return hash;
+}
+
+static constexpr u64 checksumSeed = 0xCBF29CE484222325ull;
+
+static void ResetGroup(GroupState& group, u32 groupIndex)
+{
+    group.groupIndex = groupIndex;
+    group.recordCount = 0;
+    group.firstStartTime = 0xFFFFFFFF;
+    group.lastStartTime = 0;
+    group.wonCount = 0;
+    group.checksum = checksumSeed;
+}
+
+static void AddToGroup(GroupState& group, const Record& record)
+{
+    group.recordCount++;
+    group.firstStartTime = (record.startTime < group.firstStartTime) ? record.startTime : group.firstStartTime;
+    group.lastStartTime = (record.startTime > group.lastStartTime) ? record.startTime : group.lastStartTime;
+    group.wonCount += record.outcome == Outcome::WON;
+    group.checksum = ChecksumBytes(group.checksum, &record, sizeof(Record));
+}
+
+static void FillIndex(const GroupState& group, IndexBlock& index)
+{
+    PlatformZeroMemory(&index, sizeof(index));
+    PlatformCopyMemory(index.magic, indexMagic, sizeof(indexMagic));
+    index.groupIndex = group.groupIndex;
+    index.firstRecord = (u64) group.groupIndex * recordsPerIndex;
+    index.firstStartTime = group.firstStartTime;
+    index.lastStartTime = group.lastStartTime;
+    index.wonCount = group.wonCount;
+    index.checksum = group.checksum;
+}
+
+// Writes a record, and the group's index block after the last one. Only the writer thread calls this.
+static bool WriteRecord(const Record& record)
+{
+    if (fwrite(&record, sizeof(Record), 1, replays.file) != 1)
+        return false;
+
+    AddToGroup(replays.group, record);
+    replays.recordCount++;
+
+    if (replays.group.recordCount == recordsPerIndex)
+    {
+        IndexBlock index;
+        FillIndex(replays.group, index);
+
+        if (fwrite(&index, sizeof(IndexBlock), 1, replays.file) != 1)
+            return false;
+
+        ResetGroup(replays.group, replays.group.groupIndex + 1);
+    }
+
+    return true;
+}
+
+static void WriterLoop()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(replays.mutex);
+
+            // The timeout covers a wake up that's missed because Append doesn't take the lock
+            replays.wake.wait_for(lock, std::chrono::milliseconds(100), [] {
+                return replays.quit.load() || replays.tail.load() != replays.head.load(std::memory_order_acquire);
+            });
+        }
+
+        u64 tail = replays.tail.load();
+        u64 head = replays.head.load(std::memory_order_acquire);
+
+        bool wrote = tail != head;
+        for (; tail != head; tail++)
+        {
+            WarnIf(!WriteRecord(replays.queue[tail & (queueSize - 1)]), "Failed to write to the replay log!");
+        }
+
+        replays.tail.store(tail, std::memory_order_release);
+
+        // One flush per batch keeps the file close to current without a syscall per record
+        if (wrote)
+            fflush(replays.file);
+
+        if (replays.quit.load() && replays.tail.load() == replays.head.load(std::memory_order_acquire))
+            break;
+    }
+}
+
+static bool IsValidHeader(const FileHeader& header)
+{
+    return header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+           header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+           header.version == fileVersion &&
+           header.slotSize == slotSize &&
+           header.recordsPerIndex == recordsPerIndex;
+}
+
+// Finds where the last writer stopped, rebuilds the state of its group and seeks there
+static bool ResumeFile(FILE* file)
+{
+    FileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || !IsValidHeader(header))
+    {
+        Warn("Replay log has an unknown format, not logging games.");
+        return false;
+    }
+
+    if (header.wordListChecksum != GetWordListChecksum())
+    {
+        Warn("Replay log was written for a different word list, not logging games.");
+        return false;
+    }
+
+    PlatformSeekFile(file, 0, SEEK_END);
+    u64 slotCount = (u64) PlatformTellFile(file) / slotSize - 1;      // A torn slot at the end doesn't count
+
+    u64 groups = slotCount / slotsPerGroup;
+    s32 leftover = (s32) (slotCount % slotsPerGroup);
+
+    // Slots past the last index are records of the group that was being written
+    ResetGroup(replays.group, (u32) groups);
+    replays.recordCount = groups * recordsPerIndex;
+
+    PlatformSeekFile(file, (s64) ((1 + groups * slotsPerGroup) * slotSize), SEEK_SET);
+    for (s32 i = 0; i < leftover; i++)
+    {
+        Record record;
+        if (fread(&record, sizeof(record), 1, file) != 1)
+            return false;
+
+        AddToGroup(replays.group, record);
+        replays.recordCount++;
+    }
+
+    // Switching between reading and writing needs a seek in between
+    PlatformSeekFile(file, (s64) ((1 + groups * slotsPerGroup + leftover) * slotSize), SEEK_SET);
+
+    // The last writer stopped between a group's last record and its index
+    if (replays.group.recordCount == recordsPerIndex)
+    {
+        IndexBlock index;
+        FillIndex(replays.group, index);
+
+        if (fwrite(&index, sizeof(index), 1, file) != 1)
+            return false;
+
+        ResetGroup(replays.group, replays.group.groupIndex + 1);
+    }
+
+    return true;
+}
+
+// Writes the header of an empty log at the start of the file
+static bool StartFile(FILE* file)
+{
+    FileHeader header;
+    PlatformZeroMemory(&header, sizeof(header));
+    PlatformCopyMemory(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.slotSize = slotSize;
+    header.recordsPerIndex = recordsPerIndex;
+    header.wordListChecksum = GetWordListChecksum();
+    header.createdTime = GetTimestamp();
+
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+        return false;
+
+    ResetGroup(replays.group, 0);
+    replays.recordCount = 0;
+
+    return true;
+}
+
+bool Open(const char* filepath)
+{
+    AssertWithMessage(!replays.file, "Replay log is already open!");
+
+    FILE* file = fopen(filepath, "r+b");
+    bool fresh = !file;
+
+    if (!file)
+        file = fopen(filepath, "w+b");
+
+    if (!file)
+        return false;
+
+    // Buffers are big enough for a whole queue, so a batch goes out in one write
+    setvbuf(file, nullptr, _IOFBF, queueSize * sizeof(Record));
+
+    // A crash between creating the file and writing its header leaves it without a whole one, start it over
+    if (!fresh)
+    {
+        PlatformSeekFile(file, 0, SEEK_END);
+        fresh = PlatformTellFile(file) < (s64) sizeof(FileHeader);
+        PlatformSeekFile(file, 0, SEEK_SET);
+    }
+
+    if (!(fresh ? StartFile(file) : ResumeFile(file)))
+    {
+        fclose(file);
+        return false;
+    }
+
+    replays.file = file;
+    replays.head = 0;
+    replays.tail = 0;
+    replays.quit = false;
+    replays.writer = std::thread(WriterLoop);
+
+    return true;
+}
+
+void Close()
+{
+    if (!replays.file)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(replays.mutex);
+        replays.quit = true;
+    }
+
+    replays.wake.notify_one();
+    replays.writer.join();
+
+    fclose(replays.file);
+    replays.file = nullptr;
+}
+
+bool IsOpen()
+{
+    return replays.file != nullptr;
+}
+
+bool Append(const Record& record)
+{
+    if (!replays.file)
+        return false;
+
+    u64 head = replays.head.load(std::memory_order_relaxed);
+    if (head - replays.tail.load(std::memory_order_acquire) >= queueSize)
+    {
+        replays.dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    replays.queue[head & (queueSize - 1)] = record;
+    replays.head.store(head + 1, std::memory_order_release);
+
+    replays.wake.notify_one();
+    return true;
+}
+
+u64 GetDroppedCount()
+{
+    return replays.dropped.load();
+}
+
+bool OpenReader(const char* filepath, Reader& reader)
+{
+    CloseReader(reader);
+
+    PlatformMappedFile file;
+    if (!PlatformMapFile(filepath, file))
+        return false;
+
+    const FileHeader& header = *(const FileHeader*) file.data;
+    if (file.size < sizeof(FileHeader) || !IsValidHeader(header))
+    {
+        Warn("Not a replay log, ignoring it.");
+        PlatformUnmapFile(file);
+        return false;
+    }
+
+    u64 slotCount = file.size / slotSize - 1;
+    u64 groups = slotCount / slotsPerGroup;
+    s32 leftover = (s32) (slotCount % slotsPerGroup);
+
+    reader.file = file;
+    reader.header = &header;
+    reader.recordCount = (s64) (groups * recordsPerIndex) + ((leftover < recordsPerIndex) ? leftover : recordsPerIndex);
+    reader.groupCount = (s64) groups + (leftover > 0);
+
+    return true;
+}
+
+void CloseReader(Reader& reader)
+{
+    PlatformUnmapFile(reader.file);
+    reader = Reader();
+}
+
+static inline const u8* GetSlot(const Reader& reader, u64 slot)
+{
+    return (const u8*) reader.file.data + (1 + slot) * slotSize;
+}
+
+const Record* GetGroup(const Reader& reader, s64 group, s32& count)
+{
+    AssertWithMessage(group >= 0 && group < reader.groupCount, "Group is out of range!");
+
+    s64 first = group * recordsPerIndex;
+    s64 left = reader.recordCount - first;
+    count = (s32) ((left < recordsPerIndex) ? left : recordsPerIndex);
+
+    return (const Record*) GetSlot(reader, (u64) group * slotsPerGroup);
+}
+
+const IndexBlock* GetIndex(const Reader& reader, s64 group)
+{
+    AssertWithMessage(group >= 0 && group < reader.groupCount, "Group is out of range!");
+
+    u64 slot = (u64) group * slotsPerGroup + recordsPerIndex;
+    if ((1 + slot + 1) * slotSize > reader.file.size)
+        return nullptr;
+
+    const IndexBlock* index = (const IndexBlock*) GetSlot(reader, slot);
+    bool valid = index->magic[0] == indexMagic[0] && index->magic[1] == indexMagic[1] &&
+                 index->magic[2] == indexMagic[2] && index->magic[3] == indexMagic[3];
+
+    return valid ? index : nullptr;
+}
+
+const Record& GetRecord(const Reader& reader, s64 index)
+{
+    AssertWithMessage(index >= 0 && index < reader.recordCount, "Record is out of range!");
+
+    s64 group = index / recordsPerIndex;
+    s64 offset = index % recordsPerIndex;
+
+    return *(const Record*) GetSlot(reader, (u64) (group * slotsPerGroup + offset));
+}
+
+bool VerifyGroup(const Reader& reader, s64 group)
+{
+    const IndexBlock* index = GetIndex(reader, group);
+    if (!index)
+        return true;
+
+    s32 count;
+    const Record* records = GetGroup(reader, group, count);
+
+    return ChecksumBytes(checksumSeed, records, (u64) count * sizeof(Record)) == index->checksum;
+}
+
+s64 FindGroup(const Reader& reader, u32 time)
+{
+    // Games are appended as they finish, so groups are ordered by time. The last
+    // group may not have an index yet, and is where the search ends up otherwise.
+    s64 low = 0;
+    s64 high = reader.groupCount;
+
+    while (low < high)
+    {
+        s64 mid = (low + high) / 2;
+
+        const IndexBlock* index = GetIndex(reader, mid);
+        if (index && index->lastStartTime < time)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return low;
+}
+
+} // namespace ReplayLog
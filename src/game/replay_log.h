@@ -0,0 +1,152 @@
+#pragma once
+
+/*
+
+Replay Log.
+
+Every finished (or abandoned) game is appended to a binary log, one
+fixed size record per board, so analytics can replay what players did
+without the game having to keep anything around.
+
+Appending never touches the file on the calling thread. Records go into
+a fixed ring buffer that a writer thread drains with buffered writes, so
+the game loop only ever pays for a copy. If the writer falls behind far
+enough for the ring to fill up, records are dropped and counted rather
+than stalling a frame.
+
+Reading maps the whole file, so scanning is a walk over an array of
+records. Every recordsPerIndex records are followed by an index block
+with their time range, win count and checksum, which lets readers skip
+groups by time and tell intact groups from damaged ones.
+
+File layout (little endian), everything in slotSize byte slots:
+
+    FileHeader
+    recordsPerIndex Records, IndexBlock
+    recordsPerIndex Records, IndexBlock
+    ...
+    up to recordsPerIndex - 1 Records that don't have an index yet
+
+A torn write at the end only ever loses the partial slot, which the
+next writer overwrites.
+
+*/
+
+#include "core/types.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "multi_board.h"
+
+namespace ReplayLog
+{
+
+constexpr char defaultPath[] = "replays.bin";
+
+constexpr u32 fileVersion = 1;
+constexpr s32 slotSize = 128;
+constexpr s32 recordsPerIndex = 1023;           // So a group with its index is 1024 slots
+constexpr s32 maxRecordGuesses = maxMultiGuesses;
+
+enum struct Outcome : u8
+{
+    WON,
+    LOST,
+    ABANDONED       // Reset before the game was over
+};
+
+struct FileHeader
+{
+    char magic[4];                  // "RPLY"
+    u32  version;
+    u32  slotSize;
+    u32  recordsPerIndex;
+    u64  wordListChecksum;          // GetWordListChecksum() of the list the indices refer to
+    u64  createdTime;               // Seconds since the Unix epoch
+    u8   reserved[ReplayLog::slotSize - 32];
+};
+
+// One board of one game. Boards of a multi board game are consecutive, boardIndex 0 first.
+struct Record
+{
+    u32 startTime;                  // Seconds since the Unix epoch
+    u32 duration;                   // Milliseconds from the start to the last guess
+    u16 answerIndex;                // Index into wordList (for Absurdle, the last word left)
+    u8  guessCount;                 // Rows this board filled in
+    u8  boardIndex;
+    u8  boardCount;
+    GameMode mode;
+    Outcome outcome;
+    u8  reserved0;
+    u16 guesses[maxRecordGuesses];  // Indices into wordList
+    Scoring::Feedback feedback[maxRecordGuesses];
+    u8  reserved1;
+};
+
+struct IndexBlock
+{
+    char magic[4];                  // "RIDX"
+    u32  groupIndex;
+    u64  firstRecord;               // Index of the first record in the group
+    u32  firstStartTime;            // Earliest and latest startTime in the group
+    u32  lastStartTime;
+    u32  wonCount;
+    u32  reserved0;
+    u64  checksum;                  // FNV-1a over the group's records
+    u8   reserved1[slotSize - 40];
+};
+
+static_assert(sizeof(FileHeader) == slotSize, "File header has to fill one slot!");
+static_assert(sizeof(Record) == slotSize, "Records have to fill one slot!");
+static_assert(sizeof(IndexBlock) == slotSize, "Index blocks have to fill one slot!");
+
+// Seconds since the Unix epoch
+u32 GetTimestamp();
+
+// Writing
+
+// Opens (or creates) the log and starts the writer thread. Returns false, and
+// logs nothing, if the file can't be opened or was written for another word list.
+bool Open(const char* filepath);
+
+// Writes out everything that was appended and stops the writer thread
+void Close();
+
+bool IsOpen();
+
+// Queues a record without blocking. Returns false if the log isn't open or the
+// queue is full, in which case the record is dropped.
+bool Append(const Record& record);
+
+// Records dropped because the queue was full
+u64 GetDroppedCount();
+
+// Reading
+
+struct Reader
+{
+    PlatformMappedFile file;
+    const FileHeader* header = nullptr;
+
+    s64 recordCount = 0;
+    s64 groupCount = 0;             // Including the last one, even if it isn't complete
+};
+
+// Maps a log for reading. Returns false if it's missing or isn't a replay log.
+bool OpenReader(const char* filepath, Reader& reader);
+void CloseReader(Reader& reader);
+
+// Records of a group, which are contiguous in the file
+const Record* GetGroup(const Reader& reader, s64 group, s32& count);
+
+// The group's index block, or nullptr if the group isn't complete yet
+const IndexBlock* GetIndex(const Reader& reader, s64 group);
+
+const Record& GetRecord(const Reader& reader, s64 index);
+
+// True if the group's records still match the checksum in its index (groups without one always pass)
+bool VerifyGroup(const Reader& reader, s64 group);
+
+// First group that could hold records started at or after time, using the indices
+s64 FindGroup(const Reader& reader, u32 time);
+
+} // namespace ReplayLog
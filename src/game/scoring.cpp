@@ -0,0 +1,100 @@
+#include "scoring.h"
+
+#include "core/types.h"
+#include "packed_word.h"
+#include "simd_internal.h"
+
+namespace Scoring
+{
+
+Feedback Score(PackedWord guess, PackedWord answer)
+{
+    u32 correctMask = GetMatchingPositions(guess, answer);
+
+    // Count the answer letters that weren't matched exactly
+    u8 lettersLeft[26] = {};
+    for (int i = 0; i < wordLength; i++)
+    {
+        if (!(correctMask & (1 << i)))
+            lettersLeft[GetLetter(answer, i)]++;
+    }
+
+    Feedback feedback = 0;
+    for (int i = 0; i < wordLength; i++)
+    {
+        if (correctMask & (1 << i))
+        {
+            feedback += 2 * feedbackPowers[i];
+            continue;
+        }
+
+        s32 letter = GetLetter(guess, i);
+        if (lettersLeft[letter] > 0)
+        {
+            lettersLeft[letter]--;
+            feedback += feedbackPowers[i];
+        }
+    }
+
+    return feedback;
+}
+
+void ScoreBatch(PackedWord guess, const PackedWord* answers, s32 count, Feedback* outFeedback)
+{
+    using namespace Simd;
+
+    // The guess is the same for every lane, so everything that only depends
+    // on the guess (its letters, which positions repeat a letter) stays scalar.
+    u32 guessLetters[wordLength];
+    for (int i = 0; i < wordLength; i++)
+        guessLetters[i] = (guess >> (letterBits * i)) & letterFieldMask;
+
+    const Vec fieldMask = Set1(letterFieldMask);
+
+    s32 a = 0;
+    for (; a + laneCount <= count; a += laneCount)
+    {
+        Vec packed = Load(answers + a);
+
+        Vec answerLetters[wordLength];
+        Vec correct[wordLength];        // All bits set where the position is correct
+
+        for (int i = 0; i < wordLength; i++)
+        {
+            answerLetters[i] = And(ShiftRight(packed, letterBits * i), fieldMask);
+            correct[i] = CmpEq(answerLetters[i], Set1(guessLetters[i]));
+        }
+
+        Vec feedback = Zero();
+
+        for (int i = 0; i < wordLength; i++)
+        {
+            feedback = Add(feedback, And(correct[i], Set1(2 * feedbackPowers[i])));
+
+            // Copies of this letter in the answer that aren't matched exactly.
+            // Compare masks are -1, so subtracting them counts up.
+            Vec letter = Set1(guessLetters[i]);
+            Vec available = Zero();
+            for (int j = 0; j < wordLength; j++)
+                available = Sub(available, AndNot(correct[j], CmpEq(answerLetters[j], letter)));
+
+            // Copies already handed out to earlier, non correct positions
+            Vec used = Zero();
+            for (int k = 0; k < i; k++)
+            {
+                if (guessLetters[k] == guessLetters[i])
+                    used = Sub(used, AndNot(correct[k], Set1(0xFFFFFFFF)));
+            }
+
+            Vec placed = AndNot(correct[i], CmpGt(available, used));
+            feedback = Add(feedback, And(placed, Set1(feedbackPowers[i])));
+        }
+
+        StoreBytes(outFeedback + a, feedback);
+    }
+
+    for (; a < count; a++)
+        outFeedback[a] = Score(guess, answers[a]);
+}
+
+} // namespace Scoring
@@ -0,0 +1,59 @@
+#pragma once
+
+/*
+
+Guess Scoring.
+
+Feedback for a (guess, answer) pair is stored as a base 3 number,
+one digit per position with the first letter as the least significant
+digit, so every possible feedback fits in a u8 (0..242):
+
+    0 - Wrong   (letter isn't in the answer, or all copies are used up)
+    1 - Placed  (letter is in the answer at another position)
+    2 - Correct (letter is in the answer at this position)
+
+Duplicate letters follow the usual rules: correct letters are matched
+first, then placed letters are handed out left to right while the
+answer still has unmatched copies of that letter.
+
+*/
+
+#include "core/types.h"
+#include "packed_word.h"
+
+namespace Scoring
+{
+
+using Feedback = u8;
+
+constexpr s32 feedbackCount = 243;                  // 3^5
+constexpr Feedback allCorrectFeedback = 242;        // All digits are 2
+constexpr s32 feedbackPowers[wordLength] = { 1, 3, 9, 27, 81 };
+
+Feedback Score(PackedWord guess, PackedWord answer);
+
+// Scores one guess against count answers, writing one feedback per answer.
+// This is the path solvers and simulators should use.
+void ScoreBatch(PackedWord guess, const PackedWord* answers, s32 count, Feedback* outFeedback);
+
+// Bit i is set if position i is correct
+inline constexpr u8 GetCorrectMask(Feedback feedback)
+{
+    u8 mask = 0;
+    for (int i = 0; i < wordLength; i++, feedback /= 3)
+        mask |= (u8)((feedback % 3 == 2) << i);
+
+    return mask;
+}
+
+// Bit i is set if position i is placed
+inline constexpr u8 GetPlacedMask(Feedback feedback)
+{
+    u8 mask = 0;
+    for (int i = 0; i < wordLength; i++, feedback /= 3)
+        mask |= (u8)((feedback % 3 == 1) << i);
+
+    return mask;
+}
+
+} // namespace Scoring
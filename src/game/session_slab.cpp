@@ -0,0 +1,154 @@
+#include "session_slab.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+#include "board.h"
+
+namespace SessionSlab
+{
+
+static constexpr u32 indexMask = (1u << indexBits) - 1;
+static constexpr u32 generationMask = (1u << (32 - indexBits)) - 1;
+
+static struct
+{
+    Session* sessions = nullptr;
+    s32 capacity = 0;
+    s32 activeCount = 0;
+    s32 firstFree = -1;
+} slab;
+
+static inline u32 MakeId(s32 index, u32 generation)
+{
+    return (generation << indexBits) | (u32) index;
+}
+
+bool Init(s32 capacity)
+{
+    AssertWithMessage(capacity > 0 && capacity <= maxCapacity, "Session capacity is out of range!");
+
+    Shutdown();
+
+    slab.sessions = (Session*) PlatformAllocate((u64) capacity * sizeof(Session));
+    if (!slab.sessions)
+        return false;
+
+    PlatformZeroMemory(slab.sessions, (u64) capacity * sizeof(Session));
+
+    // Free list in slot order, so the first sessions are next to each other in memory
+    for (s32 i = 0; i < capacity; i++)
+        slab.sessions[i].nextFree = (i + 1 < capacity) ? i + 1 : -1;
+
+    slab.capacity = capacity;
+    slab.activeCount = 0;
+    slab.firstFree = 0;
+
+    return true;
+}
+
+void Shutdown()
+{
+    if (slab.sessions)
+        PlatformFree(slab.sessions);
+
+    slab.sessions = nullptr;
+    slab.capacity = 0;
+    slab.activeCount = 0;
+    slab.firstFree = -1;
+}
+
+u32 Create(s32 answerIndex, u32 owner, OwnedList& list)
+{
+    if (slab.firstFree < 0)
+        return invalidId;
+
+    s32 index = slab.firstFree;
+    Session& session = slab.sessions[index];
+
+    slab.firstFree = session.nextFree;
+    slab.activeCount++;
+
+    session.board.Reset(answerIndex);
+    session.owner = owner;
+    session.nextFree = -1;
+    session.active = true;
+
+    // Newest first, so adding never has to find the end of the list
+    session.list = &list;
+    session.prevOwned = -1;
+    session.nextOwned = list.first;
+
+    if (list.first >= 0)
+        slab.sessions[list.first].prevOwned = index;
+
+    list.first = index;
+    list.count++;
+
+    return MakeId(index, session.generation);
+}
+
+Session* Get(u32 id)
+{
+    u32 index = id & indexMask;
+    if (index >= (u32) slab.capacity)
+        return nullptr;
+
+    Session& session = slab.sessions[index];
+    if (!session.active || MakeId((s32) index, session.generation) != id)
+        return nullptr;
+
+    return &session;
+}
+
+static void Free(s32 index)
+{
+    Session& session = slab.sessions[index];
+    OwnedList& list = *session.list;
+
+    if (session.prevOwned >= 0)
+        slab.sessions[session.prevOwned].nextOwned = session.nextOwned;
+    else
+        list.first = session.nextOwned;
+
+    if (session.nextOwned >= 0)
+        slab.sessions[session.nextOwned].prevOwned = session.prevOwned;
+
+    list.count--;
+    session.list = nullptr;
+
+    session.active = false;
+    session.generation = (session.generation + 1) & generationMask;
+    session.nextFree = slab.firstFree;
+
+    slab.firstFree = index;
+    slab.activeCount--;
+}
+
+void Destroy(u32 id)
+{
+    if (Get(id))
+        Free((s32) (id & indexMask));
+}
+
+s32 DestroyAll(OwnedList& list)
+{
+    s32 destroyed = list.count;
+
+    while (list.first >= 0)
+        Free(list.first);
+
+    return destroyed;
+}
+
+s32 GetActiveCount()
+{
+    return slab.activeCount;
+}
+
+s32 GetCapacity()
+{
+    return slab.capacity;
+}
+
+} // namespace SessionSlab
@@ -0,0 +1,70 @@
+#pragma once
+
+/*
+
+Session Slab.
+
+Independent games for a server hosting many players at once. Every
+session is a Board living in one fixed array allocated up front, with a
+free list threaded through the unused slots, so creating and ending
+sessions never allocates.
+
+Session ids pack the slot index with a generation that's bumped every
+time the slot is freed, so an id for a session that's over can't reach
+whatever session reuses its slot.
+
+Every owner's sessions are also linked together through their slots, so
+ending all of them (when a connection closes) only touches those, never
+the rest of the slab.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+
+namespace SessionSlab
+{
+
+constexpr u32 invalidId = 0xFFFFFFFF;
+constexpr s32 indexBits = 20;
+constexpr s32 maxCapacity = (1 << indexBits) - 1;     // The last index is left out so no id can be invalidId
+
+// The sessions of one owner, the owner keeps it for as long as they can have sessions
+struct OwnedList
+{
+    s32 first = -1;     // Slot of the newest session, -1 if there's none
+    s32 count = 0;
+};
+
+struct Session
+{
+    Board board;
+    u32 owner;          // Whatever the caller wants to tag sessions with, like the connection
+    u32 generation;
+    s32 nextFree;       // Next free slot while this one is free, -1 at the end of the list
+    s32 prevOwned;      // Neighbours in the owner's list while this one is active, -1 at the ends
+    s32 nextOwned;
+    OwnedList* list;
+    bool active;
+};
+
+// Allocates every slot. capacity has to be in [1, maxCapacity].
+bool Init(s32 capacity);
+void Shutdown();
+
+// Starts a game with wordList[answerIndex] as the answer and adds it to list.
+// Returns invalidId if every slot is taken.
+u32 Create(s32 answerIndex, u32 owner, OwnedList& list);
+
+// nullptr if the id is stale or was never handed out
+Session* Get(u32 id);
+
+void Destroy(u32 id);
+
+// Ends every session in the list, returns how many there were
+s32 DestroyAll(OwnedList& list);
+
+s32 GetActiveCount();
+s32 GetCapacity();
+
+} // namespace SessionSlab
@@ -0,0 +1,87 @@
+#pragma once
+
+// Thin wrappers over 32 bit integer lanes so the word kernels are written
+// once for both instruction sets. AVX2 is used when the compiler targets it,
+// otherwise SSE2 (which every x64 CPU has).
+
+#include "core/types.h"
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+
+namespace Simd
+{
+
+#ifdef __AVX2__
+
+constexpr s32 laneCount = 8;
+using Vec = __m256i;
+
+inline Vec Load(const u32* ptr)          { return _mm256_loadu_si256((const __m256i*) ptr); }
+inline void Store(u32* ptr, Vec v)       { _mm256_storeu_si256((__m256i*) ptr, v); }
+inline Vec Set1(u32 x)                   { return _mm256_set1_epi32((s32) x); }
+inline Vec Zero()                        { return _mm256_setzero_si256(); }
+inline Vec CmpEq(Vec a, Vec b)           { return _mm256_cmpeq_epi32(a, b); }
+inline Vec CmpGt(Vec a, Vec b)           { return _mm256_cmpgt_epi32(a, b); }
+inline Vec Add(Vec a, Vec b)             { return _mm256_add_epi32(a, b); }
+inline Vec Sub(Vec a, Vec b)             { return _mm256_sub_epi32(a, b); }
+inline Vec And(Vec a, Vec b)             { return _mm256_and_si256(a, b); }
+inline Vec AndNot(Vec a, Vec b)          { return _mm256_andnot_si256(a, b); }     // ~a & b
+inline Vec Or(Vec a, Vec b)              { return _mm256_or_si256(a, b); }
+inline Vec ShiftRight(Vec v, s32 bits)   { return _mm256_srl_epi32(v, _mm_cvtsi32_si128(bits)); }
+inline u32 MoveMask(Vec v)               { return (u32) _mm256_movemask_ps(_mm256_castsi256_ps(v)); }
+
+// 1 << (letter - 1), and 0 for letter 0 (shift counts over 31 give 0)
+inline Vec LetterBit(Vec letters)
+{
+    return _mm256_sllv_epi32(Set1(1), _mm256_sub_epi32(letters, Set1(1)));
+}
+
+// Narrows lanes holding values under 256 to bytes
+inline void StoreBytes(u8* ptr, Vec v)
+{
+    __m128i words = _mm_packs_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64((__m128i*) ptr, _mm_packus_epi16(words, words));
+}
+
+#else
+
+constexpr s32 laneCount = 4;
+using Vec = __m128i;
+
+inline Vec Load(const u32* ptr)          { return _mm_loadu_si128((const __m128i*) ptr); }
+inline void Store(u32* ptr, Vec v)       { _mm_storeu_si128((__m128i*) ptr, v); }
+inline Vec Set1(u32 x)                   { return _mm_set1_epi32((s32) x); }
+inline Vec Zero()                        { return _mm_setzero_si128(); }
+inline Vec CmpEq(Vec a, Vec b)           { return _mm_cmpeq_epi32(a, b); }
+inline Vec CmpGt(Vec a, Vec b)           { return _mm_cmpgt_epi32(a, b); }
+inline Vec Add(Vec a, Vec b)             { return _mm_add_epi32(a, b); }
+inline Vec Sub(Vec a, Vec b)             { return _mm_sub_epi32(a, b); }
+inline Vec And(Vec a, Vec b)             { return _mm_and_si128(a, b); }
+inline Vec AndNot(Vec a, Vec b)          { return _mm_andnot_si128(a, b); }        // ~a & b
+inline Vec Or(Vec a, Vec b)              { return _mm_or_si128(a, b); }
+inline Vec ShiftRight(Vec v, s32 bits)   { return _mm_srl_epi32(v, _mm_cvtsi32_si128(bits)); }
+inline u32 MoveMask(Vec v)               { return (u32) _mm_movemask_ps(_mm_castsi128_ps(v)); }
+
+// SSE2 has no per-lane shifts, so build 2^(letter - 1) as a float by writing
+// the exponent directly and convert it back. Letter 0 gives 0.5, which truncates to 0.
+inline Vec LetterBit(Vec letters)
+{
+    Vec exponent = _mm_slli_epi32(_mm_add_epi32(letters, Set1(126)), 23);
+    return _mm_cvttps_epi32(_mm_castsi128_ps(exponent));
+}
+
+// Narrows lanes holding values under 256 to bytes
+inline void StoreBytes(u8* ptr, Vec v)
+{
+    __m128i words = _mm_packs_epi32(v, v);
+    s32 bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+    *(s32*) ptr = bytes;
+}
+
+#endif
+
+} // namespace Simd
@@ -0,0 +1,137 @@
+#include "simulator.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "core/jobs.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+#include "strategies.h"
+
+namespace Simulator
+{
+
+// Everything one thread touches while playing, padded so threads don't share cache lines
+struct alignas(64) ThreadData
+{
+    Board board;
+    Strategies::Scratch scratch;
+
+    u32 wins[maxGuesses + 1];
+    u32 losses;
+    u32 totalGuesses;
+};
+
+static struct
+{
+    void* block = nullptr;      // Unaligned allocation the thread array lives in
+    ThreadData* threads = nullptr;
+    s32 threadCount = 0;
+} simulator;
+
+struct RunJob
+{
+    Strategies::Strategy strategy;
+};
+
+static void PlayGames(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    RunJob& job = *(RunJob*) data;
+    ThreadData& thread = simulator.threads[threadIndex];
+    Board& board = thread.board;
+
+    for (s32 answer = begin; answer < end; answer++)
+    {
+        board.Reset(answer);
+
+        while (board.status == BoardStatus::PLAYING)
+        {
+            s32 guess = job.strategy(board, thread.scratch);
+            AssertWithMessage(guess >= 0 && guess < wordListSize, "Strategy made an invalid guess!");
+
+            board.Guess(guess);
+        }
+
+        if (board.status == BoardStatus::WON)
+        {
+            thread.wins[board.guessCount]++;
+            thread.totalGuesses += board.guessCount;
+        }
+        else
+        {
+            thread.losses++;
+            thread.totalGuesses += maxGuesses;
+        }
+    }
+}
+
+static void PrepareThreads()
+{
+    s32 threadCount = Jobs::GetThreadCount();
+    if (simulator.threadCount < threadCount)
+    {
+        Shutdown();
+
+        // Boards and scratch are large, so these live on the heap instead of worker stacks
+        simulator.block = PlatformAllocate(sizeof(ThreadData) * threadCount + alignof(ThreadData));
+        AssertWithMessage(simulator.block, "Couldn't allocate simulator scratch!");
+
+        u64 aligned = ((u64) simulator.block + alignof(ThreadData) - 1) & ~(u64) (alignof(ThreadData) - 1);
+        simulator.threads = (ThreadData*) aligned;
+        simulator.threadCount = threadCount;
+    }
+
+    for (s32 i = 0; i < simulator.threadCount; i++)
+    {
+        ThreadData& thread = simulator.threads[i];
+        PlatformZeroMemory(thread.wins, sizeof(thread.wins));
+        thread.losses = 0;
+        thread.totalGuesses = 0;
+    }
+}
+
+Results Run(Strategies::Strategy strategy, s32 answerCount)
+{
+    if (answerCount <= 0 || answerCount > answersEnd)
+        answerCount = answersEnd;
+
+    PrepareThreads();
+
+    RunJob job = { strategy };
+
+    f64 startTime = PlatformGetTime();
+    Jobs::ParallelFor(answerCount, 8, PlayGames, &job);
+    f64 endTime = PlatformGetTime();
+
+    Results results = {};
+    results.games = answerCount;
+    results.seconds = endTime - startTime;
+
+    for (s32 i = 0; i < simulator.threadCount; i++)
+    {
+        const ThreadData& thread = simulator.threads[i];
+
+        for (s32 n = 0; n <= maxGuesses; n++)
+            results.wins[n] += thread.wins[n];
+
+        results.losses += thread.losses;
+        results.totalGuesses += thread.totalGuesses;
+    }
+
+    return results;
+}
+
+void Shutdown()
+{
+    if (!simulator.block)
+        return;
+
+    PlatformFree(simulator.block);
+
+    simulator.block = nullptr;
+    simulator.threads = nullptr;
+    simulator.threadCount = 0;
+}
+
+} // namespace Simulator
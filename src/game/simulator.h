@@ -0,0 +1,52 @@
+#pragma once
+
+/*
+
+Simulator.
+
+Plays every answer in the word list with a strategy, with no window
+attached, and reports how it did. Answers are split across the worker
+pool. Each thread plays on its own board and scratch, which are set up
+once and reused, so playing a game never allocates.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "strategies.h"
+
+namespace Simulator
+{
+
+struct Results
+{
+    u32 wins[maxGuesses + 1];   // wins[n] is the number of games won on guess n
+    u32 losses;
+    u32 games;
+    u32 totalGuesses;           // Over every game, losses count as maxGuesses
+    f64 seconds;
+
+    inline f32 GetAverageGuesses() const
+    {
+        return games ? (f32) totalGuesses / games : 0.0f;
+    }
+
+    inline f32 GetFailureRate() const
+    {
+        return games ? (f32) losses / games : 0.0f;
+    }
+
+    inline f64 GetGamesPerSecond() const
+    {
+        return seconds > 0.0 ? games / seconds : 0.0;
+    }
+};
+
+// Plays answers [0, answerCount), answerCount <= 0 plays every answer.
+// Strategies::Init() has to have been called.
+Results Run(Strategies::Strategy strategy, s32 answerCount = 0);
+
+// Frees the per thread scratch
+void Shutdown();
+
+} // namespace Simulator
@@ -0,0 +1,300 @@
+#include "state_cache.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "containers/hashtable.h"
+#include "math/random.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "hints.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <mutex>
+#include <new>
+
+namespace StateCache
+{
+
+static constexpr u64 zobristSeed = 0x2B0B5717A7E5EEDull;
+
+// A random key for every (guess, feedback) pair would be 25 MB, so pairs mix
+// a key per guess with a key per feedback instead. The mix isn't linear, so
+// pairs sharing a guess or a feedback don't cancel out when XORed together.
+struct ZobristKeys
+{
+    u64 guesses[wordListSize];
+    u64 feedback[Scoring::feedbackCount];
+
+    ZobristKeys()
+    {
+        Math::RandomState random = Math::SeedRandom(zobristSeed);
+
+        for (s32 i = 0; i < wordListSize; i++)
+            guesses[i] = Math::RandomU64(random);
+
+        for (s32 i = 0; i < Scoring::feedbackCount; i++)
+            feedback[i] = Math::RandomU64(random);
+    }
+};
+
+static const ZobristKeys& GetKeys()
+{
+    // Built on first use, and safe even if that happens on several threads
+    static const ZobristKeys keys;
+    return keys;
+}
+
+// Recently used entries are at the head of the list, the next to be pushed out at the tail
+struct Node
+{
+    u64 stateHash;
+    Hints::Hint hint;
+    s32 prev;       // -1 at the ends of the list
+    s32 next;
+};
+
+struct alignas(64) Shard
+{
+    std::mutex mutex;
+    HashTable<u64, s32> index;     // State hash to node
+
+    Node* nodes;
+    s32 count;
+    s32 head;
+    s32 tail;
+
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+
+    Shard(Node* nodes, s32 capacity)
+    :   index(capacity * 2)         // Twice the entries so it never has to grow
+    ,   nodes(nodes), count(0), head(-1), tail(-1)
+    ,   hits(0), misses(0), evictions(0)
+    {
+    }
+};
+
+static struct
+{
+    void* block = nullptr;
+    Shard* shards = nullptr;
+    s32 shardCapacity = 0;
+} cache;
+
+u64 GetGuessKey(s32 guessIndex, Scoring::Feedback feedback)
+{
+    const ZobristKeys& keys = GetKeys();
+
+    // SplitMix64's finalizer
+    u64 key = keys.guesses[guessIndex] ^ keys.feedback[feedback];
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ull;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBull;
+    return key ^ (key >> 31);
+}
+
+u64 HashHistory(const Board& board)
+{
+    u64 hash = 0;
+    for (s32 i = 0; i < board.guessCount; i++)
+    {
+        // A repeated guess leaves the same candidates, and XORing its key in again would cancel it out
+        bool repeated = false;
+        for (s32 j = 0; j < i && !repeated; j++)
+            repeated = board.guesses[j] == board.guesses[i] && board.feedback[j] == board.feedback[i];
+
+        if (!repeated)
+            hash ^= GetGuessKey(board.guesses[i], board.feedback[i]);
+    }
+
+    return hash;
+}
+
+static inline Shard& GetShard(u64 stateHash)
+{
+    // The table inside the shard hashes the low bits, so pick the shard with the high ones
+    return cache.shards[(stateHash >> 32) % shardCount];
+}
+
+static void Unlink(Shard& shard, s32 node)
+{
+    Node& n = shard.nodes[node];
+
+    if (n.prev >= 0)
+        shard.nodes[n.prev].next = n.next;
+    else
+        shard.head = n.next;
+
+    if (n.next >= 0)
+        shard.nodes[n.next].prev = n.prev;
+    else
+        shard.tail = n.prev;
+}
+
+static void PushFront(Shard& shard, s32 node)
+{
+    Node& n = shard.nodes[node];
+    n.prev = -1;
+    n.next = shard.head;
+
+    if (shard.head >= 0)
+        shard.nodes[shard.head].prev = node;
+    else
+        shard.tail = node;
+
+    shard.head = node;
+}
+
+bool Init(s32 capacity)
+{
+    AssertWithMessage(capacity > 0, "State cache capacity has to be positive!");
+
+    Shutdown();
+
+    // Building the keys takes a moment, better here than in the middle of a game
+    GetKeys();
+
+    s32 shardCapacity = (capacity + shardCount - 1) / shardCount;
+
+    u64 size = sizeof(Shard) * shardCount + alignof(Shard) + sizeof(Node) * shardCapacity * shardCount;
+    cache.block = PlatformAllocate(size);
+    if (!cache.block)
+        return false;
+
+    u64 aligned = ((u64) cache.block + alignof(Shard) - 1) & ~(u64) (alignof(Shard) - 1);
+    cache.shards = (Shard*) aligned;
+    cache.shardCapacity = shardCapacity;
+
+    Node* nodes = (Node*) (cache.shards + shardCount);
+    for (s32 i = 0; i < shardCount; i++)
+        new (&cache.shards[i]) Shard(nodes + i * shardCapacity, shardCapacity);
+
+    return true;
+}
+
+void Shutdown()
+{
+    if (!cache.block)
+        return;
+
+    for (s32 i = 0; i < shardCount; i++)
+        cache.shards[i].~Shard();
+
+    PlatformFree(cache.block);
+
+    cache.block = nullptr;
+    cache.shards = nullptr;
+    cache.shardCapacity = 0;
+}
+
+bool Find(u64 stateHash, Hints::Hint& hint)
+{
+    if (!cache.shards)
+        return false;
+
+    Shard& shard = GetShard(stateHash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.Find(stateHash);
+    if (!it)
+    {
+        shard.misses++;
+        return false;
+    }
+
+    s32 node = it.value();
+    if (node != shard.head)
+    {
+        Unlink(shard, node);
+        PushFront(shard, node);
+    }
+
+    hint = shard.nodes[node].hint;
+    shard.hits++;
+
+    return true;
+}
+
+void Store(u64 stateHash, const Hints::Hint& hint)
+{
+    if (!cache.shards)
+        return;
+
+    Shard& shard = GetShard(stateHash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    s32 node;
+
+    auto it = shard.index.Find(stateHash);
+    if (it)
+    {
+        node = it.value();
+        Unlink(shard, node);
+    }
+    else if (shard.count < cache.shardCapacity)
+    {
+        node = shard.count++;
+        shard.index.Place(stateHash, node);
+    }
+    else
+    {
+        // Full, reuse the least recently used node
+        node = shard.tail;
+        Unlink(shard, node);
+
+        shard.index.Remove(shard.nodes[node].stateHash);
+        shard.index.Place(stateHash, node);
+        shard.evictions++;
+    }
+
+    shard.nodes[node].stateHash = stateHash;
+    shard.nodes[node].hint = hint;
+    PushFront(shard, node);
+}
+
+void Clear()
+{
+    if (!cache.shards)
+        return;
+
+    for (s32 i = 0; i < shardCount; i++)
+    {
+        Shard& shard = cache.shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        for (s32 n = 0; n < shard.count; n++)
+            shard.index.Remove(shard.nodes[n].stateHash);
+
+        shard.count = 0;
+        shard.head = -1;
+        shard.tail = -1;
+
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+    }
+}
+
+Stats GetStats()
+{
+    Stats stats = {};
+    if (!cache.shards)
+        return stats;
+
+    for (s32 i = 0; i < shardCount; i++)
+    {
+        Shard& shard = cache.shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        stats.hits += shard.hits;
+        stats.misses += shard.misses;
+        stats.evictions += shard.evictions;
+        stats.size += shard.count;
+    }
+
+    stats.capacity = cache.shardCapacity * shardCount;
+    return stats;
+}
+
+} // namespace StateCache
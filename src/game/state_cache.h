@@ -0,0 +1,73 @@
+#pragma once
+
+/*
+
+State Cache.
+
+Remembers hints by game state, so boards that reached the same state
+through the same guesses share one search. Strategies and servers
+playing many games ask for the same states over and over, mostly in the
+first few guesses.
+
+States are identified by a Zobrist style 64 bit hash of the (guess,
+feedback) pairs played so far. Each pair gets a random key and the hash
+is the XOR of them all, so it can be updated one guess at a time, and
+the order guesses were played in doesn't matter, same as for the
+candidates they leave. A guess played twice only counts once, otherwise
+its key would cancel itself out.
+
+The cache holds a fixed number of entries and pushes out the least
+recently used one when it's full. It's split into shards with a lock
+each, so any number of threads can use it at once without all waiting
+on the same lock.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "hints.h"
+#include "scoring.h"
+
+namespace StateCache
+{
+
+constexpr s32 shardCount = 16;
+constexpr s32 defaultCapacity = 1 << 16;
+
+struct Stats
+{
+    u64 hits;
+    u64 misses;
+    u64 evictions;
+    s32 size;
+    s32 capacity;
+
+    inline f32 GetHitRate() const
+    {
+        return (hits + misses) ? (f32) hits / (hits + misses) : 0.0f;
+    }
+};
+
+// Key for one guess, to XOR into the hash of the state before it
+u64 GetGuessKey(s32 guessIndex, Scoring::Feedback feedback);
+
+// Hash of every different guess on the board so far, 0 before the first guess
+u64 HashHistory(const Board& board);
+
+// Makes room for capacity entries, split evenly over the shards.
+// Call before any thread uses the cache, until then every lookup misses.
+bool Init(s32 capacity);
+void Shutdown();
+
+// Copies the hint out if the state is cached, and marks it as recently used
+bool Find(u64 stateHash, Hints::Hint& hint);
+
+// Adds or replaces the hint for a state, pushing out the least recently used one if the shard is full
+void Store(u64 stateHash, const Hints::Hint& hint);
+
+// Forgets every entry and resets the counters
+void Clear();
+
+Stats GetStats();
+
+} // namespace StateCache
@@ -0,0 +1,199 @@
+#include "stats_store.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "math/bits.h"
+#include "platform/platform.h"
+#include "board.h"
+
+#include <cstdio>
+
+namespace StatsStore
+{
+
+static constexpr char fileMagic[4] = { 'S', 'T', 'A', 'T' };
+static constexpr s32 fileSize = (1 + 2 * variantCount) * pageSize;
+
+static struct
+{
+    FILE* file = nullptr;
+
+    Stats stats[variantCount];
+    u32 sequence[variantCount];     // Of the newest page
+    s32 newestPage[variantCount];   // 0 or 1, the next write goes to the other one
+} store;
+
+static u32 ChecksumPage(const StatsPage& page)
+{
+    const u8* bytes = (const u8*) &page + 8;
+
+    u32 hash = 0x811C9DC5;
+    for (s32 i = 0; i < pageSize - 8; i++)
+        hash = (hash ^ bytes[i]) * 0x01000193;
+
+    return hash;
+}
+
+static inline long GetPageOffset(s32 variant, s32 page)
+{
+    return (long) (1 + 2 * variant + page) * pageSize;
+}
+
+static bool CreateStatsFile(const char* filepath)
+{
+    FILE* file = fopen(filepath, "w+b");
+    if (!file)
+        return false;
+
+    // Both pages of every variant start out empty and invalid, so the first write wins
+    u8 pages[fileSize] = {};
+
+    FileHeader& header = *(FileHeader*) pages;
+    PlatformCopyMemory(header.magic, fileMagic, sizeof(fileMagic));
+    header.version = fileVersion;
+    header.pageSize = pageSize;
+    header.variantCount = variantCount;
+
+    if (fwrite(pages, sizeof(pages), 1, file) != 1 || fflush(file) != 0)
+    {
+        fclose(file);
+        return false;
+    }
+
+    store.file = file;
+    return true;
+}
+
+bool Load(const char* filepath)
+{
+    Close();
+
+    PlatformZeroMemory(store.stats, sizeof(store.stats));
+    PlatformZeroMemory(store.sequence, sizeof(store.sequence));
+    PlatformZeroMemory(store.newestPage, sizeof(store.newestPage));
+
+    FILE* file = fopen(filepath, "r+b");
+    if (!file)
+        return CreateStatsFile(filepath);
+
+    u8 pages[fileSize];
+    const FileHeader& header = *(const FileHeader*) pages;
+
+    // The header is only written when the file is made, so a file that's short or
+    // has a blank header is one that crashed while being made and holds no stats yet
+    bool complete = fread(pages, sizeof(pages), 1, file) == 1;
+
+    bool blank = true;
+    for (s32 i = 0; complete && blank && i < (s32) sizeof(FileHeader); i++)
+        blank = pages[i] == 0;
+
+    if (!complete || blank)
+    {
+        fclose(file);
+        return CreateStatsFile(filepath);
+    }
+
+    bool valid = header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+                 header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+                 header.version == fileVersion &&
+                 header.pageSize == pageSize &&
+                 header.variantCount == variantCount;
+
+    if (!valid)
+    {
+        Warn("Stats file has an unknown format, keeping stats in memory only.");
+        fclose(file);
+        return false;
+    }
+
+    for (s32 v = 0; v < variantCount; v++)
+    {
+        for (s32 p = 0; p < 2; p++)
+        {
+            const StatsPage& page = *(const StatsPage*) (pages + GetPageOffset(v, p));
+
+            if (page.sequence > store.sequence[v] && page.checksum == ChecksumPage(page))
+            {
+                store.stats[v] = page.stats;
+                store.sequence[v] = page.sequence;
+                store.newestPage[v] = p;
+            }
+        }
+    }
+
+    store.file = file;
+    return true;
+}
+
+void Close()
+{
+    if (store.file)
+        fclose(store.file);
+
+    store.file = nullptr;
+}
+
+s32 GetVariant(GameMode mode, s32 boardCount)
+{
+    if (mode == GameMode::ABSURDLE)
+        return variantCount - 1;
+
+    AssertWithMessage(boardCount >= 1 && boardCount <= maxBoards && (boardCount & (boardCount - 1)) == 0,
+                      "Stats are only kept for power of 2 board counts!");
+
+    return CountTrailingZeros((u32) boardCount);
+}
+
+const Stats& Get(GameMode mode, s32 boardCount)
+{
+    return store.stats[GetVariant(mode, boardCount)];
+}
+
+void RecordGame(GameMode mode, s32 boardCount, bool won, s32 guessCount)
+{
+    AssertWithMessage(guessCount >= 0 && guessCount <= maxMultiGuesses, "Guess count is out of range!");
+
+    s32 variant = GetVariant(mode, boardCount);
+    Stats& stats = store.stats[variant];
+
+    stats.played++;
+
+    if (won)
+    {
+        stats.won++;
+        stats.guesses[guessCount]++;
+        stats.currentStreak++;
+        stats.maxStreak = (stats.currentStreak > stats.maxStreak) ? stats.currentStreak : stats.maxStreak;
+    }
+    else
+    {
+        stats.currentStreak = 0;
+    }
+
+    if (!store.file)
+        return;
+
+    // Overwrite the older page, the newest one stays intact until this one is complete
+    StatsPage page;
+    PlatformZeroMemory(&page, sizeof(page));
+    page.sequence = store.sequence[variant] + 1;
+    page.stats = stats;
+    page.checksum = ChecksumPage(page);
+
+    s32 target = 1 - store.newestPage[variant];
+
+    bool written = fseek(store.file, GetPageOffset(variant, target), SEEK_SET) == 0 &&
+                   fwrite(&page, sizeof(page), 1, store.file) == 1 &&
+                   fflush(store.file) == 0;
+
+    if (!written)
+    {
+        Warn("Failed to write stats!");
+        return;
+    }
+
+    store.sequence[variant] = page.sequence;
+    store.newestPage[variant] = target;
+}
+
+} // namespace StatsStore
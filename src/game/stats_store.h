@@ -0,0 +1,85 @@
+#pragma once
+
+/*
+
+Stats Store.
+
+Wins, losses, streaks and the guess distribution for every way the game
+can be played, kept across runs in a small fixed layout binary file.
+
+Each variant (classic with 1 to 32 boards, and Absurdle) has two pages
+in the file. An update only rewrites the older of its two pages, with a
+higher sequence number and a fresh checksum, and loading takes the
+newest page that checks out. A crash in the middle of a write can only
+tear the page being written, so the previous state is still there in
+the other one. Pages are a disk sector each so a torn sector never takes
+out both.
+
+An update is one page of I/O, and loading is a single read of the whole
+file (under 8 KB) with nothing to parse.
+
+File layout (little endian), pageSize byte pages:
+
+    FileHeader
+    variantCount pairs of StatsPages
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "multi_board.h"
+
+namespace StatsStore
+{
+
+constexpr char defaultPath[] = "stats.bin";
+
+constexpr u32 fileVersion = 1;
+constexpr s32 pageSize = 512;
+constexpr s32 variantCount = 7;                 // Classic with 1, 2, 4, 8, 16 and 32 boards, then Absurdle
+
+struct Stats
+{
+    u32 played;
+    u32 won;
+    u32 currentStreak;
+    u32 maxStreak;
+    u32 guesses[maxMultiGuesses + 1];           // Games won in n guesses
+};
+
+struct FileHeader
+{
+    char magic[4];                              // "STAT"
+    u32  version;
+    u32  pageSize;
+    u32  variantCount;
+    u8   reserved[StatsStore::pageSize - 16];
+};
+
+struct StatsPage
+{
+    u32   sequence;                             // Bumped on every write, the newer valid page wins
+    u32   checksum;                             // FNV-1a over the rest of the page
+    Stats stats;
+    u8    reserved[pageSize - 8 - sizeof(Stats)];
+};
+
+static_assert(sizeof(FileHeader) == pageSize, "File header has to fill one page!");
+static_assert(sizeof(StatsPage) == pageSize, "Stats have to fill one page!");
+
+// Loads the stats, or starts with empty ones if the file doesn't exist yet or
+// was cut short while being made. Returns false if the file can't be created
+// or has a header from something else, stats are still kept in memory.
+bool Load(const char* filepath);
+
+void Close();
+
+// Board count has to be one of the counts the game offers (a power of 2 up to 32)
+s32 GetVariant(GameMode mode, s32 boardCount);
+
+const Stats& Get(GameMode mode, s32 boardCount);
+
+// Counts a finished game and writes that variant's page
+void RecordGame(GameMode mode, s32 boardCount, bool won, s32 guessCount);
+
+} // namespace StatsStore
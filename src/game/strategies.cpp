@@ -0,0 +1,86 @@
+#include "strategies.h"
+
+#include "core/types.h"
+#include "board.h"
+#include "candidates.h"
+#include "hints.h"
+#include "opening_book.h"
+#include "packed_word.h"
+#include "state_cache.h"
+
+#include <cstring>
+
+namespace Strategies
+{
+
+const StrategyInfo strategies[] = {
+    { "first",   FirstCandidate },
+    { "entropy", MaxEntropy },
+};
+
+const s32 strategyCount = sizeof(strategies) / sizeof(strategies[0]);
+
+static struct
+{
+    // Every game starts from the same candidate set, so the first guess only needs working out once
+    s32 entropyOpening = -1;
+} shared;
+
+void Init()
+{
+    BuildPackedWordList();
+    CandidateIndex::Build();
+
+    // The book has the opener precomputed, searching for it is the slowest part of starting up
+    shared.entropyOpening = OpeningBook::GetOpeningGuess();
+    if (shared.entropyOpening < 0)
+    {
+        CandidateSet all;
+        all.Reset();
+
+        shared.entropyOpening = Hints::GetBestGuess(all).guessIndex;
+    }
+}
+
+s32 FirstCandidate(const Board& board, Scratch& scratch)
+{
+    for (s32 answer : board.candidates)
+        return answer;
+
+    return -1;
+}
+
+s32 MaxEntropy(const Board& board, Scratch& scratch)
+{
+    if (board.guessCount == 0 && shared.entropyOpening >= 0)
+        return shared.entropyOpening;
+
+    // Second guesses after a common opener come straight from the opening book
+    Hints::Hint hint;
+    if (OpeningBook::GetHint(board, hint))
+        return hint.guessIndex;
+
+    // Hints only depend on the candidates, so boards with the same guesses share one search.
+    // The count catches the odd hash collision.
+    u64 state = StateCache::HashHistory(board);
+    if (StateCache::Find(state, hint) && hint.candidateCount == board.candidates.Count())
+        return hint.guessIndex;
+
+    hint = Hints::FindBestGuess(board.candidates, scratch.hints);
+    StateCache::Store(state, hint);
+
+    return hint.guessIndex;
+}
+
+const StrategyInfo* Find(const char* name)
+{
+    for (s32 i = 0; i < strategyCount; i++)
+    {
+        if (strcmp(strategies[i].name, name) == 0)
+            return &strategies[i];
+    }
+
+    return nullptr;
+}
+
+} // namespace Strategies
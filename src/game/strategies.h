@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+
+Strategies.
+
+Guessing strategies that play a Board on their own, for simulators and
+bots. A strategy looks at the board and returns the index of the word
+to guess next.
+
+Strategies can be called from many threads at once. Anything they need
+to write to goes in the Scratch they're handed, which belongs to the
+calling thread and is reused between games.
+
+*/
+
+#include "core/types.h"
+#include "containers/function.h"
+#include "board.h"
+#include "hints.h"
+
+namespace Strategies
+{
+
+struct Scratch
+{
+    Hints::Scratch hints;
+};
+
+using Strategy = Function<s32(const Board& board, Scratch& scratch)>;
+
+struct StrategyInfo
+{
+    const char* name;
+    Strategy    nextGuess;
+};
+
+// Builds the shared tables every strategy relies on, and works out the opening guesses.
+// Call once before playing from any thread, after loading the opening book if there is one.
+void Init();
+
+// Guesses the first answer that's still possible, in word list order
+s32 FirstCandidate(const Board& board, Scratch& scratch);
+
+// Guesses the word with the highest expected information, like the in game hint
+s32 MaxEntropy(const Board& board, Scratch& scratch);
+
+extern const StrategyInfo strategies[];
+extern const s32 strategyCount;
+
+// Returns nullptr if there's no strategy with that name
+const StrategyInfo* Find(const char* name);
+
+} // namespace Strategies
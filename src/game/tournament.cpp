@@ -0,0 +1,329 @@
+#include "tournament.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "core/jobs.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "strategies.h"
+
+#include <atomic>
+#include <new>
+
+namespace Tournament
+{
+
+struct Entrant
+{
+    const char* name = nullptr;
+    Strategies::Strategy strategy = nullptr;
+};
+
+struct Tally
+{
+    u32 games;
+    u32 wins[maxGuesses + 1];
+    u32 losses;
+    u32 totalGuesses;
+    s32 worstGuesses;
+    f64 cpuSeconds;
+};
+
+// Matches [begin, end) a thread still has to play, packed as (begin << 32) | end.
+// The owner takes from the front and thieves take from the back, both with a compare exchange.
+struct alignas(64) MatchQueue
+{
+    std::atomic<u64> range;
+};
+
+// Everything one thread touches while playing, padded so threads don't share cache lines
+struct alignas(64) ThreadData
+{
+    Board board;
+    Strategies::Scratch scratch;
+
+    Tally tallies[maxEntrants];
+    u32 steals;
+};
+
+static struct
+{
+    Entrant entrants[maxEntrants];
+    s32 entrantCount = 0;
+
+    void* block = nullptr;      // Unaligned allocation the thread and queue arrays live in
+    ThreadData* threads = nullptr;
+    MatchQueue* queues = nullptr;
+    s32 threadCount = 0;
+
+    s32 answerCount = 0;
+    s32 blockCount = 0;         // Matches per entrant
+} tournament;
+
+static inline u64 PackRange(u32 begin, u32 end)
+{
+    return ((u64) begin << 32) | end;
+}
+
+static inline u32 GetBegin(u64 range)
+{
+    return (u32) (range >> 32);
+}
+
+static inline u32 GetEnd(u64 range)
+{
+    return (u32) range;
+}
+
+// Takes the next match off the front of a thread's own queue, or returns false if it's empty
+static bool PopMatch(MatchQueue& queue, s32& match)
+{
+    u64 range = queue.range.load(std::memory_order_acquire);
+
+    while (GetBegin(range) < GetEnd(range))
+    {
+        if (queue.range.compare_exchange_weak(range, PackRange(GetBegin(range) + 1, GetEnd(range)), std::memory_order_acq_rel))
+        {
+            match = (s32) GetBegin(range);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Moves the back half of the fullest queue into this thread's (empty) queue.
+// Returns false once every queue is empty.
+static bool StealMatches(s32 threadIndex)
+{
+    while (true)
+    {
+        s32 victim = -1;
+        u32 mostLeft = 0;
+
+        for (s32 i = 0; i < tournament.threadCount; i++)
+        {
+            u64 range = tournament.queues[i].range.load(std::memory_order_relaxed);
+            u32 left = (GetEnd(range) > GetBegin(range)) ? GetEnd(range) - GetBegin(range) : 0;
+
+            if (i != threadIndex && left > mostLeft)
+            {
+                victim = i;
+                mostLeft = left;
+            }
+        }
+
+        if (victim < 0)
+            return false;
+
+        MatchQueue& queue = tournament.queues[victim];
+        u64 range = queue.range.load(std::memory_order_acquire);
+
+        u32 begin = GetBegin(range);
+        u32 end = GetEnd(range);
+        if (begin >= end)
+            continue;
+
+        // The victim keeps the front half, rounded down so a last match goes to the idle thread
+        u32 middle = begin + (end - begin) / 2;
+
+        if (queue.range.compare_exchange_strong(range, PackRange(begin, middle), std::memory_order_acq_rel))
+        {
+            // Nobody takes from an empty queue, so a plain store is enough
+            tournament.queues[threadIndex].range.store(PackRange(middle, end), std::memory_order_release);
+            tournament.threads[threadIndex].steals++;
+            return true;
+        }
+    }
+}
+
+static void PlayMatch(s32 match, ThreadData& thread)
+{
+    // Neighbouring matches belong to different entrants, so every queue gets a mix of cheap and slow ones
+    s32 entrantIndex = match % tournament.entrantCount;
+    s32 firstAnswer = (match / tournament.entrantCount) * matchSize;
+    s32 lastAnswer = (firstAnswer + matchSize < tournament.answerCount) ? firstAnswer + matchSize : tournament.answerCount;
+
+    Entrant& entrant = tournament.entrants[entrantIndex];
+    Tally& tally = thread.tallies[entrantIndex];
+    Board& board = thread.board;
+
+    f64 startTime = PlatformGetThreadCpuTime();
+
+    for (s32 answer = firstAnswer; answer < lastAnswer; answer++)
+    {
+        board.Reset(answer);
+
+        while (board.status == BoardStatus::PLAYING)
+        {
+            s32 guess = entrant.strategy(board, thread.scratch);
+            AssertWithMessage(guess >= 0 && guess < wordListSize, "Strategy made an invalid guess!");
+
+            board.Guess(guess);
+        }
+
+        s32 guesses = board.guessCount;
+
+        if (board.status == BoardStatus::WON)
+        {
+            tally.wins[guesses]++;
+        }
+        else
+        {
+            tally.losses++;
+            guesses = maxGuesses + 1;
+        }
+
+        tally.games++;
+        tally.totalGuesses += (guesses > maxGuesses) ? maxGuesses : guesses;
+        tally.worstGuesses = (guesses > tally.worstGuesses) ? guesses : tally.worstGuesses;
+    }
+
+    tally.cpuSeconds += PlatformGetThreadCpuTime() - startTime;
+}
+
+// Runs once per thread, threadIndex picks the queue it owns
+static void PlayMatches(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    ThreadData& thread = tournament.threads[threadIndex];
+    MatchQueue& queue = tournament.queues[threadIndex];
+
+    s32 match;
+    do
+    {
+        while (PopMatch(queue, match))
+            PlayMatch(match, thread);
+    } while (StealMatches(threadIndex));
+}
+
+bool Register(const char* name, Strategies::Strategy strategy)
+{
+    if (tournament.entrantCount >= maxEntrants)
+        return false;
+
+    tournament.entrants[tournament.entrantCount++] = { name, strategy };
+    return true;
+}
+
+void Clear()
+{
+    tournament.entrantCount = 0;
+}
+
+static void PrepareThreads()
+{
+    s32 threadCount = Jobs::GetThreadCount();
+    if (tournament.threadCount < threadCount)
+    {
+        Shutdown();
+
+        // Boards and scratch are large, so these live on the heap instead of worker stacks
+        u64 size = sizeof(ThreadData) * threadCount + sizeof(MatchQueue) * threadCount + alignof(ThreadData);
+        tournament.block = PlatformAllocate(size);
+        AssertWithMessage(tournament.block, "Couldn't allocate tournament scratch!");
+
+        u64 aligned = ((u64) tournament.block + alignof(ThreadData) - 1) & ~(u64) (alignof(ThreadData) - 1);
+        tournament.threads = (ThreadData*) aligned;
+        tournament.queues = (MatchQueue*) (tournament.threads + threadCount);
+        tournament.threadCount = threadCount;
+
+        for (s32 i = 0; i < threadCount; i++)
+            new (&tournament.queues[i].range) std::atomic<u64>(0);
+    }
+
+    for (s32 i = 0; i < tournament.threadCount; i++)
+    {
+        ThreadData& thread = tournament.threads[i];
+        PlatformZeroMemory(thread.tallies, sizeof(thread.tallies));
+        thread.steals = 0;
+    }
+}
+
+static bool IsBetter(const Standing& a, const Standing& b)
+{
+    if (a.losses != b.losses)
+        return a.losses < b.losses;
+
+    return a.GetMeanGuesses() < b.GetMeanGuesses();
+}
+
+void Run(Results& results, s32 answerCount)
+{
+    AssertWithMessage(tournament.entrantCount > 0, "Tournament has no entrants!");
+
+    if (answerCount <= 0 || answerCount > answersEnd)
+        answerCount = answersEnd;
+
+    PrepareThreads();
+
+    tournament.answerCount = answerCount;
+    tournament.blockCount = (answerCount + matchSize - 1) / matchSize;
+
+    // Deal out contiguous runs of matches, every thread gets about the same share of every entrant
+    u32 matchCount = (u32) (tournament.blockCount * tournament.entrantCount);
+    for (s32 i = 0; i < tournament.threadCount; i++)
+    {
+        u32 begin = (u32) ((u64) matchCount * i / tournament.threadCount);
+        u32 end = (u32) ((u64) matchCount * (i + 1) / tournament.threadCount);
+        tournament.queues[i].range.store(PackRange(begin, end), std::memory_order_relaxed);
+    }
+
+    f64 startTime = PlatformGetTime();
+    Jobs::ParallelFor(tournament.threadCount, 1, PlayMatches, nullptr);
+    f64 endTime = PlatformGetTime();
+
+    PlatformZeroMemory(&results, sizeof(results));
+    results.entrantCount = tournament.entrantCount;
+    results.seconds = endTime - startTime;
+    results.threadCount = tournament.threadCount;
+
+    for (s32 e = 0; e < tournament.entrantCount; e++)
+    {
+        Standing& standing = results.standings[e];
+        standing.name = tournament.entrants[e].name;
+
+        for (s32 i = 0; i < tournament.threadCount; i++)
+        {
+            const Tally& tally = tournament.threads[i].tallies[e];
+
+            for (s32 n = 0; n <= maxGuesses; n++)
+                standing.wins[n] += tally.wins[n];
+
+            standing.games += tally.games;
+            standing.losses += tally.losses;
+            standing.totalGuesses += tally.totalGuesses;
+            standing.worstGuesses = (tally.worstGuesses > standing.worstGuesses) ? tally.worstGuesses : standing.worstGuesses;
+            standing.cpuSeconds += tally.cpuSeconds;
+        }
+    }
+
+    for (s32 i = 0; i < tournament.threadCount; i++)
+        results.steals += tournament.threads[i].steals;
+
+    // Insertion sort, there are only a handful of entrants
+    for (s32 i = 1; i < results.entrantCount; i++)
+    {
+        Standing standing = results.standings[i];
+
+        s32 j = i;
+        for (; j > 0 && IsBetter(standing, results.standings[j - 1]); j--)
+            results.standings[j] = results.standings[j - 1];
+
+        results.standings[j] = standing;
+    }
+}
+
+void Shutdown()
+{
+    if (!tournament.block)
+        return;
+
+    PlatformFree(tournament.block);
+
+    tournament.block = nullptr;
+    tournament.threads = nullptr;
+    tournament.queues = nullptr;
+    tournament.threadCount = 0;
+}
+
+} // namespace Tournament
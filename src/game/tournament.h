@@ -0,0 +1,75 @@
+#pragma once
+
+/*
+
+Tournament.
+
+Plays every registered strategy against the whole answer set and ranks
+them. Strategies are registered as Strategies::Strategy functions, so a
+bot only has to be a function that takes a board and returns a guess.
+
+The games are cut into matches of matchSize answers for one entrant.
+Matches from every entrant are interleaved and dealt out evenly to the
+threads of the worker pool up front. A thread that runs out of matches
+steals half of the remaining matches from the thread with the most left,
+so a slow strategy never leaves the other threads idle, and threads only
+touch each other's queues when they run dry.
+
+Each thread keeps its own board, scratch and per entrant tallies (on
+separate cache lines), so nothing is shared while playing and no game
+allocates.
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "strategies.h"
+
+namespace Tournament
+{
+
+constexpr s32 maxEntrants = 16;
+constexpr s32 matchSize = 8;            // Answers per match
+
+struct Standing
+{
+    const char* name;
+
+    u32 games;
+    u32 wins[maxGuesses + 1];           // wins[n] is the number of games won on guess n
+    u32 losses;
+    u32 totalGuesses;                   // Over every game, losses count as maxGuesses
+    s32 worstGuesses;                   // Most guesses a game took, maxGuesses + 1 if any game was lost
+
+    f64 cpuSeconds;                     // Summed over every thread that played for this entrant
+
+    inline f32 GetMeanGuesses() const
+    {
+        return games ? (f32) totalGuesses / games : 0.0f;
+    }
+};
+
+struct Results
+{
+    Standing standings[maxEntrants];    // Best first: fewest losses, then fewest mean guesses
+    s32 entrantCount;
+
+    f64 seconds;                        // Wall time for the whole tournament
+    s32 threadCount;
+    u32 steals;                         // Times a thread ran dry and took matches from another
+};
+
+// The name has to outlive the tournament. Returns false if the field is full.
+bool Register(const char* name, Strategies::Strategy strategy);
+
+// Removes every entrant
+void Clear();
+
+// Plays answers [0, answerCount) with every entrant, answerCount <= 0 plays every answer.
+// Strategies::Init() has to have been called.
+void Run(Results& results, s32 answerCount = 0);
+
+// Frees the per thread scratch
+void Shutdown();
+
+} // namespace Tournament
@@ -0,0 +1,585 @@
+#include "tree_builder.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "core/jobs.h"
+#include "platform/platform.h"
+#include "board.h"
+#include "decision_tree.h"
+#include "feedback_matrix.h"
+#include "packed_word.h"
+#include "scoring.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+namespace TreeBuilder
+{
+
+static constexpr u32 unsolvable = 1u << 30;
+static constexpr s32 levelCount = maxGuesses + 1;
+static constexpr s32 memoWays = 4;           // Entries per bucket
+static constexpr s32 memoLockCount = 1024;
+
+// Candidate set with this many guesses left to find the answer
+struct MemoEntry
+{
+    u64 hash;               // 0 if unused
+    u32 cost;
+    u16 guess;
+    u8  guessesLeft;
+    u8  exact;              // Otherwise cost is only a lower bound
+};
+
+struct Level
+{
+    u16 partition[answersEnd];                  // The node's candidates grouped by feedback
+    u16 binStart[Scoring::feedbackCount + 1];
+    u16 histogram[Scoring::feedbackCount];
+    Scoring::Feedback usedBins[Scoring::feedbackCount];
+
+    s32 order[wordListSize];                    // Guesses worth trying, best first
+    u32 keys[wordListSize];
+};
+
+struct alignas(64) ThreadData
+{
+    Level levels[levelCount];
+
+    u64 nodesSearched;
+    u64 memoHits;
+};
+
+struct Result
+{
+    u32 cost;
+    s32 guess;              // -1 if nothing beat the bound
+};
+
+static struct
+{
+    Settings settings;
+    s32 breadth;
+
+    MemoEntry* memo = nullptr;
+    u64 memoMask = 0;       // Bucket index mask
+    std::mutex locks[memoLockCount];
+
+    void* threadBlock = nullptr;
+    ThreadData* threads = nullptr;
+    s32 threadCount = 0;
+
+    u16 answers[answersEnd];
+
+    // The finished tree
+    DecisionTree::Node* nodes = nullptr;
+    DecisionTree::Edge* edges = nullptr;
+    u32 nodeCount = 0;
+    u32 edgeCount = 0;
+    u32 totalGuesses = 0;
+    u32 maxDepth = 0;
+} builder;
+
+static inline u64 HashSet(const u16* set, s32 count, s32 guessesLeft)
+{
+    u64 hash = 0x9E3779B97F4A7C15ull ^ ((u64) count << 8) ^ (u64) guessesLeft;
+    for (s32 i = 0; i < count; i++)
+    {
+        hash = (hash ^ set[i]) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+
+    // 0 marks empty entries
+    return hash | 1;
+}
+
+static bool FindMemo(u64 hash, MemoEntry& result)
+{
+    u64 bucket = (hash >> 16) & builder.memoMask;
+    MemoEntry* entries = builder.memo + bucket * memoWays;
+
+    std::lock_guard<std::mutex> lock(builder.locks[bucket % memoLockCount]);
+    for (s32 i = 0; i < memoWays; i++)
+    {
+        if (entries[i].hash == hash)
+        {
+            result = entries[i];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void StoreMemo(u64 hash, u32 cost, s32 guess, s32 guessesLeft, bool exact)
+{
+    u64 bucket = (hash >> 16) & builder.memoMask;
+    MemoEntry* entries = builder.memo + bucket * memoWays;
+
+    std::lock_guard<std::mutex> lock(builder.locks[bucket % memoLockCount]);
+
+    // Reuse the entry for this set if there is one, otherwise push out the oldest
+    s32 slot = memoWays - 1;
+    for (s32 i = 0; i < memoWays; i++)
+    {
+        if (entries[i].hash == hash || entries[i].hash == 0)
+        {
+            slot = i;
+            break;
+        }
+    }
+
+    for (s32 i = slot; i > 0; i--)
+        entries[i] = entries[i - 1];
+
+    entries[0].hash = hash;
+    entries[0].cost = cost;
+    entries[0].guess = (u16) guess;
+    entries[0].guessesLeft = (u8) guessesLeft;
+    entries[0].exact = exact;
+}
+
+// Fewest total guesses a set of this size could possibly take
+static inline u32 LowerBound(u32 count, s32 guessesLeft)
+{
+    if (count <= 1)
+        return count;
+
+    if (guessesLeft <= 1)
+        return unsolvable;
+
+    return 2 * count - 1;
+}
+
+static inline bool Contains(const u16* set, s32 count, s32 answer)
+{
+    // Sets are sorted
+    const u16* found = std::lower_bound(set, set + count, (u16) answer);
+    return found != set + count && *found == answer;
+}
+
+// Groups the set by the feedback each answer gives for the guess, keeping each group sorted
+static void Partition(const u16* set, s32 count, s32 guess, Level& level)
+{
+    const Scoring::Feedback* row = FeedbackMatrix::GetRow(guess);
+
+    PlatformZeroMemory(level.binStart, sizeof(level.binStart));
+    for (s32 i = 0; i < count; i++)
+        level.binStart[row[set[i]] + 1]++;
+
+    for (s32 f = 0; f < Scoring::feedbackCount; f++)
+        level.binStart[f + 1] += level.binStart[f];
+
+    // binStart[f] is used as the write cursor, and ends up at the start of bin f + 1
+    for (s32 i = 0; i < count; i++)
+        level.partition[level.binStart[row[set[i]]]++] = set[i];
+
+    for (s32 f = Scoring::feedbackCount; f > 0; f--)
+        level.binStart[f] = level.binStart[f - 1];
+
+    level.binStart[0] = 0;
+}
+
+// Orders guesses by the sum of their squared bin sizes (how many candidates are expected
+// to be left, times count), answers that are still possible first on ties.
+// Returns how many are worth trying, or a perfect guess in perfectGuess.
+static s32 RankGuesses(const u16* set, s32 count, Level& level, s32& perfectGuess, bool& perfectIsCandidate)
+{
+    perfectGuess = -1;
+    perfectIsCandidate = false;
+
+    s32 useful = 0;
+
+    for (s32 g = 0; g < wordListSize; g++)
+    {
+        const Scoring::Feedback* row = FeedbackMatrix::GetRow(g);
+
+        s32 usedCount = 0;
+        u16 largest = 0;
+
+        for (s32 i = 0; i < count; i++)
+        {
+            Scoring::Feedback f = row[set[i]];
+            if (level.histogram[f]++ == 0)
+                level.usedBins[usedCount++] = f;
+        }
+
+        u32 sumSquares = 0;
+        for (s32 i = 0; i < usedCount; i++)
+        {
+            u16 size = level.histogram[level.usedBins[i]];
+            sumSquares += (u32) size * size;
+            largest = size > largest ? size : largest;
+            level.histogram[level.usedBins[i]] = 0;
+        }
+
+        // Learns nothing
+        if (largest == count)
+            continue;
+
+        bool isCandidate = g < answersEnd && Contains(set, count, g);
+
+        if (largest == 1 && (perfectGuess < 0 || (isCandidate && !perfectIsCandidate)))
+        {
+            perfectGuess = g;
+            perfectIsCandidate = isCandidate;
+
+            if (isCandidate)
+                return 0;
+        }
+
+        level.order[useful] = g;
+        level.keys[g] = 2 * sumSquares - isCandidate;
+        useful++;
+    }
+
+    s32 tried = (builder.breadth < useful) ? builder.breadth : useful;
+
+    const u32* keys = level.keys;
+    std::partial_sort(level.order, level.order + tried, level.order + useful,
+                      [keys](s32 a, s32 b) { return keys[a] < keys[b] || (keys[a] == keys[b] && a < b); });
+
+    return tried;
+}
+
+static Result Solve(const u16* set, s32 count, s32 guessesLeft, u32 bound, ThreadData& thread, s32 levelIndex);
+
+// Total guesses for the set when it starts with this guess, or something >= bound if that can't beat bound
+static u32 SolveWithGuess(const u16* set, s32 count, s32 guessesLeft, s32 guess, u32 bound,
+                          ThreadData& thread, s32 levelIndex)
+{
+    Level& level = thread.levels[levelIndex];
+    Partition(set, count, guess, level);
+
+    // Every candidate pays for this guess, then each branch needs at least its lower bound
+    u32 total = count;
+    for (s32 f = 0; f < Scoring::allCorrectFeedback; f++)
+    {
+        u32 binLowerBound = LowerBound(level.binStart[f + 1] - level.binStart[f], guessesLeft - 1);
+        if (binLowerBound >= unsolvable)
+            return unsolvable;
+
+        total += binLowerBound;
+    }
+
+    if (total >= bound)
+        return total;
+
+    for (s32 f = 0; f < Scoring::allCorrectFeedback; f++)
+    {
+        s32 binCount = level.binStart[f + 1] - level.binStart[f];
+        if (binCount <= 1)
+            continue;
+
+        // Swap this branch's lower bound for its real cost, which has to stay under what's left of the bound
+        total -= LowerBound(binCount, guessesLeft - 1);
+
+        Result branch = Solve(level.partition + level.binStart[f], binCount, guessesLeft - 1,
+                              bound - total, thread, levelIndex + 1);
+
+        total += branch.cost;
+        if (total >= bound)
+            return total;
+    }
+
+    return total;
+}
+
+static Result Solve(const u16* set, s32 count, s32 guessesLeft, u32 bound, ThreadData& thread, s32 levelIndex)
+{
+    if (count == 1)
+        return { 1, set[0] };
+
+    if (guessesLeft <= 1)
+        return { unsolvable, -1 };
+
+    if (count == 2)
+        return { 3, set[0] };
+
+    u32 lowerBound = LowerBound(count, guessesLeft);
+    if (lowerBound >= bound)
+        return { lowerBound, -1 };
+
+    thread.nodesSearched++;
+
+    u64 hash = HashSet(set, count, guessesLeft);
+
+    MemoEntry entry;
+    if (FindMemo(hash, entry) && entry.guessesLeft == guessesLeft)
+    {
+        if (entry.exact || entry.cost >= bound)
+        {
+            thread.memoHits++;
+            return { entry.cost, entry.exact ? (s32) entry.guess : -1 };
+        }
+    }
+
+    Level& level = thread.levels[levelIndex];
+
+    s32 perfectGuess;
+    bool perfectIsCandidate;
+    s32 tried = RankGuesses(set, count, level, perfectGuess, perfectIsCandidate);
+
+    // A guess that splits everything apart is the best there is
+    if (perfectGuess >= 0)
+    {
+        u32 cost = perfectIsCandidate ? 2 * count - 1 : 2 * count;
+        StoreMemo(hash, cost, perfectGuess, guessesLeft, true);
+        return { cost, perfectGuess };
+    }
+
+    Result best = { bound, -1 };
+
+    for (s32 i = 0; i < tried; i++)
+    {
+        s32 guess = level.order[i];
+
+        u32 cost = SolveWithGuess(set, count, guessesLeft, guess, best.cost, thread, levelIndex);
+        if (cost < best.cost)
+        {
+            best.cost = cost;
+            best.guess = guess;
+
+            if (cost == lowerBound)
+                break;
+        }
+    }
+
+    StoreMemo(hash, best.cost, best.guess, guessesLeft, best.guess >= 0);
+    return best;
+}
+
+static struct
+{
+    std::atomic<u32> bestCost;
+    u32 costs[wordListSize];
+    s32 order[wordListSize];
+    u32 branchCosts[Scoring::feedbackCount];
+    const Level* level;
+} root;
+
+// Tries root guesses [begin, end), sharing the best total across threads to prune with
+static void SolveRootGuesses(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    ThreadData& thread = builder.threads[threadIndex];
+
+    for (s32 i = begin; i < end; i++)
+    {
+        u32 bound = root.bestCost.load();
+        u32 cost = SolveWithGuess(builder.answers, answersEnd, maxGuesses, root.order[i], bound, thread, 0);
+        root.costs[i] = cost;
+
+        while (cost < bound && !root.bestCost.compare_exchange_weak(bound, cost))
+        {
+        }
+    }
+}
+
+// Solves the opening guess' branches [begin, end) independently
+static void SolveRootBranches(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    ThreadData& thread = builder.threads[threadIndex];
+    const Level& level = *root.level;
+
+    for (s32 f = begin; f < end; f++)
+    {
+        s32 binCount = level.binStart[f + 1] - level.binStart[f];
+
+        root.branchCosts[f] = (f == Scoring::allCorrectFeedback || binCount == 0)
+                            ? 0
+                            : Solve(level.partition + level.binStart[f], binCount, maxGuesses - 1, unsolvable, thread, 1).cost;
+    }
+}
+
+static u32 EmitNode(const u16* set, s32 count, s32 guessesLeft, s32 guess, s32 depth, s32 levelIndex)
+{
+    AssertWithMessage(guess >= 0, "Tried to emit a node that wasn't solved!");
+    AssertWithMessage(builder.nodeCount < DecisionTree::maxNodeCount, "Decision tree has too many nodes!");
+
+    ThreadData& thread = builder.threads[0];
+    Level& level = thread.levels[levelIndex];
+
+    u32 nodeIndex = builder.nodeCount++;
+    DecisionTree::Node& node = builder.nodes[nodeIndex];
+    node.guess = (u16) guess;
+    node.depth = (u8) depth;
+    node.edgeCount = 0;
+    node.firstEdge = builder.edgeCount;
+
+    if (guess < answersEnd && Contains(set, count, guess))
+    {
+        builder.totalGuesses += depth + 1;
+        builder.maxDepth = (u32) (depth + 1) > builder.maxDepth ? depth + 1 : builder.maxDepth;
+    }
+
+    Partition(set, count, guess, level);
+
+    for (s32 f = 0; f < Scoring::allCorrectFeedback; f++)
+        node.edgeCount += level.binStart[f + 1] > level.binStart[f];
+
+    builder.edgeCount += node.edgeCount;
+
+    u32 edge = node.firstEdge;
+    for (s32 f = 0; f < Scoring::allCorrectFeedback; f++)
+    {
+        s32 binCount = level.binStart[f + 1] - level.binStart[f];
+        if (binCount == 0)
+            continue;
+
+        const u16* branch = level.partition + level.binStart[f];
+
+        // Usually a memo hit, but entries can get pushed out on big searches
+        Result result = Solve(branch, binCount, guessesLeft - 1, unsolvable, thread, levelIndex + 1);
+
+        // The branch gets partitioned again one level down, which doesn't touch this level
+        u32 child = EmitNode(branch, binCount, guessesLeft - 1, result.guess, depth + 1, levelIndex + 1);
+        builder.edges[edge++] = DecisionTree::MakeEdge((Scoring::Feedback) f, child);
+    }
+
+    return nodeIndex;
+}
+
+static void Allocate(const Settings& settings)
+{
+    Free();
+
+    u64 memoEntries = 1ull << settings.memoBits;
+    builder.memo = (MemoEntry*) PlatformAllocate(memoEntries * sizeof(MemoEntry));
+    AssertWithMessage(builder.memo, "Couldn't allocate decision tree memo!");
+    PlatformZeroMemory(builder.memo, memoEntries * sizeof(MemoEntry));
+    builder.memoMask = memoEntries / memoWays - 1;
+
+    builder.threadCount = Jobs::GetThreadCount();
+    builder.threadBlock = PlatformAllocate(sizeof(ThreadData) * builder.threadCount + alignof(ThreadData));
+    AssertWithMessage(builder.threadBlock, "Couldn't allocate decision tree scratch!");
+    PlatformZeroMemory(builder.threadBlock, sizeof(ThreadData) * builder.threadCount + alignof(ThreadData));
+
+    u64 aligned = ((u64) builder.threadBlock + alignof(ThreadData) - 1) & ~(u64) (alignof(ThreadData) - 1);
+    builder.threads = (ThreadData*) aligned;
+
+    // Every node either finds an answer or splits its candidates, so there are fewer than 2 per answer
+    builder.nodes = (DecisionTree::Node*) PlatformAllocate(2 * answersEnd * sizeof(DecisionTree::Node));
+    builder.edges = (DecisionTree::Edge*) PlatformAllocate(2 * answersEnd * sizeof(DecisionTree::Edge));
+    AssertWithMessage(builder.nodes && builder.edges, "Couldn't allocate decision tree!");
+}
+
+Results Build(const Settings& settings)
+{
+    AssertWithMessage(FeedbackMatrix::IsLoaded(), "Decision trees need the feedback matrix!");
+    AssertWithMessage(settings.memoBits >= 4 && settings.memoBits < 40, "Memo size is out of range!");
+
+    Allocate(settings);
+
+    builder.settings = settings;
+    builder.breadth = (settings.breadth > 0) ? settings.breadth : wordListSize;
+
+    for (s32 i = 0; i < answersEnd; i++)
+        builder.answers[i] = (u16) i;
+
+    f64 startTime = PlatformGetTime();
+
+    root.bestCost.store(unsolvable);
+
+    s32 openingGuess = settings.openingGuess;
+    u32 totalCost = unsolvable;
+
+    Level& rootLevel = builder.threads[0].levels[0];
+
+    if (openingGuess >= 0)
+    {
+        AssertWithMessage(openingGuess < wordListSize, "Opening guess is not in the word list!");
+
+        // The opening guess' partition has to stay put while branches are solved, so branches start at level 1
+        Partition(builder.answers, answersEnd, openingGuess, rootLevel);
+        root.level = &rootLevel;
+
+        Jobs::ParallelFor(Scoring::feedbackCount, 1, SolveRootBranches, nullptr);
+
+        totalCost = answersEnd;
+        for (s32 f = 0; f < Scoring::feedbackCount && totalCost < unsolvable; f++)
+            totalCost += root.branchCosts[f];
+    }
+    else
+    {
+        s32 perfectGuess;
+        bool perfectIsCandidate;
+        s32 tried = RankGuesses(builder.answers, answersEnd, rootLevel, perfectGuess, perfectIsCandidate);
+
+        PlatformCopyMemory(root.order, rootLevel.order, tried * sizeof(s32));
+
+        // One guess per chunk, whole opening subtrees vary a lot in cost
+        Jobs::ParallelFor(tried, 1, SolveRootGuesses, nullptr);
+
+        for (s32 i = 0; i < tried; i++)
+        {
+            if (root.costs[i] < totalCost)
+            {
+                totalCost = root.costs[i];
+                openingGuess = root.order[i];
+            }
+        }
+    }
+
+    Results results = {};
+    results.solved = totalCost < unsolvable;
+    results.openingGuess = openingGuess;
+
+    if (results.solved)
+    {
+        builder.nodeCount = 0;
+        builder.edgeCount = 0;
+        builder.totalGuesses = 0;
+        builder.maxDepth = 0;
+
+        EmitNode(builder.answers, answersEnd, maxGuesses, openingGuess, 0, 0);
+        AssertWithMessage(builder.totalGuesses == totalCost, "Decision tree doesn't match the search!");
+    }
+
+    results.totalGuesses = builder.totalGuesses;
+    results.maxDepth = builder.maxDepth;
+    results.nodeCount = builder.nodeCount;
+    results.seconds = PlatformGetTime() - startTime;
+
+    for (s32 i = 0; i < builder.threadCount; i++)
+    {
+        results.nodesSearched += builder.threads[i].nodesSearched;
+        results.memoHits += builder.threads[i].memoHits;
+    }
+
+    return results;
+}
+
+bool Save(const char* filepath)
+{
+    AssertWithMessage(builder.nodeCount > 0, "No decision tree was built!");
+
+    return DecisionTree::Save(filepath, builder.nodes, builder.nodeCount, builder.edges, builder.edgeCount,
+                              builder.totalGuesses, builder.maxDepth);
+}
+
+void Free()
+{
+    if (builder.memo)
+        PlatformFree(builder.memo);
+
+    if (builder.threadBlock)
+        PlatformFree(builder.threadBlock);
+
+    if (builder.nodes)
+        PlatformFree(builder.nodes);
+
+    if (builder.edges)
+        PlatformFree(builder.edges);
+
+    builder.memo = nullptr;
+    builder.threadBlock = nullptr;
+    builder.threads = nullptr;
+    builder.threadCount = 0;
+    builder.nodes = nullptr;
+    builder.edges = nullptr;
+    builder.nodeCount = 0;
+    builder.edgeCount = 0;
+}
+
+} // namespace TreeBuilder
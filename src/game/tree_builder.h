@@ -0,0 +1,61 @@
+#pragma once
+
+/*
+
+Tree Builder.
+
+Searches for the decision tree (see decision_tree.h) that solves every
+answer with the fewest total guesses, never taking more than maxGuesses.
+
+The search is a depth first branch and bound:
+
+    - a set of n answers needs at least 2n - 1 guesses (one lucky guess,
+      everything else found on the next one), which bounds each branch
+      before it's explored and lets a guess be dropped as soon as its
+      branches add up to more than the best guess found so far
+    - results are memoized on a hash of the (sorted) candidate set and
+      the guesses left, since the same set is reached through many paths
+    - at the root, guesses (or the opening guess' branches) are split
+      across the worker pool, sharing the best total so far
+
+Trying every allowed guess at every node is exact but takes hours, so
+by default only the most promising guesses at each node are tried,
+ranked by how evenly they split the candidates.
+
+Needs the feedback matrix loaded or built first.
+
+*/
+
+#include "core/types.h"
+
+namespace TreeBuilder
+{
+
+struct Settings
+{
+    s32 breadth = 20;           // Guesses tried at each node, <= 0 tries every allowed guess
+    s32 openingGuess = -1;      // Index into wordList to force the first guess, -1 searches for it
+    s32 memoBits = 22;          // The memo has 2^memoBits entries
+};
+
+struct Results
+{
+    bool solved;
+    u32  totalGuesses;
+    u32  maxDepth;
+    u32  nodeCount;
+    s32  openingGuess;
+
+    u64  nodesSearched;
+    u64  memoHits;
+    f64  seconds;
+};
+
+Results Build(const Settings& settings);
+
+// Writes the last built tree with DecisionTree::Save
+bool Save(const char* filepath);
+
+void Free();
+
+} // namespace TreeBuilder
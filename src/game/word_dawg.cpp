@@ -0,0 +1,131 @@
+#include "word_dawg.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "word_dawg_data.h"
+#include "wordlist.h"
+
+char wordList[wordListSize][6];
+
+namespace WordDawg
+{
+
+s32 FindChild(s32 node, s32 letter)
+{
+    for (s32 e = node; ; e++)
+    {
+        Edge edge = wordDawgEdges[e];
+
+        // Edges are sorted by letter
+        s32 edgeLetter = edge & letterMask;
+        if (edgeLetter == letter)
+            return (s32) (edge >> childShift);
+
+        if (edgeLetter > letter || (edge & lastEdgeFlag))
+            return -1;
+    }
+}
+
+bool IsPrefix(const char* letters, s32 count)
+{
+    s32 node = 0;
+    for (s32 i = 0; i < count && i < wordLength; i++)
+    {
+        if (letters[i] < 'A' || letters[i] > 'Z')
+            return false;
+
+        node = FindChild(node, letters[i] - 'A');
+        if (node < 0)
+            return false;
+    }
+
+    return count <= wordLength;
+}
+
+bool Contains(const char* word)
+{
+    return IsPrefix(word, wordLength);
+}
+
+void Cursor::Reset()
+{
+    nodes[0] = 0;
+    length = 0;
+    validLength = 0;
+}
+
+void Cursor::Push(char letter)
+{
+    if (length >= wordLength)
+        return;
+
+    // Once the prefix is broken, more letters can't fix it
+    if (validLength == length && letter >= 'A' && letter <= 'Z')
+    {
+        s32 child = FindChild(nodes[length], letter - 'A');
+        if (child >= 0)
+        {
+            nodes[length + 1] = child;
+            validLength++;
+        }
+    }
+
+    length++;
+}
+
+void Cursor::Pop()
+{
+    if (length == 0)
+        return;
+
+    length--;
+    validLength = (validLength > length) ? length : validLength;
+}
+
+} // namespace WordDawg
+
+// Depth first walk that writes answers and the other allowed words to their own ends of wordList
+static void DecodeNode(s32 node, char* prefix, s32 depth, s32& answerCount, s32& otherCount)
+{
+    for (s32 e = node; ; e++)
+    {
+        WordDawg::Edge edge = wordDawgEdges[e];
+        prefix[depth] = 'A' + (char) (edge & WordDawg::letterMask);
+
+        if (depth == WordDawg::wordLength - 1)
+        {
+            bool isAnswer = edge & WordDawg::answerFlag;
+            s32 index = isAnswer ? answerCount++ : answersEnd + otherCount++;
+
+            AssertWithMessage(index < wordListSize, "Word DAWG has more words than the list!");
+            for (s32 i = 0; i < WordDawg::wordLength; i++)
+                wordList[index][i] = prefix[i];
+
+            wordList[index][WordDawg::wordLength] = '\0';
+        }
+        else
+        {
+            DecodeNode(edge >> WordDawg::childShift, prefix, depth + 1, answerCount, otherCount);
+        }
+
+        if (edge & WordDawg::lastEdgeFlag)
+            break;
+    }
+}
+
+void BuildWordList()
+{
+    static bool built = false;
+    if (built)
+        return;
+
+    // Edges are visited in letter order, so both halves come out sorted
+    char prefix[WordDawg::wordLength];
+    s32 answerCount = 0;
+    s32 otherCount = 0;
+    DecodeNode(0, prefix, 0, answerCount, otherCount);
+
+    AssertWithMessage(answerCount == answersEnd && answersEnd + otherCount == wordListSize, "Word DAWG doesn't match the list sizes!");
+
+    built = true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/*
+
+Word DAWG.
+
+The word list is stored as a minimized DAWG (directed acyclic word
+graph): a trie where every set of identical suffixes is shared. It's
+generated from the text lists in src/game/words by
+tools/build_word_dawg.cpp into word_dawg_data.h, and BuildWordList()
+decodes it into wordList at startup.
+
+A node is a run of edges sorted by letter, the last one flagged. Each
+edge is a u32:
+
+    bits 0-4    letter (0..25)
+    bit  5      last edge of its node
+    bit  6      the word ending on this edge is an answer (last letter only)
+    bits 7-31   index of the child node's first edge (unused on last letters)
+
+The root node's edges start at index 0.
+
+Besides decoding, the DAWG answers prefix queries in O(length), and a
+Cursor does it one letter at a time as the player types.
+
+*/
+
+#include "core/types.h"
+
+namespace WordDawg
+{
+
+using Edge = u32;
+
+constexpr s32 wordLength = 5;
+
+constexpr u32 letterMask   = 0x1F;
+constexpr u32 lastEdgeFlag = 1u << 5;
+constexpr u32 answerFlag   = 1u << 6;
+constexpr u32 childShift   = 7;
+
+// Node index reached by following the letter (0..25) out of node, or -1 if there's no such edge
+s32 FindChild(s32 node, s32 letter);
+
+// True if some word starts with these letters (uppercase A-Z)
+bool IsPrefix(const char* letters, s32 count);
+
+bool Contains(const char* word);
+
+// Follows the letters of a guess as they're typed, so checking whether
+// it can still become a word costs one edge lookup per key
+struct Cursor
+{
+    s32 nodes[wordLength + 1];  // nodes[i] is where the first i letters lead
+    s32 length;                 // Letters typed
+    s32 validLength;            // How many of those letters are a prefix of some word
+
+    void Reset();
+
+    // Adds an uppercase letter
+    void Push(char letter);
+
+    // Removes the last letter, if there is one
+    void Pop();
+
+    inline bool IsValidPrefix() const
+    {
+        return validLength == length;
+    }
+};
+
+} // namespace WordDawg
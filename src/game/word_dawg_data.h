@@ -0,0 +1,1730 @@
+#pragma once
+
+// Generated by tools/build_word_dawg.cpp from src/game/words, don't edit by hand.
+
+#include "core/types.h"
+
+constexpr s32 wordListSize = 12947;    // All possible allowed guesses
+constexpr s32 answersEnd = 2309;       // These are the words to be picked from
+
+constexpr s32 wordDawgEdgeCount = 13735;
+
+inline constexpr u32 wordDawgEdges[wordDawgEdgeCount] = {
+    0x00000D00, 0x00001A01, 0x00001F02, 0x00002583, 0x00002B84, 0x00003885, 0x00003D06, 0x00004287,
+    0x00004608, 0x00004F89, 0x0000530A, 0x00005A0B, 0x00005E0C, 0x0000640D, 0x0000688E, 0x0000748F,
+    0x00007A90, 0x00007C91, 0x00008012, 0x00008893, 0x00008E14, 0x00009415, 0x00009816, 0x00009C17,
+    0x00009E18, 0x0000A539, 0x0000A900, 0x0000AA81, 0x0000B102, 0x0000B783, 0x0000BE84, 0x0000C185,
+    0x0000C586, 0x0000CA87, 0x0000CC88, 0x0000D309, 0x0000D48A, 0x0000D60B, 0x0000DE8C, 0x0000E48D,
+    0x0000EC0E, 0x0000EC8F, 0x0000F210, 0x0000F291, 0x0000FC92, 0x00010293, 0x00010694, 0x00010A95,
+    0x00010D96, 0x00011197, 0x00011418, 0x00011739, 0x00011A00, 0x00012584, 0x00012F07, 0x00013108,
+    0x00013A8B, 0x00013D8E, 0x00014991, 0x00014C14, 0x00015616, 0x000156B8, 0x00015A00, 0x00016504,
+    0x00016B87, 0x00016E88, 0x0001750B, 0x0001780D, 0x0001788E, 0x00018511, 0x00018893, 0x00018914,
+    0x00019016, 0x00019098, 0x00019539, 0x00019580, 0x00019F84, 0x0001AA07, 0x0001AC08, 0x0001B689,
+    0x0001B70E, 0x0001C311, 0x0001C612, 0x0001C694, 0x0001CF96, 0x0001D118, 0x0001D3B9, 0x0001D400,
+    0x0001D781, 0x0001D882, 0x0001DA83, 0x0001DC84, 0x0001DE85, 0x0001DF06, 0x0001E187, 0x0001E208,
+    0x0001E489, 0x0001E58A, 0x0001E68B, 0x0001ED0C, 0x0001F20D, 0x0001FA0E, 0x0001FB0F, 0x0001FE10,
+    0x0001FE91, 0x00020492, 0x00020793, 0x00020C14, 0x00020E95, 0x00021116, 0x00021297, 0x00021718,
+    0x000219B9, 0x00021A00, 0x00022484, 0x00022D88, 0x00023689, 0x0002378B, 0x00023A8E, 0x00024311,
+    0x00024614, 0x00024D38, 0x00024F80, 0x00025904, 0x00026007, 0x00026208, 0x0002698B, 0x00026C8D,
+    0x00026D8E, 0x00027791, 0x00027B14, 0x00021996, 0x00028338, 0x00028800, 0x00029404, 0x00029E08,
+    0x0002A68E, 0x0002B194, 0x0002B916, 0x0002B9B8, 0x0002C000, 0x0002C081, 0x0002C102, 0x0002C403,
+    0x0002C705, 0x0002C786, 0x0002C907, 0x0002C98A, 0x0002CA8B, 0x0002CC0C, 0x0002CF0D, 0x0002D88E,
+    0x0002DA0F, 0x0002DA91, 0x0002DC92, 0x0002DF93, 0x0002E115, 0x0002E217, 0x0002E439, 0x0002E500,
+    0x0002EF04, 0x0002F687, 0x0002F708, 0x0002FC8D, 0x0002FD0E, 0x00030534, 0x00030C80, 0x00019501,
+    0x00031784, 0x00032007, 0x00032208, 0x00032A8B, 0x00032D0D, 0x00032F8E, 0x00033891, 0x00019512,
+    0x00033B14, 0x00034115, 0x00034216, 0x000342B8, 0x00034680, 0x00035184, 0x00035C08, 0x0003648B,
+    0x0003650E, 0x00037114, 0x00037896, 0x00037938, 0x00037D00, 0x00038981, 0x00038A04, 0x00039407,
+    0x00039488, 0x00039C8D, 0x00039D0E, 0x0003A98F, 0x0003AA14, 0x0003B215, 0x0003B298, 0x0003B6B9,
+    0x0003B700, 0x0003C183, 0x0003C204, 0x0003CB86, 0x0003CD08, 0x0003D60A, 0x0003D68E, 0x0003E114,
+    0x0003E6B8, 0x0003E900, 0x0003EB81, 0x0003EE02, 0x0003F183, 0x0003F485, 0x0003F686, 0x0003FA87,
+    0x0003FC08, 0x0003FD89, 0x0003FE0A, 0x0004000B, 0x0004030C, 0x0004068D, 0x00040A8E, 0x00040F0F,
+    0x00041211, 0x00041A12, 0x00041D13, 0x00041E94, 0x00042515, 0x00042796, 0x00042A97, 0x00042D18,
+    0x00042DB9, 0x00042F00, 0x00043904, 0x00044187, 0x00044588, 0x00044F8B, 0x0004528E, 0x00045D91,
+    0x00046092, 0x00046394, 0x00046C16, 0x00046C98, 0x00047139, 0x00047180, 0x00047408, 0x0004748E,
+    0x000475B4, 0x00047900, 0x00048404, 0x00049007, 0x00049288, 0x00049B0E, 0x0004A694, 0x0004AEB8,
+    0x0004B200, 0x0004BE02, 0x0004C283, 0x0004C384, 0x0004CE07, 0x0004D408, 0x0004DD8A, 0x0004E18B,
+    0x0004E48C, 0x0004E70D, 0x0004EA0E, 0x0004F48F, 0x0004F890, 0x0004F913, 0x0004FC94, 0x00050516,
+    0x000507B8, 0x00050D80, 0x00051904, 0x00052207, 0x00052588, 0x00052D8E, 0x00053911, 0x00053C12,
+    0x00053D94, 0x00054616, 0x00054898, 0x00019539, 0x00054D03, 0x00054E86, 0x00054F87, 0x0005508A,
+    0x0005510B, 0x0005560C, 0x0005590D, 0x0005628F, 0x00056711, 0x00056D12, 0x00057093, 0x00057235,
+    0x00057300, 0x00057A84, 0x00058088, 0x0005898B, 0x00058B0E, 0x00059191, 0x00059314, 0x000594B8,
+    0x00059500, 0x00059F84, 0x0005A707, 0x0005AA08, 0x0005B18E, 0x0005B911, 0x0005BC14, 0x0005BEB8,
+    0x0005C004, 0x0002FC8E, 0x0005C191, 0x0005C238, 0x0005C300, 0x0005CB01, 0x0005CB82, 0x0005CC83,
+    0x0005CD04, 0x0005D405, 0x0005D488, 0x0005D80B, 0x0005D98C, 0x0005DA8E, 0x0005E191, 0x0005E392,
+    0x0005E413, 0x0005E4B4, 0x0005E980, 0x0005EF84, 0x0005F487, 0x0005F508, 0x0005FA0B, 0x0005FA8E,
+    0x00060094, 0x000602B8, 0x00060387, 0x0006040B, 0x000604B1, 0x00060580, 0x00060981, 0x00060B02,
+    0x00060B84, 0x00060D87, 0x00060E08, 0x00060F0B, 0x0006100C, 0x0006108E, 0x00061491, 0x00061592,
+    0x00061694, 0x000618B8, 0x00061980, 0x00061A82, 0x00061B84, 0x00061C87, 0x00061E08, 0x00061F0A,
+    0x00061F8C, 0x0006208D, 0x0006210E, 0x00062291, 0x00062413, 0x00062594, 0x00062638, 0x00062680,
+    0x00062881, 0x00062903, 0x00062B04, 0x00062C07, 0x00062C88, 0x00062E0C, 0x00062F8E, 0x00063211,
+    0x00063312, 0x00063394, 0x00063595, 0x00063618, 0x000620B9, 0x00063682, 0x00063703, 0x00063786,
+    0x0006380E, 0x00063891, 0x000639B2, 0x00063A00, 0x00063B04, 0x00063B85, 0x00063C08, 0x00063C8B,
+    0x00063D0E, 0x00063E91, 0x00063FB3, 0x00064000, 0x00064404, 0x00064506, 0x00064687, 0x00064708,
+    0x0006498B, 0x0006468C, 0x00064B0E, 0x00064C91, 0x00064E34, 0x00064F84, 0x00065088, 0x0006518E,
+    0x00065234, 0x00065303, 0x00065484, 0x00065506, 0x0006038B, 0x0006560C, 0x0006568D, 0x0006578E,
+    0x00065811, 0x00065992, 0x00065A13, 0x00065B15, 0x00060B18, 0x00065BB9, 0x00065C08, 0x00065D14,
+    0x00062C36, 0x00065D84, 0x00065F08, 0x000646AA, 0x00066000, 0x00066401, 0x00066582, 0x00066683,
+    0x00066784, 0x00064685, 0x00066A86, 0x00066C88, 0x0006718A, 0x0006730B, 0x0006758C, 0x0006770E,
+    0x00067B8F, 0x00067C13, 0x00067E14, 0x00063B15, 0x00067FB6, 0x00068000, 0x00068301, 0x00068604,
+    0x00068788, 0x0006468B, 0x00068C0C, 0x00068D0D, 0x00068D8E, 0x0006910F, 0x00069291, 0x00069314,
+    0x00062638, 0x00069400, 0x00069502, 0x00069683, 0x00069704, 0x00069886, 0x00069B08, 0x00069D8A,
+    0x0006468B, 0x00069F8D, 0x0006A18E, 0x0006A392, 0x0006A413, 0x0006A694, 0x0006A715, 0x0006A7B8,
+    0x0006A831, 0x0006A880, 0x0006AB04, 0x00063B06, 0x0006AC87, 0x0006AD08, 0x0006AF0D, 0x0006AF8E,
+    0x0006B10F, 0x0006B391, 0x0006B492, 0x0006B633, 0x0006B734, 0x0006B780, 0x0006B981, 0x0006BA82,
+    0x0006BC83, 0x0006BE04, 0x0006C286, 0x0006C507, 0x0006C588, 0x0006038A, 0x0006208B, 0x0006C88C,
+    0x0006CA0D, 0x0006CB0E, 0x0006CD8F, 0x0006CE91, 0x0006D092, 0x0006D213, 0x0006D414, 0x0006D515,
+    0x00062638, 0x0006D680, 0x0006D702, 0x0006D803, 0x0006D887, 0x0006D908, 0x0006D98A, 0x0006DA8F,
+    0x0006DC12, 0x0006DD93, 0x0006A694, 0x0006DF16, 0x0006E038, 0x0006E080, 0x0006E188, 0x0006468B,
+    0x0006E30C, 0x0006E40E, 0x0006E711, 0x0006E793, 0x000646B4, 0x0006E883, 0x0006E986, 0x0006EB0B,
+    0x0006EC8C, 0x0006ED0D, 0x0006EE11, 0x0006F013, 0x0006F0B7, 0x0006F100, 0x0006F304, 0x00064686,
+    0x0006F488, 0x0006F70E, 0x0006F838, 0x0006F880, 0x00062603, 0x0006FC04, 0x0006FD05, 0x0006FD88,
+    0x0006548C, 0x0006560D, 0x0006FE2E, 0x00062604, 0x0006FF88, 0x0006208B, 0x0007020C, 0x0007032E,
+    0x00070400, 0x00070504, 0x00070586, 0x00063808, 0x0007060E, 0x000706B1, 0x00063800, 0x00070788,
+    0x0006A78B, 0x0007088E, 0x00070A94, 0x00070BB8, 0x00070C80, 0x00070D81, 0x00071002, 0x00071203,
+    0x00062604, 0x00071385, 0x00071486, 0x00071687, 0x00071788, 0x00071A09, 0x00071B8A, 0x00071C8B,
+    0x0007218C, 0x0007220D, 0x0007278F, 0x00072811, 0x00072F12, 0x00073313, 0x00073614, 0x0006F095,
+    0x00073816, 0x00073B18, 0x00073D39, 0x00073E00, 0x00074301, 0x00074382, 0x00074483, 0x00074684,
+    0x00074985, 0x00074A86, 0x00074D08, 0x00074E0A, 0x00074E8B, 0x0007528C, 0x0007540D, 0x0006C50F,
+    0x00075791, 0x00075C12, 0x00075E93, 0x00076195, 0x00076396, 0x000764B9, 0x00076600, 0x00062604,
+    0x0006288E, 0x00076834, 0x00076900, 0x00076A01, 0x00076B82, 0x00076C83, 0x00076E84, 0x00076F85,
+    0x00077086, 0x00077309, 0x0007738A, 0x0007748B, 0x0007770C, 0x0007780D, 0x00077B8E, 0x00077D8F,
+    0x00077E91, 0x00078292, 0x00078413, 0x00078615, 0x00078739, 0x00078800, 0x00079084, 0x00079508,
+    0x0007980E, 0x00079D14, 0x0007A1B8, 0x0007A200, 0x0007A481, 0x0007A602, 0x0007A783, 0x0007A984,
+    0x0007AB05, 0x0007AB86, 0x0007AE87, 0x0007AF88, 0x0007B10A, 0x0007B20B, 0x0007B60C, 0x0007B70D,
+    0x0007BB8E, 0x0007C30F, 0x0007C391, 0x0007C892, 0x0007CB13, 0x0007CD94, 0x0007D115, 0x0007D196,
+    0x0007D517, 0x0007D698, 0x0006F039, 0x0007DA00, 0x0007E204, 0x0007E708, 0x0007EE0E, 0x0007F434,
+    0x0007F780, 0x0007F881, 0x0007FA02, 0x0007FB03, 0x0007FD85, 0x0007FF06, 0x00080007, 0x00080108,
+    0x0006370A, 0x0008028B, 0x0008050C, 0x0008068D, 0x00080B8E, 0x0007C30F, 0x00080C11, 0x00081392,
+    0x00081693, 0x00081A17, 0x00063F98, 0x00081AB9, 0x00081B20, 0x00062083, 0x0006208A, 0x00081C0B,
+    0x00081C91, 0x00081D92, 0x00063713, 0x00067FB6, 0x00060380, 0x00081E01, 0x00082182, 0x00082383,
+    0x00082604, 0x00082705, 0x00082806, 0x00082907, 0x00082988, 0x00082B09, 0x00082C0A, 0x00082C8B,
+    0x0008310C, 0x0008340D, 0x0008388F, 0x00083C91, 0x00084392, 0x00084693, 0x00084814, 0x00084B95,
+    0x00084D16, 0x0006A7B7, 0x00084E00, 0x0007D101, 0x00084F02, 0x00085003, 0x00085188, 0x0008528B,
+    0x0008548D, 0x0008558E, 0x0006370F, 0x00085611, 0x00085992, 0x00085A93, 0x00085BB9, 0x00085C00,
+    0x00086384, 0x00086988, 0x0008708E, 0x00087814, 0x00087CB8, 0x00087E01, 0x00087E83, 0x00062604,
+    0x00087F06, 0x0008800B, 0x0008810C, 0x0008820D, 0x0006380E, 0x0008838F, 0x00088411, 0x00088612,
+    0x00088793, 0x000888B5, 0x00088A00, 0x00089184, 0x00089708, 0x00089A8E, 0x0008A314, 0x0007A1B8,
+    0x0008A5A8, 0x0008A600, 0x0008A981, 0x0008AC02, 0x0008AE03, 0x0008AF84, 0x0008B005, 0x0008B086,
+    0x0008B207, 0x0008B388, 0x0006208A, 0x0008B68B, 0x0008BB0C, 0x0008BF8D, 0x0008C50E, 0x0008CA0F,
+    0x0008CC90, 0x0008CD11, 0x0008D292, 0x0008D413, 0x0008D614, 0x0008DA15, 0x0008DB16, 0x0008DE17,
+    0x0008DF98, 0x0008E1B9, 0x0008E280, 0x0008EB04, 0x0008EF08, 0x0008F40E, 0x0008FA94, 0x0008FF96,
+    0x00090038, 0x00090124, 0x00090181, 0x00090303, 0x0007AB05, 0x00090388, 0x0006370A, 0x0009058B,
+    0x0009088C, 0x0009098D, 0x00090B8F, 0x00090D11, 0x00091312, 0x00091613, 0x00060B15, 0x00063739,
+    0x000918B3, 0x00091900, 0x00063F81, 0x00091982, 0x00065B03, 0x00091A8B, 0x00091B0C, 0x00091C8D,
+    0x00091D12, 0x00091DB3, 0x00091EA0, 0x00062600, 0x00091F01, 0x00091F82, 0x00092103, 0x00092285,
+    0x00092306, 0x00062607, 0x00092408, 0x00065B0A, 0x0009268B, 0x0009288C, 0x00092B0D, 0x00092E91,
+    0x00093412, 0x00093493, 0x00093714, 0x00093A15, 0x00093B16, 0x00093E18, 0x00093FB9, 0x00094000,
+    0x00094481, 0x00094802, 0x00094A03, 0x00094A84, 0x00094E85, 0x00095106, 0x00095208, 0x0009558A,
+    0x0009568B, 0x00095B0C, 0x00095E0D, 0x0009610E, 0x0009618F, 0x00096291, 0x00096792, 0x00096A13,
+    0x00096B14, 0x00096B95, 0x00096D96, 0x000706B7, 0x00096E80, 0x00097008, 0x0009708E, 0x000972B4,
+    0x00097300, 0x00097581, 0x00097602, 0x00097883, 0x00097A84, 0x0008B005, 0x00097C86, 0x00097D8A,
+    0x00097E8B, 0x00097F8C, 0x0009818D, 0x0009858E, 0x0009870F, 0x00098811, 0x00098B12, 0x00098D93,
+    0x00099095, 0x00062C16, 0x00099397, 0x00064698, 0x00099439, 0x00099528, 0x00099580, 0x00099681,
+    0x00099902, 0x00099B03, 0x00099C84, 0x0008B005, 0x00099E86, 0x0009A107, 0x0009A188, 0x0006F009,
+    0x0009A30B, 0x0009A68C, 0x0009A80D, 0x0009AC0E, 0x0009B08F, 0x0009B191, 0x0009B692, 0x0009B813,
+    0x0009B994, 0x0009BF15, 0x0009C016, 0x0009C517, 0x0009C618, 0x0009C739, 0x0009C780, 0x0009CE04,
+    0x0009D288, 0x0009D68E, 0x0009DC14, 0x0009E038, 0x0009E1AE, 0x0009E280, 0x0009E481, 0x0009E502,
+    0x0009E783, 0x0009E884, 0x0009E985, 0x0009EA88, 0x0009EB8A, 0x0009ED0B, 0x0009EF8C, 0x0009F20D,
+    0x0009F60E, 0x0009F68F, 0x0009F811, 0x0009FC92, 0x0009FD93, 0x0009FE15, 0x00063737, 0x0009FE80,
+    0x000A0184, 0x000A02A8, 0x0008AF80, 0x00091E84, 0x000A0388, 0x0006A78A, 0x000A042D, 0x0006F027,
+    0x000A0486, 0x0006208B, 0x0006038D, 0x000A0611, 0x000A0912, 0x000A0A93, 0x000620B5, 0x000A0B81,
+    0x000A0C2E, 0x0008AF80, 0x000A0D07, 0x000A0E0B, 0x000727B1, 0x000A0E84, 0x00093F86, 0x000A0F08,
+    0x000A1134, 0x00069289, 0x000A118D, 0x000A1211, 0x000A12B5, 0x000603A5, 0x0008AF80, 0x000A1384,
+    0x000A1486, 0x0006468C, 0x0009FE31, 0x0006FDA8, 0x000A1583, 0x000A1686, 0x000A178A, 0x0008AF8B,
+    0x000A18B2, 0x000A1904, 0x000A19A8, 0x000A0388, 0x000646AA, 0x000A1A00, 0x000A1B81, 0x000A1C02,
+    0x000A1C83, 0x000A1D84, 0x000A1F05, 0x000A2008, 0x000A220C, 0x000A228E, 0x00060B0F, 0x0006F092,
+    0x000A2414, 0x000A2535, 0x000A2600, 0x000A2701, 0x000A2902, 0x000A2984, 0x000A2B88, 0x000A2D0C,
+    0x000A2E8E, 0x000A308F, 0x000A3114, 0x000A3238, 0x000A3280, 0x000A3403, 0x000A3584, 0x00091A85,
+    0x000A3688, 0x000A3709, 0x0006928B, 0x0006358C, 0x000A378D, 0x000A388E, 0x00087E11, 0x000A3A92,
+    0x000A3C13, 0x000A3D94, 0x000A3E15, 0x000A3EB9, 0x00062611, 0x0006F0B2, 0x000A3F00, 0x00063704,
+    0x000A3F87, 0x000A4088, 0x000A410E, 0x000637B1, 0x000A4334, 0x000A4480, 0x00063681, 0x000A4504,
+    0x000A4606, 0x00072787, 0x000A4688, 0x0006208D, 0x000A478E, 0x000A4891, 0x00063712, 0x000A4994,
+    0x000A4BB5, 0x000A4C82, 0x00065B88, 0x000A4D8A, 0x0006370D, 0x000A4E92, 0x000A4FB3, 0x000A5100,
+    0x00063804, 0x000A5287, 0x000A4088, 0x0006468D, 0x000A5593, 0x000A5694, 0x00060B16, 0x000A0EB8,
+    0x000A5786, 0x0006038A, 0x000A580F, 0x0006F011, 0x00087E32, 0x0006D900, 0x000A5884, 0x000A5A07,
+    0x000A5A88, 0x000A5C2E, 0x000A1384, 0x00082907, 0x000603AA, 0x000A5D00, 0x000A5E82, 0x000A5F04,
+    0x0006EC85, 0x000A6188, 0x000A640E, 0x000A658F, 0x000A6713, 0x000A6834, 0x000A6980, 0x00091E84,
+    0x000A0388, 0x00091D0E, 0x000A6A31, 0x00090128, 0x000A6B81, 0x000A6C82, 0x000A6E03, 0x000A7004,
+    0x00092285, 0x0006F086, 0x000A7108, 0x000A738A, 0x000A748B, 0x0006208C, 0x000A760D, 0x00063990,
+    0x000A7A91, 0x000A7F92, 0x000A8093, 0x000A8394, 0x000A8695, 0x000A8896, 0x00062097, 0x000A8918,
+    0x000620B9, 0x000A8A80, 0x000A8D02, 0x000A8F83, 0x000A9004, 0x000A9387, 0x000A9408, 0x000A958B,
+    0x000A980C, 0x000A9A0D, 0x000A9D0E, 0x000A9E11, 0x000AA192, 0x000AA293, 0x000AA694, 0x00063F95,
+    0x00063F96, 0x000AA818, 0x000AA939, 0x000AAA00, 0x000AAB01, 0x000AAC02, 0x000AAE83, 0x000AB004,
+    0x000AB285, 0x000AB406, 0x0006208A, 0x000AB58B, 0x000ABA8D, 0x000ABE8E, 0x000ABF10, 0x000AC011,
+    0x000AC412, 0x000AC613, 0x000AC815, 0x000AC897, 0x000AC9B9, 0x00065184, 0x000ACA2E, 0x000ACA80,
+    0x000AD284, 0x000AD788, 0x000ADB8E, 0x000AE214, 0x000AE838, 0x000AEA00, 0x000AEB02, 0x000AEC04,
+    0x000AEC86, 0x00063807, 0x000AEF08, 0x000AF10B, 0x0006370C, 0x000AF38D, 0x000AF58E, 0x000AF711,
+    0x000AFC92, 0x000AFD14, 0x000B0095, 0x000B0116, 0x0009C517, 0x000B0238, 0x000B0380, 0x000B0904,
+    0x000B0D88, 0x000B118E, 0x000B1614, 0x00065B38, 0x000B1801, 0x000B1982, 0x000B1A83, 0x000B1B84,
+    0x00092285, 0x000B1C86, 0x00063789, 0x000B1F0B, 0x000B1F8C, 0x000B200D, 0x000B2211, 0x000B2592,
+    0x0006A793, 0x000B2839, 0x00063702, 0x0006208A, 0x0006370B, 0x0008AF91, 0x000B29B3, 0x000B2A01,
+    0x000B2B03, 0x000B2E05, 0x00093F86, 0x000B2E88, 0x0006F009, 0x000B310B, 0x000B340C, 0x000B378D,
+    0x0006260E, 0x000B3B0F, 0x000B3C91, 0x000B4112, 0x000B4313, 0x000B4514, 0x000B4A95, 0x000B4B96,
+    0x000B4E18, 0x000B4FB9, 0x000B5100, 0x000B5301, 0x000B5382, 0x000B5404, 0x000B5588, 0x000B568B,
+    0x000B590C, 0x000B5A8D, 0x000B5E8E, 0x000B5F91, 0x000B6292, 0x000B6393, 0x000B6494, 0x000B6538,
+    0x000B6600, 0x000B6804, 0x000B690E, 0x000B6A38, 0x000B6A80, 0x000B6B01, 0x000B6C83, 0x00091D05,
+    0x000B6D06, 0x000B6F0B, 0x000B720C, 0x000B738D, 0x000B760F, 0x000B7791, 0x000B7B12, 0x000B7C13,
+    0x000B7D14, 0x000B7D95, 0x000B7E39, 0x000B7E80, 0x000B8304, 0x000B8688, 0x000B8B0E, 0x000B9194,
+    0x000B9438, 0x000B9480, 0x000B96AE, 0x000B9780, 0x000B9A01, 0x000B9C03, 0x000B9D84, 0x000B9F85,
+    0x000BA086, 0x000BA188, 0x00063789, 0x000BA28B, 0x000BA50C, 0x000BA68D, 0x000BAB8E, 0x000BB10F,
+    0x000BB211, 0x000BB592, 0x000BB693, 0x000BB814, 0x000BBA96, 0x00063717, 0x000BBDB8, 0x000BBE80,
+    0x000BC584, 0x000BCB08, 0x000BD20E, 0x000BD911, 0x000BDA14, 0x000BDCB8, 0x000BDE80, 0x000BE082,
+    0x00063703, 0x000BE104, 0x0008B005, 0x00064686, 0x000BE188, 0x000BE40B, 0x000BE70C, 0x000BE88D,
+    0x000BEA8F, 0x0006F090, 0x000BEB11, 0x000BEE92, 0x000BF093, 0x000BF1B8, 0x000BF380, 0x00062081,
+    0x00065184, 0x000BF48C, 0x000BF50D, 0x000BF70E, 0x000BF78F, 0x000BF911, 0x00063713, 0x000620B5,
+    0x000BFB00, 0x000BFC01, 0x000BFD82, 0x000BFE83, 0x000C0084, 0x000C0185, 0x000C0306, 0x00064687,
+    0x000C0388, 0x000C0689, 0x000C080A, 0x000C0A0B, 0x000C0F8C, 0x000C120D, 0x000C158E, 0x000C168F,
+    0x000C1891, 0x000C1F12, 0x000C2113, 0x000C2294, 0x000C2615, 0x000C2716, 0x000C2918, 0x000C2A39,
+    0x000C2B00, 0x000C2F01, 0x000C2F82, 0x000C3083, 0x000C3184, 0x000C3305, 0x000C3388, 0x000C3609,
+    0x000C370B, 0x000C3A8C, 0x000C3C8D, 0x00063B0F, 0x000C3F91, 0x000C4512, 0x000C4613, 0x000C4714,
+    0x000B0095, 0x000C4816, 0x000C4917, 0x000603B8, 0x00070600, 0x000C4A82, 0x00093F83, 0x000B6484,
+    0x000C4B06, 0x000C3609, 0x000C4B8A, 0x000C4C8B, 0x0009E48C, 0x000C4F0D, 0x0006378E, 0x000C520F,
+    0x000C5311, 0x000C5392, 0x000C5493, 0x00093F95, 0x000A2239, 0x000C5580, 0x000C5781, 0x000B1982,
+    0x000C5883, 0x00091E84, 0x000C5986, 0x00060387, 0x000C5B88, 0x000C5E0A, 0x000C608B, 0x000C640C,
+    0x000C660D, 0x000C690E, 0x000C6F0F, 0x000C7091, 0x000C7412, 0x000C7513, 0x000C7714, 0x000C7A15,
+    0x000C7A96, 0x00062097, 0x000C7EB8, 0x000C8001, 0x000C4A82, 0x000C8083, 0x00091E84, 0x00092285,
+    0x000C8186, 0x00072787, 0x00064688, 0x000C828B, 0x000C848C, 0x000C878D, 0x000C8911, 0x000C8B92,
+    0x000C8D93, 0x000C8EB9, 0x00062638, 0x000C8F03, 0x000C8F84, 0x000C9006, 0x0006FD88, 0x0006370A,
+    0x000C908B, 0x000C920C, 0x000C930D, 0x0007D10E, 0x000C938F, 0x000C9511, 0x0006A792, 0x000C95B3,
+    0x000C962C, 0x000C96B1, 0x00091E84, 0x000C9707, 0x000C9808, 0x000C998A, 0x0006380E, 0x000C9AB3,
+    0x00070600, 0x000C9C04, 0x000C9D88, 0x00087E8B, 0x000C9E0E, 0x000C9EB8, 0x00063B33, 0x000C9F00,
+    0x00060386, 0x000C9FAB, 0x000CA0B1, 0x000CA100, 0x0006382E, 0x000CA204, 0x000CA308, 0x000CA42B,
+    0x000CA500, 0x000CA701, 0x000CA888, 0x000CA98C, 0x000CAA8F, 0x00093432, 0x000CAD00, 0x000CAE81,
+    0x000CAF82, 0x000CB183, 0x000CB404, 0x000CB505, 0x000CB706, 0x0006A788, 0x000CB88A, 0x000CB98B,
+    0x000CBA8D, 0x000CBB8E, 0x000CBC0F, 0x000CBC91, 0x000CBD12, 0x000CBE13, 0x000CBF94, 0x00063B15,
+    0x000692B6, 0x000CC103, 0x00091C8D, 0x000646B3, 0x0006A7AF, 0x000CC180, 0x000CC288, 0x0006038A,
+    0x000CC3AE, 0x00064681, 0x00063707, 0x000CC48B, 0x0006A38D, 0x000CC512, 0x00065BB3, 0x000CC602,
+    0x000B6484, 0x00065B27, 0x00062088, 0x000CC6AE, 0x00064688, 0x00067F8D, 0x0006A68E, 0x00065BB3,
+    0x000CC700, 0x0006C539, 0x000BF480, 0x00062881, 0x000CC782, 0x00062083, 0x000CC885, 0x000CC986,
+    0x00062608, 0x000CCC0A, 0x000CCC8B, 0x000CCD8C, 0x000CCF8D, 0x000CD10F, 0x000CD211, 0x000CD492,
+    0x0006F013, 0x000CD594, 0x000CD715, 0x000CD816, 0x000CD917, 0x000AC9B9, 0x000CA100, 0x000A1881,
+    0x00063783, 0x000CD984, 0x00082705, 0x000CDB87, 0x000CDC8B, 0x000CDD8C, 0x000CDE8D, 0x0006380E,
+    0x000CDF11, 0x000CE092, 0x000CE213, 0x00090114, 0x000CE3B6, 0x0006E020, 0x0006F000, 0x000CE481,
+    0x000CE585, 0x000CE606, 0x000A5807, 0x000CE70B, 0x000CE80C, 0x000CE90D, 0x000CEA91, 0x000B6492,
+    0x000CEC35, 0x0006D6A0, 0x00062081, 0x000CEC82, 0x000A1883, 0x00080B84, 0x00063807, 0x000CED88,
+    0x000CEE8A, 0x000CEF8B, 0x000CF10C, 0x000CF18D, 0x000C4A8E, 0x000CF311, 0x000CF413, 0x000CF594,
+    0x000CF896, 0x000603B8, 0x000CFA01, 0x0006F002, 0x000CFB03, 0x00084F06, 0x000CFC88, 0x00072789,
+    0x000CFD0A, 0x000CFE0B, 0x000CFE8C, 0x000D000D, 0x00091D8F, 0x000D0191, 0x00091D12, 0x000D0313,
+    0x000706B5, 0x000A0E80, 0x000D0401, 0x000D0502, 0x000D0603, 0x00063985, 0x000D0786, 0x00094A07,
+    0x000D0888, 0x000D0C8A, 0x000D0D8B, 0x000D0F8C, 0x000D118D, 0x0006380E, 0x000D150F, 0x000D1791,
+    0x000D1C12, 0x000D1D13, 0x000D1E94, 0x000D1F95, 0x000D2016, 0x000D2118, 0x000D22B9, 0x000D2381,
+    0x000C4A82, 0x000D2483, 0x000D2504, 0x00063985, 0x000D2987, 0x00091E88, 0x000D2A0B, 0x000D2C8C,
+    0x000D2D8D, 0x0006378F, 0x000D3011, 0x000D3492, 0x000D3593, 0x000D3795, 0x00063717, 0x00065638,
+    0x000D3880, 0x000D3C84, 0x000D3D8E, 0x0008AFB4, 0x000D3F00, 0x000D4081, 0x000BE082, 0x000D4203,
+    0x000D4384, 0x000D4506, 0x000D458A, 0x000D460B, 0x0009E48C, 0x000D498D, 0x000D4D0E, 0x000D4E0F,
+    0x000D4F11, 0x000D5112, 0x000D5293, 0x00064695, 0x000637B6, 0x000D5480, 0x000D5584, 0x000D5608,
+    0x000D578E, 0x000D58B4, 0x000D5980, 0x000D5D04, 0x000D5E88, 0x000D608E, 0x000D64B4, 0x000D6600,
+    0x000D6781, 0x00062604, 0x000D6885, 0x00094A06, 0x000D6987, 0x00090108, 0x00063789, 0x000D6B0A,
+    0x000D6D0B, 0x000D6E0C, 0x000D6E8D, 0x000D700E, 0x000D710F, 0x000D7311, 0x00063712, 0x000D7593,
+    0x0006A6B4, 0x000D7680, 0x000D7A04, 0x000D7B88, 0x000D7C0E, 0x000D7D34, 0x000CD901, 0x000D7E03,
+    0x00063785, 0x000A1886, 0x00064688, 0x000D7F8A, 0x000D808B, 0x000D818C, 0x000D8291, 0x000D8492,
+    0x000D8513, 0x000727B9, 0x000A6980, 0x000B6A24, 0x0006E024, 0x000D8700, 0x0006F001, 0x000B7D03,
+    0x000D898B, 0x000A320D, 0x0006370F, 0x000CD911, 0x000D8B33, 0x000D8C00, 0x000D8C81, 0x000D8F02,
+    0x000D9003, 0x000D9184, 0x000D9286, 0x000D9387, 0x000D9408, 0x000D970A, 0x000D990B, 0x000D9A0C,
+    0x000D9D0D, 0x000DA00F, 0x000DA211, 0x000DA692, 0x000DA813, 0x000DAB94, 0x000DAF15, 0x000DB116,
+    0x000DB317, 0x000DB418, 0x000DB5B9, 0x000DB780, 0x000A2201, 0x000DBD82, 0x000DBE03, 0x000DBF84,
+    0x000C3305, 0x000DC386, 0x000DC587, 0x000DC688, 0x000DC78C, 0x000DCA0D, 0x0009010E, 0x000DCD8F,
+    0x000DCF91, 0x000DD092, 0x000DD193, 0x000DD314, 0x000DD495, 0x00063796, 0x000DD617, 0x000DD739,
+    0x000DD800, 0x000DD901, 0x000DDA02, 0x000DDB83, 0x000DDC84, 0x000DDF85, 0x000DE086, 0x000DE30A,
+    0x000DE40B, 0x000DE60C, 0x000DEA0D, 0x0006380E, 0x000DEF8F, 0x000DF211, 0x000DF392, 0x000DF593,
+    0x000DF7B5, 0x000DF9A0, 0x000DFA80, 0x000DFE81, 0x000E0102, 0x000E0403, 0x000A6984, 0x000A3085,
+    0x000E0506, 0x00062C07, 0x000E0788, 0x0006370A, 0x000E098B, 0x000E0A8C, 0x000E0B8D, 0x000E0C8E,
+    0x000E120F, 0x000E1311, 0x000E1592, 0x000E1693, 0x000E1A14, 0x000E1E95, 0x000E2016, 0x00062097,
+    0x000E2418, 0x000A2239, 0x00065A00, 0x000E2481, 0x000E2582, 0x000E2783, 0x000E2905, 0x00093F86,
+    0x000E298B, 0x000E2A8C, 0x000E2D0D, 0x000E300F, 0x000E3111, 0x000E3492, 0x000E3713, 0x000E3795,
+    0x00093FB7, 0x000637A4, 0x000E3800, 0x000E3982, 0x000A0388, 0x000E3A8C, 0x0006370D, 0x000E3B91,
+    0x000E3C92, 0x000E3EB3, 0x000E4080, 0x00063701, 0x000E4182, 0x000E4503, 0x00085584, 0x000E4785,
+    0x000E4806, 0x000E4B07, 0x000E4C88, 0x00060D89, 0x000E508A, 0x000E528B, 0x000E570C, 0x000E598D,
+    0x000E5F8F, 0x0008CC90, 0x000E6091, 0x000E6792, 0x000E6B93, 0x000E6F94, 0x000E7415, 0x000E7516,
+    0x000E7717, 0x000E7818, 0x000E7AB9, 0x0006A6A8, 0x000E7B80, 0x0006F001, 0x000E7E82, 0x000E8003,
+    0x000E8184, 0x0008B005, 0x000E8308, 0x000E840A, 0x000E848B, 0x000E888C, 0x000E898D, 0x000E8D0E,
+    0x000E8E11, 0x000E9292, 0x000E9693, 0x000E9994, 0x00062095, 0x00070C96, 0x00070618, 0x000E9A39,
+    0x000E9B2E, 0x000E9B80, 0x000E9D02, 0x000E9F83, 0x000EA184, 0x000EA285, 0x000EA386, 0x000D0C87,
+    0x000EA48A, 0x000EA60B, 0x000EAB0C, 0x000EAC8D, 0x000EB211, 0x000EB612, 0x000EB993, 0x000EBC17,
+    0x000EBDB9, 0x000A93A4, 0x000CA100, 0x000EBE81, 0x000EC082, 0x000EC183, 0x00091E84, 0x0006F005,
+    0x000EC406, 0x000EC507, 0x000EC708, 0x0006F009, 0x0006B48A, 0x000EC90B, 0x000ECC0C, 0x000ECD8D,
+    0x000ED18E, 0x000ED78F, 0x000ED991, 0x000EDE12, 0x000EE013, 0x000EE394, 0x000EE795, 0x000EE896,
+    0x000EEA17, 0x000EEB18, 0x000A0D39, 0x000EEC31, 0x000EEC82, 0x000EEF83, 0x000EF185, 0x000EF286,
+    0x000EF307, 0x000EF388, 0x000C9689, 0x000EF58B, 0x000EF88C, 0x000EFA8D, 0x0006380E, 0x000EFC91,
+    0x000F0092, 0x000F0513, 0x00062097, 0x000F0839, 0x00065BB4, 0x000B6A00, 0x00063B0B, 0x000F090D,
+    0x000F098E, 0x000F0B11, 0x0007D112, 0x000F0B93, 0x0006F037, 0x00063724, 0x000F0C00, 0x000F0D01,
+    0x000F0F82, 0x000F1083, 0x000F1184, 0x0008B005, 0x000F1206, 0x00094A07, 0x000F1388, 0x000F168A,
+    0x000F178B, 0x000F190C, 0x000F1A8D, 0x000F1D8F, 0x000F1F91, 0x000F2312, 0x000F2493, 0x000F2714,
+    0x000F2815, 0x000F2996, 0x000F2A39, 0x000F2B34, 0x000F2B80, 0x000F2E01, 0x000C4A82, 0x00090303,
+    0x000F2E84, 0x000F3186, 0x000F3288, 0x000F348B, 0x000F358C, 0x0006370D, 0x0006380E, 0x000F370F,
+    0x000F3811, 0x00091D12, 0x000F3B13, 0x000F3C94, 0x000F3D95, 0x000F3E96, 0x000F41B7, 0x000F4280,
+    0x000A0E8E, 0x00060B36, 0x000F4402, 0x000F4683, 0x000F4884, 0x000F4A05, 0x000F4B86, 0x0006EC87,
+    0x000F4C8A, 0x0006260B, 0x000F4D0C, 0x000F4E0D, 0x000F508F, 0x000F2990, 0x000F5191, 0x000F5212,
+    0x000F5393, 0x00094A15, 0x00077397, 0x000CA0B9, 0x00081DAE, 0x000A5780, 0x000F5601, 0x000C4A82,
+    0x000F5703, 0x00062604, 0x000C0306, 0x00082907, 0x000F5908, 0x000F5B0B, 0x000F5C8C, 0x000F5E8D,
+    0x000F620E, 0x00094A0F, 0x000F6511, 0x000F6712, 0x000F6793, 0x000F6994, 0x000F6B15, 0x000F6C96,
+    0x000F6E97, 0x000F6FB8, 0x000F7081, 0x000F7182, 0x000F7203, 0x0008B005, 0x0006A386, 0x0006208A,
+    0x000C9E0B, 0x000F748C, 0x000CDE8D, 0x000F7611, 0x000F7833, 0x000F7900, 0x0006FD88, 0x000F7A0B,
+    0x000B940C, 0x000F7AB2, 0x000F7B0A, 0x00060391, 0x000F7C12, 0x000F7D93, 0x00063735, 0x0006FD80,
+    0x000F7E84, 0x000F8088, 0x000EEC09, 0x000F82AE, 0x000F8382, 0x000F8484, 0x000F8507, 0x00065B0A,
+    0x000B0091, 0x000F8613, 0x000657B4, 0x000F8780, 0x000F8883, 0x000F8984, 0x000F8A88, 0x000F8B8E,
+    0x000F8CB8, 0x00080B80, 0x000F8D05, 0x000F8E8B, 0x000F8F33, 0x000B6480, 0x00062084, 0x0006F086,
+    0x000CA087, 0x00085B88, 0x00093F8B, 0x0006D80C, 0x00063731, 0x000F8F88, 0x0006D80C, 0x0009012E,
+    0x00063683, 0x0006560B, 0x000F90AD, 0x000A93A8, 0x000F9180, 0x000A5784, 0x00064691, 0x000646B3,
+    0x000F9283, 0x000F9384, 0x000F9588, 0x000F968B, 0x000F980E, 0x000F98AF, 0x000F7A80, 0x000F9981,
+    0x000F9B04, 0x00091D08, 0x00074E0B, 0x000F9C8E, 0x00074E31, 0x000F9D02, 0x000F9E04, 0x000F9F08,
+    0x0007278A, 0x00067F8B, 0x0006038D, 0x0009FE12, 0x0006D833, 0x00069281, 0x00060387, 0x000FA00C,
+    0x00091D0D, 0x0006038F, 0x000CD911, 0x00063712, 0x0007D113, 0x000620B9, 0x000F8780, 0x000FA084,
+    0x000FA208, 0x0006F00F, 0x0006F092, 0x000FA333, 0x000FA400, 0x000FA601, 0x000FA702, 0x000FA803,
+    0x000A5804, 0x00063705, 0x000FA906, 0x000FAA88, 0x000FAC0B, 0x00065B0C, 0x0006378D, 0x0006F08F,
+    0x00063791, 0x00061013, 0x00094A15, 0x0006F039, 0x00063B02, 0x000A3687, 0x00065B08, 0x000FAD0C,
+    0x00063692, 0x000636B3, 0x000FAE00, 0x00063F87, 0x000FAF33, 0x00069281, 0x000D4502, 0x00063804,
+    0x000FB086, 0x000F2B08, 0x000C4A8B, 0x0006468C, 0x000FB10D, 0x000FB20F, 0x000CD911, 0x000FB392,
+    0x000FB493, 0x000FB7B9, 0x000FB880, 0x0006F304, 0x000FBA08, 0x000FBB0E, 0x00065BB4, 0x000C9582,
+    0x000FBC08, 0x000FBD0B, 0x000FBD8D, 0x00070691, 0x000A2232, 0x00082901, 0x000FBE04, 0x000FBF08,
+    0x000FC08B, 0x00065B33, 0x00091EA4, 0x000FC104, 0x000FC18E, 0x000CD939, 0x000BF380, 0x000FC202,
+    0x000FC503, 0x000FC784, 0x000FC906, 0x000FCB88, 0x000E840A, 0x000FCE0B, 0x000FD20C, 0x000FD28D,
+    0x000FD78E, 0x000FD80F, 0x000FD991, 0x000FE112, 0x000FE413, 0x000FE894, 0x000FEA15, 0x000FEB96,
+    0x00063717, 0x000FEE38, 0x000FEF80, 0x00064681, 0x000FF482, 0x000FF603, 0x000FF804, 0x000FFC06,
+    0x000FFD08, 0x000FFE8A, 0x0010008B, 0x0010040D, 0x000A888E, 0x0010088F, 0x00100A91, 0x00101192,
+    0x00101313, 0x00101596, 0x000E99B8, 0x00101680, 0x00101884, 0x00101A88, 0x00101C0B, 0x00101C8E,
+    0x000D450F, 0x00091D14, 0x00101E38, 0x00101E80, 0x00094A01, 0x00101F02, 0x00102204, 0x00102486,
+    0x0006FD88, 0x0010260A, 0x0010280B, 0x00102B8C, 0x00102C8D, 0x0010310E, 0x0010328F, 0x00103510,
+    0x00103591, 0x00103792, 0x00103A93, 0x000B6494, 0x00103D15, 0x00103D97, 0x00103EB9, 0x00103F80,
+    0x00104484, 0x00104788, 0x0010498E, 0x00104E14, 0x00065B38, 0x00105280, 0x00105381, 0x000BE082,
+    0x00105403, 0x00105684, 0x00105886, 0x00060387, 0x00105A08, 0x00105B8A, 0x00105D0B, 0x0010618C,
+    0x0010640D, 0x0010678E, 0x00106E0F, 0x00106F91, 0x00107392, 0x00107613, 0x00107994, 0x00107D96,
+    0x00062097, 0x00108018, 0x00081AB9, 0x00108180, 0x00108704, 0x00108C88, 0x0010928E, 0x00109D14,
+    0x00109EB8, 0x00109F80, 0x0010A004, 0x0010A087, 0x0006A788, 0x0010A10E, 0x0010A238, 0x0010A301,
+    0x0010A482, 0x0010A603, 0x00091E84, 0x0010A905, 0x0010A986, 0x00064687, 0x000F0909, 0x0010AA8A,
+    0x0010AC8B, 0x0010B10C, 0x0010B28D, 0x0010B60F, 0x0010B811, 0x0010BC92, 0x0010BE13, 0x000A18B9,
+    0x000603AD, 0x00091D00, 0x00091D04, 0x0010BF86, 0x00063808, 0x0006A78B, 0x0006208D, 0x0010C08E,
+    0x0010C191, 0x0010C3B7, 0x0010C4A0, 0x00063783, 0x0008AF88, 0x0010C509, 0x0006C50D, 0x000C96AF,
+    0x0006E021, 0x000A578F, 0x000A0EB1, 0x0010C580, 0x00069281, 0x0010CB84, 0x0010D008, 0x0010D58E,
+    0x0010D911, 0x000B29B8, 0x0010D981, 0x0010DB02, 0x0010DD03, 0x0010DF05, 0x0010E006, 0x0010E307,
+    0x0010E408, 0x0010E809, 0x0010E90A, 0x0010EA8B, 0x0010EC0C, 0x0010EF0D, 0x0010F30F, 0x0010F511,
+    0x0010F612, 0x0010F813, 0x0010FC14, 0x0010FD15, 0x0010FE16, 0x00062097, 0x00110018, 0x001102B9,
+    0x00110380, 0x00110981, 0x00110C82, 0x00111003, 0x00111484, 0x00111885, 0x00111B06, 0x00111F07,
+    0x00112008, 0x00112389, 0x00082C0A, 0x0011248B, 0x0011268C, 0x0011280D, 0x00112C0E, 0x00112D0F,
+    0x00113091, 0x00113212, 0x00113513, 0x000A4494, 0x00113815, 0x00113996, 0x00063717, 0x00063739,
+    0x00113C04, 0x00113D88, 0x00113F0E, 0x00114094, 0x00114138, 0x00114280, 0x00114481, 0x00114602,
+    0x00114803, 0x00114984, 0x00114B05, 0x00114D06, 0x00114F0B, 0x0011500C, 0x0011518D, 0x0011540E,
+    0x0011550F, 0x00115612, 0x00115893, 0x00115A15, 0x00094A18, 0x000646B9, 0x00115B00, 0x00115E81,
+    0x00116082, 0x00116103, 0x00116186, 0x00063707, 0x00116288, 0x00116489, 0x00093F8A, 0x0011658B,
+    0x0011678C, 0x0011690D, 0x00116B8E, 0x000CEC0F, 0x00116F90, 0x00117011, 0x00117212, 0x00117413,
+    0x00117794, 0x00117B95, 0x00117C16, 0x00117F98, 0x00118139, 0x0006D680, 0x00118201, 0x00118502,
+    0x00118603, 0x00118804, 0x00118905, 0x00118986, 0x00118B08, 0x000A578A, 0x00087E8B, 0x00118B8C,
+    0x00118F0D, 0x0011928F, 0x00119391, 0x00119512, 0x001198B3, 0x00062600, 0x0006C501, 0x0006208A,
+    0x000A938C, 0x0008AF8D, 0x00091D0E, 0x00065B2F, 0x000C0300, 0x00119A01, 0x00119D82, 0x00119E83,
+    0x00087E85, 0x0011A206, 0x0011A487, 0x0011A588, 0x00077309, 0x0011AA0A, 0x0011AC0B, 0x0011B18C,
+    0x0011B48D, 0x0006E00E, 0x0011B78F, 0x0011B991, 0x0011BD92, 0x0011BF13, 0x0011C114, 0x0011C495,
+    0x0011C696, 0x00063717, 0x0011C798, 0x00063739, 0x0011CA00, 0x0011D084, 0x0011D187, 0x000F7A08,
+    0x0011D38B, 0x0011D40E, 0x0011D991, 0x0011DC14, 0x00063738, 0x0011E180, 0x0006F0A4, 0x0011E200,
+    0x00063301, 0x0011E582, 0x0011E703, 0x0011E904, 0x00065B05, 0x0011EC06, 0x000D8C07, 0x0011EE08,
+    0x0011F18A, 0x0011F28B, 0x0011F50C, 0x0011F60D, 0x0011FB0F, 0x0011FD11, 0x00120212, 0x00120313,
+    0x00120515, 0x00120596, 0x00120717, 0x000A2238, 0x00120800, 0x000A1C02, 0x00121004, 0x00121588,
+    0x00121B8B, 0x00121C8C, 0x00121D8E, 0x00122511, 0x00122713, 0x00122814, 0x00064696, 0x00122B38,
+    0x00062600, 0x00122C01, 0x00122D02, 0x00122E83, 0x00123084, 0x00091D05, 0x00123386, 0x0006F009,
+    0x0012360A, 0x0012370B, 0x00123A8C, 0x00123D0D, 0x0012408F, 0x00124191, 0x00124412, 0x00124613,
+    0x00065B15, 0x00124897, 0x00124A39, 0x00124B00, 0x00124E84, 0x00125488, 0x0011D38B, 0x00125A0E,
+    0x00125E11, 0x00125F14, 0x00126138, 0x00126300, 0x00126A84, 0x00126D88, 0x0012728E, 0x00127A14,
+    0x00127EB8, 0x00128000, 0x00128384, 0x00128708, 0x0012888E, 0x00128D34, 0x00128F00, 0x00129484,
+    0x00129788, 0x00129C0E, 0x0012A114, 0x00063738, 0x0012A380, 0x0012A581, 0x0012A682, 0x0012A883,
+    0x0012AA85, 0x0012AB86, 0x000B5307, 0x000F5188, 0x0012AC89, 0x0012AD8A, 0x0012AF0B, 0x0012B28C,
+    0x0012B30D, 0x0012B78E, 0x0012BA8F, 0x0012BC91, 0x0012C113, 0x0012C214, 0x0012C716, 0x0012CC18,
+    0x0006F0B9, 0x0012CD80, 0x0012D604, 0x0012DC08, 0x0012E20B, 0x0012E38E, 0x0012E791, 0x0012EA14,
+    0x0012EE38, 0x0012EF34, 0x0012F080, 0x0012F984, 0x0012FF88, 0x0013040E, 0x00130D11, 0x00130F94,
+    0x00131438, 0x00131680, 0x00131701, 0x00131902, 0x00131A83, 0x00131C04, 0x00131E06, 0x000B5307,
+    0x00131F88, 0x00060B09, 0x0013210A, 0x0013220B, 0x0013250C, 0x0013278D, 0x0013298F, 0x00132A91,
+    0x00132E12, 0x00132FB3, 0x00133100, 0x00133784, 0x00133B88, 0x0013418E, 0x000A03B4, 0x00134501,
+    0x00134682, 0x00063804, 0x000AC80A, 0x0013478B, 0x00063B0C, 0x0013490D, 0x00134B8F, 0x00134C91,
+    0x00074312, 0x000C9593, 0x00065B35, 0x00134E00, 0x00134F01, 0x00135202, 0x00062604, 0x00135585,
+    0x00135686, 0x00135787, 0x00135888, 0x00063709, 0x00135C0A, 0x00135E8B, 0x0013630C, 0x0013658D,
+    0x0013690F, 0x00136B91, 0x00137092, 0x00137313, 0x00137694, 0x00137995, 0x00137A96, 0x00137D97,
+    0x0006A698, 0x00137FB9, 0x00138000, 0x00138502, 0x000B6C83, 0x00138604, 0x0008B005, 0x00138886,
+    0x00091E87, 0x00138988, 0x00138B0B, 0x00138E0C, 0x00138F8D, 0x0013948F, 0x00139691, 0x00139B92,
+    0x00139C93, 0x000C4714, 0x00139E16, 0x00139F37, 0x0013A080, 0x0013A404, 0x0013AB08, 0x0013AE8E,
+    0x0013B211, 0x0013B494, 0x0013B838, 0x0013B880, 0x0013B981, 0x0013BA02, 0x0013BC83, 0x00091E84,
+    0x0013BE05, 0x0013BF86, 0x0013C10A, 0x0013C30B, 0x0013C58C, 0x0013C80D, 0x0013CC0F, 0x0013CD91,
+    0x0013CF93, 0x0013D418, 0x000AA939, 0x0013D500, 0x0013D682, 0x0013D783, 0x00064684, 0x0013D885,
+    0x0013DA06, 0x0006F007, 0x0013DB88, 0x0013DD8A, 0x0013DF0B, 0x0013E20C, 0x0013E50D, 0x0013E90E,
+    0x0013EB0F, 0x00116F90, 0x0013EE11, 0x0013F292, 0x0013F493, 0x0013F614, 0x0013FA16, 0x0013FD17,
+    0x0013FD98, 0x0009C539, 0x0013FE80, 0x00140504, 0x00140B08, 0x0014128E, 0x00141A94, 0x00141EB8,
+    0x00142100, 0x0006038A, 0x00142234, 0x00142280, 0x00142401, 0x000C4A82, 0x00142585, 0x0006A686,
+    0x00142708, 0x0014288A, 0x0014290B, 0x00142B8C, 0x00142D8D, 0x0014308F, 0x00116F90, 0x00143211,
+    0x00143612, 0x00143713, 0x00063717, 0x00065B38, 0x00143900, 0x00143C04, 0x00143D88, 0x00065B0E,
+    0x00065B38, 0x00144204, 0x00144308, 0x0006370A, 0x00065B0B, 0x000BF48C, 0x0014440D, 0x0014450F,
+    0x00144811, 0x000C95B3, 0x00062600, 0x00063F83, 0x0006382E, 0x00065780, 0x000603A6, 0x00062C0B,
+    0x001449B4, 0x000E99A0, 0x00144A00, 0x00063F82, 0x000A0E84, 0x0006F08C, 0x00144B0D, 0x00062C0F,
+    0x00144B93, 0x00064695, 0x000CD918, 0x000CD939, 0x00144C00, 0x00144C81, 0x00144E88, 0x00144F0C,
+    0x0014500F, 0x000F0931, 0x00145200, 0x00145401, 0x00145602, 0x00145903, 0x0008FF84, 0x00145B85,
+    0x00145C86, 0x00145E87, 0x00145F88, 0x000CA089, 0x0014618A, 0x0014628B, 0x0014640C, 0x0014658F,
+    0x00146711, 0x00146812, 0x00146993, 0x00146A96, 0x00146C39, 0x00146C81, 0x00146D83, 0x00146E84,
+    0x000EEC09, 0x00146F0B, 0x000FBD8F, 0x00147091, 0x00147192, 0x00147233, 0x00147380, 0x00147681,
+    0x00060B03, 0x00147804, 0x00093F86, 0x00147A08, 0x00062C0C, 0x00147B8D, 0x0006038F, 0x00147C92,
+    0x000D6E14, 0x000646B5, 0x00147E00, 0x00091E84, 0x00063F87, 0x000A0388, 0x000B008D, 0x00116F90,
+    0x00147EB4, 0x000D8C04, 0x00065988, 0x00063FB3, 0x000D1F84, 0x0006E034, 0x000D2982, 0x00062083,
+    0x00147F86, 0x00148088, 0x0014818A, 0x0014828B, 0x0014858C, 0x0014860D, 0x0014880F, 0x00148991,
+    0x00148D12, 0x00148E93, 0x00148F94, 0x000B2996, 0x00063737, 0x00149180, 0x00149204, 0x00149386,
+    0x000A9387, 0x00149588, 0x0014968B, 0x0014990D, 0x00149D11, 0x0014A012, 0x00091893, 0x0014A117,
+    0x000639B9, 0x0014A200, 0x0014A301, 0x0014A382, 0x0014A503, 0x0014A584, 0x0014A685, 0x0014A786,
+    0x0014A90B, 0x000A220C, 0x0014AA8D, 0x0014AE0E, 0x00063F8F, 0x0014AE91, 0x0014B212, 0x0014B513,
+    0x0014B715, 0x0014B917, 0x0014B9B9, 0x00063784, 0x00063708, 0x000C032E, 0x00091E80, 0x0014BA82,
+    0x0014BB83, 0x000A0E84, 0x0014BD86, 0x0014BE88, 0x0014C08B, 0x0014C30C, 0x00087E93, 0x0014C414,
+    0x0014C596, 0x000A1897, 0x0014C639, 0x0006D800, 0x00062608, 0x0014C6AE, 0x0014C806, 0x0014C90B,
+    0x0014CAB3, 0x000A03A8, 0x000A4080, 0x0014CB02, 0x0014CB83, 0x0014CE05, 0x0014CF86, 0x0014D187,
+    0x0014D208, 0x0014D60A, 0x0014D78B, 0x000CFD0C, 0x0014DA8D, 0x0008B010, 0x0014DE91, 0x0014E392,
+    0x0014E613, 0x0014E814, 0x0014EA95, 0x0014EB16, 0x0009C717, 0x00060398, 0x0014ECB9, 0x0014ED80,
+    0x0014F001, 0x000D4502, 0x0014F103, 0x0014F204, 0x0014F605, 0x0014F688, 0x0006468A, 0x0014F98B,
+    0x0009758C, 0x0014FC8D, 0x0014FE91, 0x00091D12, 0x0014FF93, 0x000620B7, 0x00150080, 0x00150484,
+    0x00150908, 0x00150F8E, 0x00151314, 0x0008A5B8, 0x00151402, 0x00151503, 0x00151704, 0x00151785,
+    0x00151906, 0x0006378A, 0x00151A8B, 0x00151E8C, 0x00151F0D, 0x00093F8F, 0x00152311, 0x00152412,
+    0x00152613, 0x00093F95, 0x000C2F39, 0x00152880, 0x000C4A82, 0x000C9003, 0x00152985, 0x00072789,
+    0x00152A0A, 0x00152B0B, 0x00152D0C, 0x00152F0D, 0x0015308E, 0x00153511, 0x00153894, 0x0014B915,
+    0x00153996, 0x000A2237, 0x00153A00, 0x00153D04, 0x00153F08, 0x0015418E, 0x000A0394, 0x00122B38,
+    0x00154383, 0x0006260B, 0x000B7D11, 0x00154492, 0x000636B7, 0x0006208B, 0x0015460D, 0x000620B3,
+    0x00154701, 0x0015478D, 0x001548B1, 0x00080BA0, 0x00154A0B, 0x00154CB2, 0x00091E80, 0x00154D01,
+    0x00154E02, 0x0008B005, 0x00154F86, 0x0014D187, 0x000ABE88, 0x0015508A, 0x0006370B, 0x0015518C,
+    0x0015530D, 0x0015540F, 0x00155511, 0x00063713, 0x00155994, 0x00155B36, 0x000705AE, 0x0006320B,
+    0x00146EAE, 0x00063231, 0x00155D00, 0x00156002, 0x00063703, 0x00156104, 0x000C0306, 0x0015620B,
+    0x0015648D, 0x00156511, 0x00156692, 0x00156813, 0x000BE094, 0x000C2F15, 0x000A2216, 0x000620B7,
+    0x000705A4, 0x00156904, 0x0006208A, 0x0006260B, 0x0015698D, 0x00156A0F, 0x00156B11, 0x000706B3,
+    0x000B6484, 0x00156D08, 0x0006372A, 0x00156D8E, 0x0006372F, 0x00156E01, 0x000C4A82, 0x00156E83,
+    0x00157006, 0x00157208, 0x00062C09, 0x0015728A, 0x000BE08B, 0x0015738C, 0x0015748D, 0x0015758E,
+    0x00157691, 0x00157814, 0x00157AB6, 0x00157C80, 0x00070604, 0x00157D08, 0x00157DAD, 0x000A93A0,
+    0x000B7D2E, 0x00063800, 0x00157E02, 0x00091D05, 0x00064686, 0x00157F8A, 0x0015810B, 0x0015820C,
+    0x0015830F, 0x00158411, 0x000727B9, 0x0006A681, 0x000C4A82, 0x00158488, 0x0006C50A, 0x0015858C,
+    0x0015870D, 0x0007C30F, 0x00158891, 0x00063793, 0x00063717, 0x0006F098, 0x000A2239, 0x00062600,
+    0x00158981, 0x00064683, 0x00063808, 0x000A198D, 0x00158B11, 0x000A3092, 0x00064693, 0x00063717,
+    0x00063739, 0x000B7E2E, 0x000EEC01, 0x0008B005, 0x00062C06, 0x00158C8B, 0x000C960C, 0x00158E0D,
+    0x0015900F, 0x000CA091, 0x00063793, 0x001590B9, 0x001591AE, 0x000B0080, 0x000D0781, 0x00159202,
+    0x00159284, 0x00159308, 0x0007218C, 0x0015938D, 0x0015958E, 0x0015988F, 0x00159911, 0x000C4A94,
+    0x00159A36, 0x0007278B, 0x00159B0F, 0x0008B011, 0x0011D3B9, 0x00159C06, 0x00061FAC, 0x00159D24,
+    0x00159DA8, 0x00159E06, 0x00159DB3, 0x00159E82, 0x0015A085, 0x0015A10A, 0x0015A18C, 0x00159D0D,
+    0x0015A212, 0x0015A393, 0x0015A138, 0x0015A400, 0x0015A484, 0x0015A62E, 0x0015A6A4, 0x0015A700,
+    0x0015A68B, 0x0015A411, 0x0015A433, 0x0015A82E, 0x0015A383, 0x0015A424, 0x0015A884, 0x0015AAAE,
+    0x0015AB27, 0x0015A383, 0x0015AB87, 0x0015AC08, 0x0015A10C, 0x0015AC8E, 0x0015AD11, 0x0015A614,
+    0x0015A3B5, 0x0015AE80, 0x0015AFA8, 0x0015B104, 0x0015A0A8, 0x0015B18D, 0x0015A392, 0x0015A413,
+    0x0015B2B9, 0x0015A404, 0x0015B332, 0x0015A408, 0x00159DB1, 0x0015A400, 0x0015B12E, 0x0015B411,
+    0x0015A133, 0x0015B500, 0x0015B584, 0x0015AB2E, 0x0015B683, 0x0015B7AD, 0x0015B8A4, 0x0015A404,
+    0x0015B9A8, 0x0015B5A4, 0x0015BA02, 0x00159D0B, 0x0015BAB1, 0x0015B584, 0x0015BB08, 0x0015A42E,
+    0x00159D04, 0x0015AC88, 0x0015BBAE, 0x0015A3B3, 0x0015A42B, 0x0015A386, 0x0015A60F, 0x0015A416,
+    0x0015A438, 0x0015A0AE, 0x0015BC80, 0x0015BD04, 0x0015AB08, 0x0015A6AB, 0x0015AB84, 0x0015A62F,
+    0x0015ACA0, 0x0015BE04, 0x0015A40E, 0x0015A433, 0x0015AC80, 0x0015AC84, 0x0015BEA8, 0x0015C001,
+    0x0015A60F, 0x0015C111, 0x0015AC96, 0x0015A6B9, 0x00159D00, 0x00159D24, 0x0015ABB4, 0x00159D8A,
+    0x0015A60B, 0x0015B98D, 0x0015A0B2, 0x0015AAA4, 0x0015A133, 0x0015A128, 0x0015A424, 0x0015A428,
+    0x0015A42D, 0x0015A688, 0x0015A42E, 0x0015B528, 0x00159D0B, 0x0015C231, 0x0015B520, 0x0015C328,
+    0x0015A3B1, 0x0015C3A0, 0x0015A60E, 0x0015A691, 0x0015C434, 0x0015A088, 0x0015A42E, 0x0015A824,
+    0x0015BA88, 0x0015C48C, 0x0015A38F, 0x0015A411, 0x0015A092, 0x0015A393, 0x0015A695, 0x0015A6B9,
+    0x0015C58D, 0x0015A431, 0x0015B504, 0x0015A688, 0x0015C6B1, 0x0015A420, 0x0015C80B, 0x0015C90D,
+    0x0015A40E, 0x0015C992, 0x0015A133, 0x0015CA84, 0x0015CC0E, 0x0015A434, 0x0015A686, 0x0015CD0D,
+    0x00159D2E, 0x0015A384, 0x0015CE88, 0x0015A42E, 0x0015B584, 0x0015A10D, 0x00159DB3, 0x0015CF80,
+    0x0015A0AD, 0x00159E06, 0x0015D0AD, 0x00159D2B, 0x0015AC0B, 0x0015BE31, 0x0015A400, 0x0015D204,
+    0x0015D3AE, 0x0015B131, 0x0015A400, 0x0015A0A7, 0x0015BD24, 0x0015A684, 0x0015A126, 0x00159DAB,
+    0x0015BD04, 0x0015A40D, 0x0015D4B3, 0x0015A3AB, 0x00159E02, 0x0015A434, 0x0015B524, 0x0015A6AB,
+    0x0015A404, 0x0015A135, 0x0015A126, 0x0015A404, 0x0015A10B, 0x0015A6AD, 0x0015D58D, 0x0015A133,
+    0x0015A180, 0x0015BA02, 0x0015AB0C, 0x0015D60D, 0x0015C20F, 0x0015D891, 0x0015A693, 0x0015A438,
+    0x0015A400, 0x0015A684, 0x0015D9B4, 0x00159D08, 0x0015A42E, 0x0015DA04, 0x0015AC2E, 0x0015DB02,
+    0x0015DC05, 0x00159E0F, 0x0015A611, 0x0015A416, 0x0015A6B8, 0x0015DD00, 0x0015DE88, 0x0015B50E,
+    0x0015ABB4, 0x0015A400, 0x0015DF81, 0x0015BA84, 0x0015A405, 0x0015BA86, 0x0015A38A, 0x0015A68D,
+    0x0015A092, 0x0015A395, 0x0015A138, 0x0015A688, 0x0015A40E, 0x0015E038, 0x0015E100, 0x0015E184,
+    0x0015A408, 0x0015E30E, 0x0015AC38, 0x0015D480, 0x0015D484, 0x0015E534, 0x0015A403, 0x0015B584,
+    0x0015A605, 0x0015A107, 0x0015AC88, 0x0015E60D, 0x0015E70E, 0x0015BB14, 0x0015A6B6, 0x0015E827,
+    0x0015A800, 0x0015A804, 0x0015AB07, 0x0015A42E, 0x0015A10B, 0x0015A40C, 0x0015A6B1, 0x0015B120,
+    0x0015A407, 0x0015AC88, 0x0015E892, 0x0015A693, 0x0015A094, 0x0015A3B9, 0x0015AC80, 0x0015A804,
+    0x0015A088, 0x0015A38B, 0x0015A40E, 0x0015B131, 0x0015A101, 0x0015B504, 0x0015E92D, 0x0015A400,
+    0x0015EB02, 0x0015EC03, 0x0015A404, 0x0015ED86, 0x0015EC0D, 0x0015A411, 0x0015E892, 0x0015E133,
+    0x0015AC80, 0x0015EEAE, 0x0015EFA8, 0x0015A40A, 0x0015A68B, 0x0015C90D, 0x0015A091, 0x0015B514,
+    0x0015A695, 0x0015A0B6, 0x00159D04, 0x0015F10B, 0x0015AC34, 0x0015A0A8, 0x0015BA02, 0x0015A3B2,
+    0x0015A10D, 0x0015A133, 0x0015AB07, 0x0015A68B, 0x0015ACAE, 0x0015AB31, 0x0015B500, 0x0015A68B,
+    0x0015A0AD, 0x0015A400, 0x0015F204, 0x0015C00B, 0x0015E111, 0x0015A632, 0x00159E06, 0x0015F30B,
+    0x0015F40C, 0x0015AC8E, 0x0015A6B2, 0x0015B504, 0x0015A407, 0x0015A38B, 0x0015A434, 0x0015F580,
+    0x0015C304, 0x0015E10E, 0x0015C434, 0x0015A400, 0x0015A383, 0x0015A68B, 0x0015B12C, 0x0015A6A0,
+    0x0015F700, 0x0015B584, 0x0015F888, 0x0015B191, 0x0015B132, 0x0015A131, 0x0015C428, 0x0015ACAE,
+    0x0015E833, 0x0015A682, 0x0015A686, 0x00159D08, 0x0015A611, 0x0015B5B8, 0x0015BA00, 0x0015BA04,
+    0x0015F9B1, 0x0015FB28, 0x0015AC80, 0x0015C90D, 0x0015AC0E, 0x0015FC32, 0x0015E824, 0x0015F303,
+    0x0015A18E, 0x0015A0B1, 0x0015FD00, 0x0015AC04, 0x0015F10B, 0x0015AB11, 0x0015FE34, 0x0015A404,
+    0x0015BAAE, 0x0015A404, 0x0015A408, 0x0015A42E, 0x0015BD04, 0x0015E12B, 0x0015F320, 0x0015A101,
+    0x0015A40A, 0x0015A68C, 0x0015A431, 0x0015A400, 0x0015A82E, 0x00159D04, 0x00159D87, 0x0015A40E,
+    0x0015A434, 0x0015FF04, 0x0015A80E, 0x00159DB1, 0x0015FF80, 0x0015A102, 0x00160203, 0x0015B105,
+    0x0015B988, 0x0016030D, 0x0015A10F, 0x0015A691, 0x00160433, 0x00160580, 0x0015AC08, 0x0015A68B,
+    0x0016068E, 0x00160834, 0x0015A0A0, 0x0015A400, 0x0015AC04, 0x00159D8A, 0x0015A40B, 0x0015A08E,
+    0x00160932, 0x00160A04, 0x0015AC08, 0x0015A82E, 0x0015A400, 0x0015A0B4, 0x0015A101, 0x0015A107,
+    0x00159D08, 0x0015E80C, 0x0015A3B2, 0x0015A400, 0x0015ACA4, 0x00160B80, 0x0015A084, 0x0015A408,
+    0x00160D2E, 0x00160E04, 0x0015A408, 0x0015BAAE, 0x0015AC00, 0x0015AC04, 0x00160F88, 0x0015E132,
+    0x0015A687, 0x0015A42C, 0x0015AC00, 0x0015A684, 0x0015A42E, 0x0015A12D, 0x0016108E, 0x0015A434,
+    0x0015B9A8, 0x001611A4, 0x0015A3A3, 0x00161384, 0x0015D3AE, 0x00161504, 0x00161608, 0x0015AB31,
+    0x00161780, 0x00161904, 0x0015A0AE, 0x0015B504, 0x0015B508, 0x0015ACB4, 0x0015B100, 0x0015ABA8,
+    0x0015A12B, 0x0015A40F, 0x0015B137, 0x00159D86, 0x0015A08B, 0x0015B12C, 0x0015EE80, 0x0015A42E,
+    0x0015A402, 0x0015F30A, 0x0015C40B, 0x0015B68C, 0x00161A8D, 0x0015B12F, 0x00161BA8, 0x00161C80,
+    0x00161DA8, 0x00159D00, 0x00161E28, 0x0015B504, 0x0015A087, 0x0015A834, 0x0015A400, 0x0015B988,
+    0x0015D3AE, 0x0015AC28, 0x0015A404, 0x00161F33, 0x00162000, 0x0015D384, 0x00160F88, 0x0015ABB4,
+    0x0015A42E, 0x0015ACA8, 0x0015C408, 0x0015A68B, 0x0015A08D, 0x0015A0B2, 0x0015A40B, 0x0015A40D,
+    0x00162231, 0x0015BA80, 0x0015A68D, 0x0015AC8E, 0x00162312, 0x0015A6B9, 0x0015BB08, 0x0015A436,
+    0x0015A6B9, 0x0015A608, 0x0015A38A, 0x00162411, 0x00162592, 0x0015AB13, 0x0015A695, 0x0015A438,
+    0x0015AC04, 0x0015AB33, 0x0015C434, 0x0015D5AD, 0x0015A38A, 0x0015A40B, 0x0015BA31, 0x0015C400,
+    0x0015F30B, 0x0015D58D, 0x0016260E, 0x0015A6B3, 0x0015AC80, 0x0015ACA4, 0x00159D08, 0x0015F32D,
+    0x0015A407, 0x0015A138, 0x0015A1AB, 0x0015A6B1, 0x0015A0AD, 0x0015A404, 0x0015A6A8, 0x00162303,
+    0x0015A6AD, 0x0015B988, 0x0015A68B, 0x0015A40D, 0x00162733, 0x00159D8A, 0x00162831, 0x0015B106,
+    0x0015F32C, 0x00159D04, 0x0015A42B, 0x0015A400, 0x00162984, 0x0015A10A, 0x0015AB0E, 0x001629B4,
+    0x00162A82, 0x0015C207, 0x0015A40A, 0x0015BAAE, 0x0015B103, 0x0015A386, 0x0015E12B, 0x0015B685,
+    0x0015A433, 0x0015C404, 0x0015E106, 0x0015A407, 0x0015A6A8, 0x0015A413, 0x0015DC34, 0x0015A40B,
+    0x0015AC91, 0x0015A112, 0x0015D493, 0x0015B1B9, 0x0015AC80, 0x0015C491, 0x0015A434, 0x00162C04,
+    0x0015A131, 0x0015A400, 0x0015B683, 0x0015D204, 0x0015B68A, 0x0015B68B, 0x00161F0C, 0x0015AB0E,
+    0x0015A112, 0x00159D93, 0x0015EEB4, 0x00159DA1, 0x00162E00, 0x00162F02, 0x00163003, 0x0015B584,
+    0x0015A406, 0x0015A108, 0x00163209, 0x0015A40A, 0x0015A40D, 0x00163293, 0x0015A138, 0x0015A434,
+    0x00163401, 0x0015A102, 0x00163583, 0x00163784, 0x0015D385, 0x0015A386, 0x0015B988, 0x0015B68A,
+    0x0015B68C, 0x0015B68D, 0x0015BA8E, 0x0015A40F, 0x00163911, 0x0015A6B8, 0x00163B00, 0x00163C04,
+    0x0015AB07, 0x00163E08, 0x0015A40A, 0x0015AC8E, 0x00164092, 0x001642B3, 0x00162582, 0x0015B584,
+    0x00160807, 0x0015BA08, 0x0015BA8E, 0x00164533, 0x0015A403, 0x0015A40A, 0x0015BA0B, 0x0015A431,
+    0x00161F03, 0x0015A40A, 0x0015A40B, 0x0015A40D, 0x0015A411, 0x0015B133, 0x00163784, 0x0015A68B,
+    0x0016470E, 0x0015A433, 0x0015B500, 0x0015AB2E, 0x00162582, 0x00161F03, 0x0015B68A, 0x0015A40B,
+    0x0015B68C, 0x0016478D, 0x00164911, 0x0015A612, 0x00164A93, 0x00164C34, 0x0015A1AE, 0x0015A180,
+    0x0015F32A, 0x00159D00, 0x00164D84, 0x0015AB88, 0x0015A6B8, 0x00162582, 0x00159D83, 0x00161F05,
+    0x0015A40F, 0x0015B691, 0x0015A433, 0x0015A608, 0x0015D5AE, 0x00164F00, 0x00165104, 0x0015BA88,
+    0x0015A08E, 0x00165234, 0x00165306, 0x0016542D, 0x00159E20, 0x00165500, 0x00162582, 0x0015A684,
+    0x0015A106, 0x0015A388, 0x0016568B, 0x0016580E, 0x0015A433, 0x0015B580, 0x0015BC88, 0x00159D34,
+    0x00162582, 0x0015B683, 0x0015DC04, 0x0015A106, 0x0015A408, 0x0016590D, 0x001647B3, 0x0015B100,
+    0x00162204, 0x0015A406, 0x00162F0A, 0x0015F30C, 0x0015FF0E, 0x0015E111, 0x00162593, 0x0015AC38,
+    0x00165A80, 0x00165B84, 0x0015A088, 0x0015C98E, 0x0015D3B3, 0x0015A400, 0x00165D04, 0x0015A407,
+    0x00159D08, 0x0015AC8E, 0x00165EB3, 0x00165F84, 0x0015B50E, 0x0015A694, 0x0015B135, 0x0015A084,
+    0x0015D5A8, 0x00166084, 0x0015AC08, 0x0015B139, 0x0015A408, 0x00159D89, 0x0015D58D, 0x0015A433,
+    0x0015A10D, 0x0015A433, 0x00159E02, 0x0015FE2B, 0x0015A401, 0x0015A404, 0x0015A3AB, 0x0015B102,
+    0x001661A4, 0x0015E103, 0x00166284, 0x0015A408, 0x0015ACAE, 0x00159D0B, 0x0015A431, 0x00164785,
+    0x00159D28, 0x0015A680, 0x0015B686, 0x00166487, 0x0015B10B, 0x0016222E, 0x0015BE2E, 0x00163784,
+    0x0015A6A8, 0x00166581, 0x0015B584, 0x00161A86, 0x0015A40A, 0x00161F2B, 0x0015D480, 0x0015AB21,
+    0x0015AC00, 0x0015D383, 0x00166684, 0x00166786, 0x0015A088, 0x0015A40A, 0x0015A433, 0x0015A406,
+    0x0015A38C, 0x0015A08D, 0x0015A133, 0x00159D04, 0x00159D2E, 0x00162582, 0x0015A403, 0x0015A40A,
+    0x0015F30B, 0x0015A40E, 0x0015A411, 0x00165312, 0x001625B3, 0x0015A404, 0x0015A40A, 0x0016522E,
+    0x00166684, 0x0016698E, 0x0015B112, 0x0015CD33, 0x0015A108, 0x0015B135, 0x0015A404, 0x001665B9,
+    0x0015A401, 0x00166A82, 0x00166B03, 0x00166684, 0x00166C85, 0x0015A406, 0x0015A407, 0x0015AC88,
+    0x0016080C, 0x00166D0D, 0x00166E11, 0x00166F12, 0x00160413, 0x00159D14, 0x0015EE96, 0x0015A418,
+    0x0015A3B9, 0x00167080, 0x0015A401, 0x00159E02, 0x00167204, 0x0016738D, 0x0015A091, 0x00167492,
+    0x0015A413, 0x0015A438, 0x0016758C, 0x0016768D, 0x0015A40F, 0x00167492, 0x00167993, 0x0015A6B5,
+    0x0015A600, 0x0015A401, 0x00167B02, 0x0015A406, 0x0015A38A, 0x0015BB0D, 0x00167C0E, 0x0015A691,
+    0x0015A413, 0x00167E36, 0x0015A401, 0x00163403, 0x00167F84, 0x00168205, 0x00159D08, 0x0015A68C,
+    0x0016828D, 0x00168391, 0x001625B2, 0x0015A6AF, 0x0015A401, 0x0015A40A, 0x00168511, 0x0015A612,
+    0x0015A433, 0x00168680, 0x0015E101, 0x001629AE, 0x00168802, 0x0015A687, 0x0015A42A, 0x0015B584,
+    0x0015A686, 0x00159D87, 0x0015A6AB, 0x0015A40F, 0x0015A413, 0x00166CB4, 0x00162F25, 0x0015AC80,
+    0x0015B104, 0x0015B106, 0x0015A688, 0x0015A68B, 0x0015F334, 0x0015A104, 0x0015A42E, 0x0015A40B,
+    0x0016898D, 0x0015A6B3, 0x00168A84, 0x0015A42E, 0x00166680, 0x0015A403, 0x0015A404, 0x0015BC88,
+    0x0015A40B, 0x0015A40E, 0x0015A413, 0x0015A434, 0x0015A400, 0x0015EC21, 0x0015A682, 0x0015A403,
+    0x00168C04, 0x00168E06, 0x0015A688, 0x0015A40A, 0x0016530D, 0x0015E894, 0x0015B1B9, 0x0015FE00,
+    0x00161F01, 0x0015B103, 0x00159D04, 0x0015B105, 0x0015B106, 0x0015A407, 0x0015B68A, 0x0015A40B,
+    0x0015B68C, 0x00168F0D, 0x0015B591, 0x0015C592, 0x00169013, 0x0015F139, 0x0015B12F, 0x00169180,
+    0x0015F303, 0x0015FF84, 0x0015AB06, 0x0015B988, 0x0015A40A, 0x0015A40C, 0x0015C80D, 0x0015AC8E,
+    0x001693B3, 0x0015A688, 0x0015B68A, 0x0016950E, 0x0015E112, 0x0015ACB4, 0x0015A400, 0x00162582,
+    0x00162984, 0x0015B107, 0x00163433, 0x00169606, 0x0015A40A, 0x00166E0B, 0x0015FB0D, 0x00169711,
+    0x00165312, 0x0015A433, 0x00159D28, 0x0015A080, 0x00169884, 0x0015A688, 0x0015A40B, 0x0015A68D,
+    0x0015A411, 0x0015A6B2, 0x00162C04, 0x0015A10B, 0x0015B133, 0x00169B00, 0x00159D04, 0x0015A405,
+    0x0015A406, 0x0015A10B, 0x0015A40E, 0x0015B132, 0x00159D80, 0x00169C02, 0x0015A403, 0x0015A404,
+    0x0015A406, 0x00169E08, 0x00166B0A, 0x0015A68C, 0x00169F8D, 0x0016A212, 0x0015A413, 0x0016A395,
+    0x0016A596, 0x0015B117, 0x0015A418, 0x0015B1B9, 0x0016A700, 0x0015F303, 0x0016A884, 0x0015B588,
+    0x0015A68C, 0x0015DC0D, 0x0015F311, 0x0015A695, 0x0015A416, 0x0015A438, 0x0015A800, 0x0015A381,
+    0x00166A82, 0x0015A383, 0x0016AA84, 0x0015A406, 0x0015D38A, 0x0015AC0B, 0x0015A40C, 0x0016AC0D,
+    0x0015A40E, 0x0016AE92, 0x0016B013, 0x0015A6B9, 0x0015BB00, 0x0016B182, 0x0015A403, 0x0015D486,
+    0x0015C408, 0x0015A38A, 0x0016230C, 0x0016B28D, 0x0016B38E, 0x00165312, 0x00162593, 0x0016B636,
+    0x00159E06, 0x0016B708, 0x0015A68B, 0x0015A68C, 0x0016B80D, 0x0016B912, 0x00160833, 0x0015A413,
+    0x0015A6B9, 0x00162980, 0x0016BA81, 0x0015A434, 0x0015BE07, 0x0016BC2A, 0x0015A400, 0x0015E103,
+    0x0015A386, 0x0015A408, 0x0015A42E, 0x0016BD85, 0x0015A40E, 0x0015B133, 0x0015E106, 0x0015A3AB,
+    0x0015A40B, 0x0015A431, 0x0015A40A, 0x0016C08B, 0x0015A0B2, 0x0015A401, 0x00161A86, 0x00161F0A,
+    0x0016C18B, 0x0015A6B2, 0x0015AB01, 0x0015A405, 0x00164AAF, 0x0015A400, 0x0016C302, 0x0016C483,
+    0x0015B686, 0x0015A108, 0x00165309, 0x00162F0A, 0x00161F0D, 0x0015B693, 0x0015A138, 0x0015A438,
+    0x0015EE80, 0x0015A401, 0x0015A403, 0x0015A084, 0x00159D85, 0x0015D486, 0x0015AC88, 0x0016C78A,
+    0x00161F0B, 0x0016220D, 0x0015AB0E, 0x0015A40F, 0x0015A110, 0x00164791, 0x0016C932, 0x0015B101,
+    0x0015FB04, 0x0015E107, 0x0015B68A, 0x0015BE12, 0x0016CAB3, 0x00162582, 0x00162F04, 0x0015A68B,
+    0x00159E0E, 0x00166B13, 0x0015A094, 0x0015AC38, 0x0015D9AE, 0x0015B139, 0x0015A10D, 0x00159DB9,
+    0x0016CC20, 0x0015A404, 0x0015A42B, 0x00159DB2, 0x00166080, 0x0015E101, 0x0015B504, 0x0015BA88,
+    0x0015A38B, 0x0016CC8E, 0x0015A6B1, 0x00168E00, 0x0015A387, 0x0015B68A, 0x0015DFB3, 0x0015E103,
+    0x00165B84, 0x00165306, 0x0015F308, 0x0015A6B1, 0x0015A102, 0x0015A6B2, 0x0015A404, 0x0015A425,
+    0x00168C04, 0x0015A0AE, 0x0015AAAE, 0x0015A403, 0x0015A40D, 0x0016CDB1, 0x0015AC8E, 0x0015ACB4,
+    0x00160E24, 0x0015A405, 0x0016CE88, 0x0015A40A, 0x0015C20B, 0x0015B68C, 0x0015A40E, 0x0015C20F,
+    0x0015A695, 0x0015BCB8, 0x0015EE80, 0x0016D004, 0x0015A408, 0x0015A40E, 0x0016D18F, 0x0015A434,
+    0x0015C400, 0x0015E103, 0x0016D384, 0x0015A406, 0x00159D08, 0x0016C18D, 0x0015C10E, 0x0016D592,
+    0x001647B3, 0x0015A400, 0x0016D684, 0x0015A407, 0x0015B288, 0x0015A68B, 0x0016D88E, 0x00159D91,
+    0x0016DA34, 0x0016DB00, 0x00164781, 0x0016CA83, 0x0016DC04, 0x00163206, 0x0015A40A, 0x0015F30B,
+    0x0015B68D, 0x0016DE8E, 0x0015D38F, 0x00161F11, 0x0015A692, 0x0016C793, 0x00161AB5, 0x0015A400,
+    0x0015AB02, 0x0015B584, 0x0015B68A, 0x00160813, 0x0015A434, 0x00162582, 0x0016E084, 0x0015E133,
+    0x0015A103, 0x0015A40A, 0x0016E18B, 0x0015A40C, 0x0015A40F, 0x00159D91, 0x0015C832, 0x0015A400,
+    0x0016E304, 0x0016E528, 0x00159D04, 0x0015A42A, 0x0015A392, 0x0015A6B9, 0x0015AC00, 0x0015ABB4,
+    0x0015A800, 0x00163784, 0x0015A428, 0x0015A101, 0x0015D3AB, 0x0015FF04, 0x0016E60B, 0x0015AB8E,
+    0x0015A433, 0x0015A692, 0x0016BC33, 0x0015AC31, 0x00159D82, 0x0015B584, 0x0015A686, 0x0016E808,
+    0x0015A68D, 0x00160F8E, 0x0015B6B3, 0x0015A692, 0x0015C4B3, 0x0015A404, 0x0015AC38, 0x0015A6B5,
+    0x0016E902, 0x00162F03, 0x0016EA85, 0x0016EC08, 0x00167B0B, 0x0016618C, 0x0016ED8D, 0x0015E88E,
+    0x0016040F, 0x0016EF91, 0x0016F412, 0x0015A413, 0x0015F315, 0x0015DB16, 0x0015C238, 0x0016F500,
+    0x00166A82, 0x0016F604, 0x0015A405, 0x0015A10A, 0x00161B8B, 0x00162F0C, 0x0016F791, 0x0016F892,
+    0x00159E13, 0x0015B115, 0x0015B6B6, 0x00162F00, 0x0015A401, 0x0016F982, 0x0015A383, 0x0016FC04,
+    0x0015A40A, 0x0016FD0B, 0x0016FF0C, 0x0017010D, 0x0015A40F, 0x00170391, 0x0015A413, 0x00163415,
+    0x0015B2B9, 0x00170782, 0x0015A683, 0x0015A406, 0x00170908, 0x00170A0A, 0x00170B8B, 0x0015A18C,
+    0x0015A40D, 0x00170D0E, 0x0015A40F, 0x00170F11, 0x0015A392, 0x00166493, 0x00171014, 0x0015DB36,
+    0x0015A401, 0x00166A82, 0x00171105, 0x0015A406, 0x0016618C, 0x00166A8D, 0x00171211, 0x0015A692,
+    0x00160833, 0x0015A68B, 0x0015A68C, 0x00159D2D, 0x0015AC2E, 0x0015D224, 0x0015A800, 0x0015B126,
+    0x0015A108, 0x0015A42B, 0x0015B500, 0x0015BCA4, 0x00171382, 0x0015A404, 0x0015A430, 0x00159DAF,
+    0x00171482, 0x0015A404, 0x0015A40B, 0x00159DB1, 0x0015AB02, 0x0015B112, 0x0015A433, 0x0015AC00,
+    0x001637A4, 0x0015DC04, 0x00171588, 0x0015B135, 0x00171702, 0x0015F303, 0x0015A404, 0x0015A406,
+    0x0015D988, 0x0017180C, 0x0017198D, 0x0015DC0F, 0x00171B11, 0x00171C92, 0x0015A413, 0x0015A094,
+    0x0015EB15, 0x0015A416, 0x0015A438, 0x00171E80, 0x0015BA02, 0x00172004, 0x00162205, 0x0015A406,
+    0x0015BA08, 0x0015A40C, 0x0016F78F, 0x00166A91, 0x0015A695, 0x0015A436, 0x00166A82, 0x0015B584,
+    0x00172105, 0x0017220C, 0x0017230D, 0x0016040F, 0x0015A433, 0x00172500, 0x00166A82, 0x0015A403,
+    0x00166C85, 0x0015A406, 0x0015A68A, 0x0017260C, 0x0017270D, 0x0017288E, 0x0015A40F, 0x0015A392,
+    0x00172993, 0x00172B14, 0x0015A395, 0x0016B616, 0x0015F318, 0x0015A6B9, 0x0015A401, 0x00166A82,
+    0x00172D04, 0x00172E8C, 0x00172F2D, 0x0015A123, 0x00171382, 0x0015B103, 0x0017300B, 0x0015A08F,
+    0x0015FF11, 0x0015A612, 0x001731B3, 0x0015B681, 0x0015A108, 0x0015A68B, 0x0015E811, 0x0015A139,
+    0x0015A400, 0x00173302, 0x0015B68A, 0x001714AE, 0x0015A400, 0x00173404, 0x0015ACAE, 0x0015A423,
+    0x0015A425, 0x0015A688, 0x0015AC8E, 0x0015A6B4, 0x0015FF00, 0x0015AC84, 0x0017372E, 0x0015A405,
+    0x0015AC86, 0x0015A40B, 0x0015A40D, 0x0015A411, 0x0015A433, 0x0015A400, 0x0015B101, 0x0015A403,
+    0x00160E04, 0x00173888, 0x0015B68B, 0x0017398E, 0x0015A413, 0x0015A139, 0x00173B00, 0x00173C81,
+    0x00173F04, 0x0015E105, 0x00174088, 0x0017418C, 0x0017438F, 0x0015A693, 0x0015A434, 0x00162582,
+    0x00163203, 0x00160E04, 0x0015A405, 0x00174506, 0x00174688, 0x0015B68A, 0x0015F30D, 0x00162313,
+    0x0015A414, 0x0015AB35, 0x00159E02, 0x00174804, 0x0015A405, 0x0015B68A, 0x0015B68B, 0x00174A0C,
+    0x0015DC0F, 0x0015A092, 0x0015A413, 0x0015A6B9, 0x0015FD00, 0x00163C04, 0x0015B10F, 0x0015A111,
+    0x00161AB2, 0x00159DB4, 0x00174B80, 0x00165301, 0x0015A403, 0x00174C84, 0x00159D86, 0x0015A108,
+    0x0015B68A, 0x0015A40C, 0x00174E8D, 0x0015A40F, 0x00162332, 0x00175104, 0x0015A688, 0x0016C7B3,
+    0x0015AC80, 0x0015B584, 0x0015A407, 0x0015C233, 0x00162582, 0x0015A683, 0x00162586, 0x0015BB0B,
+    0x0015A60D, 0x0016080F, 0x00175391, 0x00175633, 0x00175704, 0x0015ACA8, 0x00160580, 0x00175A04,
+    0x0015A40A, 0x0015A40B, 0x0015A40F, 0x0015B131, 0x00175B00, 0x0015B584, 0x0015FF28, 0x0015BE00,
+    0x0015BD04, 0x0015E10B, 0x0015BE2F, 0x00175C04, 0x0015A6A8, 0x0015AC00, 0x0015A401, 0x00166A82,
+    0x0015A605, 0x0015A406, 0x00175E08, 0x0015A68A, 0x0017180C, 0x00175F0D, 0x0016340F, 0x0015A691,
+    0x00176092, 0x0015A393, 0x0015A395, 0x00166096, 0x0015A418, 0x0015F139, 0x00176180, 0x00168E03,
+    0x00176284, 0x0016080C, 0x0015A10D, 0x0017650F, 0x0016F892, 0x0015F336, 0x0015A400, 0x0015A401,
+    0x00166A82, 0x00176704, 0x0017688C, 0x0015A68D, 0x0015A40E, 0x0015F30F, 0x00176A12, 0x0015D4B3,
+    0x00166A80, 0x00176B02, 0x0015A085, 0x0015A406, 0x00176C8C, 0x00176D8D, 0x00176F8E, 0x0015A40F,
+    0x0015A691, 0x00167492, 0x00177114, 0x00177216, 0x0015A6B9, 0x0015BA02, 0x00177383, 0x00177584,
+    0x0015A085, 0x0017770C, 0x0015BA0D, 0x0015B50E, 0x0015A111, 0x00177812, 0x0015A6B5, 0x00159E33,
+    0x0015B504, 0x0015A62F, 0x0015A6AD, 0x0015B101, 0x00177A04, 0x00177C28, 0x0015B123, 0x0015A405,
+    0x0015D58D, 0x00159E12, 0x0015A433, 0x00159E02, 0x00171004, 0x0015B68B, 0x0015A40C, 0x0015A10F,
+    0x0016CAB3, 0x0015B984, 0x0015BAA8, 0x0015B103, 0x00159D84, 0x0015A088, 0x0015A433, 0x0015AC04,
+    0x00159D08, 0x00165EAF, 0x0015A080, 0x0015A401, 0x00159E02, 0x0015B683, 0x00166284, 0x0015A405,
+    0x00177D08, 0x00177E8B, 0x0015B68D, 0x00161F11, 0x00178012, 0x0015F135, 0x0015B984, 0x0015B107,
+    0x0015A40A, 0x0015B68F, 0x0015AB12, 0x0015ABB4, 0x00159E02, 0x00178184, 0x00178308, 0x00166593,
+    0x0015A1B4, 0x00159E22, 0x00162F2D, 0x0015B580, 0x0015C02B, 0x0015BCA8, 0x0015F700, 0x0015A404,
+    0x0015AC2E, 0x00161DA8, 0x0015A433, 0x0015A404, 0x0015ACAE, 0x0015A431, 0x0015A121, 0x0015A404,
+    0x0015A107, 0x0015A42A, 0x0015D480, 0x0015E103, 0x0015A42E, 0x0015B6A5, 0x00165E86, 0x0015A42E,
+    0x0015AB0A, 0x0015E10B, 0x0016F78D, 0x0015E111, 0x0015E132, 0x0015B584, 0x0015A408, 0x0017848B,
+    0x0015A433, 0x00161500, 0x0015A404, 0x0015A68C, 0x0015A40D, 0x0015B6AF, 0x00161A82, 0x0015E103,
+    0x0015A406, 0x0015AB08, 0x0015A40A, 0x0015B10D, 0x0015A433, 0x00166C80, 0x0015A401, 0x0015B102,
+    0x00163784, 0x0015C206, 0x00160F88, 0x0015A40A, 0x0015A40D, 0x0015A691, 0x0015A413, 0x00159DB9,
+    0x0015FE27, 0x0015AC00, 0x00163784, 0x0015A40E, 0x0015AB13, 0x0015D9B4, 0x00163401, 0x0015A403,
+    0x0015A08B, 0x0015A60D, 0x0015A411, 0x0015A433, 0x0015AC84, 0x0015A0A8, 0x00159E00, 0x0015A403,
+    0x0015DE84, 0x0015A40A, 0x0015A40D, 0x0015A433, 0x0015AC80, 0x00159E02, 0x0015A0AD, 0x001637A4,
+    0x0015A403, 0x0015B508, 0x0016220B, 0x0015A40D, 0x00178591, 0x00159E12, 0x00162593, 0x0015A695,
+    0x0015B6B6, 0x00178780, 0x0015B101, 0x00162984, 0x0015A608, 0x0015A413, 0x00178894, 0x0015A6B8,
+    0x00178B00, 0x00162F0A, 0x00178D8E, 0x0015E131, 0x0015AC20, 0x0015B683, 0x0015B10B, 0x0015A40C,
+    0x0015A40D, 0x0015A40F, 0x0015F311, 0x0015A413, 0x0015F335, 0x0015A080, 0x0015A804, 0x0015AB05,
+    0x0015A408, 0x0015D5AE, 0x0015A400, 0x00178F34, 0x0015A682, 0x0015A403, 0x0015B105, 0x0015BA86,
+    0x0015A40B, 0x0015C992, 0x0015E133, 0x0015B584, 0x0015AB2A, 0x0015E100, 0x0015B584, 0x0015DC05,
+    0x0015A408, 0x0015B68B, 0x0015A40E, 0x00159E0F, 0x00171493, 0x0015A3B5, 0x0015AC80, 0x0015A404,
+    0x00179008, 0x0017910E, 0x0015A08F, 0x0015A834, 0x00179300, 0x00159E02, 0x0015DC04, 0x00179408,
+    0x0015A392, 0x0015A433, 0x0015B137, 0x0015A60E, 0x001625B3, 0x00179500, 0x0015E101, 0x0015B584,
+    0x0015D588, 0x0015C20C, 0x0015B68D, 0x0015A40E, 0x00166591, 0x00159E13, 0x0015A435, 0x0015BC84,
+    0x00159D87, 0x0015A408, 0x0015A40A, 0x0015A6B2, 0x0015A804, 0x0015C32E, 0x0015A3A2, 0x0015A400,
+    0x0015AC04, 0x00166088, 0x0016D8AE, 0x00179600, 0x00159D24, 0x0015A101, 0x0015A40A, 0x0015A42B,
+    0x0015B52A, 0x00159D81, 0x00173B0B, 0x00159D93, 0x0015A436, 0x00159DB3, 0x0015A082, 0x0015A40B,
+    0x0015A68D, 0x0015E111, 0x0015AB39, 0x0015A421, 0x00168C04, 0x0015A087, 0x0015B68A, 0x0015A08E,
+    0x00173033, 0x0015B103, 0x0015A688, 0x0015A40E, 0x0015A0B2, 0x0015A401, 0x0015A40B, 0x0015A68D,
+    0x0015A433, 0x0015A087, 0x0015A628, 0x0015A400, 0x001797A4, 0x0015AB03, 0x00177EAB, 0x0015AB01,
+    0x00166684, 0x0015E10B, 0x0015A42F, 0x0015B500, 0x0015D204, 0x00179986, 0x0015B988, 0x0015B68A,
+    0x0015A10D, 0x0015A40E, 0x0015A433, 0x0015A383, 0x0015A40B, 0x0015A133, 0x0015B10F, 0x0015AB32,
+    0x0015AB80, 0x0015B504, 0x0015A386, 0x0015F30A, 0x0015A40B, 0x00161F33, 0x0015A400, 0x00179B82,
+    0x0015B107, 0x0015A40A, 0x0015A6AC, 0x00162980, 0x00162582, 0x0015B584, 0x0015B112, 0x00179D13,
+    0x0015B139, 0x0015EE80, 0x0015D204, 0x0015A408, 0x0015A10D, 0x0015DC0E, 0x0015B135, 0x0016F7A8,
+    0x0015AC84, 0x0015E139, 0x0015EEAD, 0x0015A401, 0x0015A433, 0x0015B101, 0x0015A404, 0x0015A688,
+    0x0015A10B, 0x0015EDB1, 0x0015A087, 0x0015A40A, 0x0015A40E, 0x0015A434, 0x0015B103, 0x0015F106,
+    0x0015A42E, 0x0015A40A, 0x0015A411, 0x0015A092, 0x00159E33, 0x0015AC80, 0x0015B684, 0x00166586,
+    0x0015A688, 0x0015E82C, 0x0015AB38, 0x0017950B, 0x0015C90D, 0x0015A433, 0x0015EB02, 0x0015B584,
+    0x0015A108, 0x00161F0B, 0x0015A10C, 0x0016668E, 0x0015A433, 0x0015AC00, 0x0015B584, 0x0015B9A8,
+    0x0015D480, 0x0015B884, 0x0015C206, 0x0015AB0A, 0x0016BA8D, 0x0015A80E, 0x0015B112, 0x0015A634,
+    0x0015A401, 0x0015A682, 0x0015B103, 0x0015A40A, 0x0016340B, 0x0015B68C, 0x0015A10D, 0x0015EE91,
+    0x0015B139, 0x0015A400, 0x00168C24, 0x00159D00, 0x0015C201, 0x0015F304, 0x00160F88, 0x0015B68A,
+    0x0015B68C, 0x0015A40F, 0x0015A411, 0x0015B192, 0x0015B6B3, 0x0015D380, 0x0016D384, 0x0015A127,
+    0x0015AC00, 0x00163784, 0x0015B133, 0x0015B500, 0x0015A601, 0x0015F302, 0x00162586, 0x0015A40A,
+    0x0015A10B, 0x0015C20C, 0x0015A40F, 0x0015A111, 0x0015A692, 0x0015A433, 0x00163C04, 0x0015A6A8,
+    0x0015B500, 0x00161F03, 0x00179E84, 0x0015A688, 0x0016340B, 0x0016C18D, 0x0015A40F, 0x0015E111,
+    0x0015A692, 0x0015A433, 0x0015B584, 0x0015A6A8, 0x0015AC84, 0x0015B12B, 0x0017A024, 0x0015A401,
+    0x0017A202, 0x0017A305, 0x0015A406, 0x0017A408, 0x0015A38A, 0x0017148C, 0x0017A50D, 0x0016080F,
+    0x0015A413, 0x0015A695, 0x0016A596, 0x0015A438, 0x0017A600, 0x0015BA02, 0x00163784, 0x0015A406,
+    0x0015A40A, 0x0015A08D, 0x0015A691, 0x00167492, 0x0015A438, 0x0015A401, 0x0015A682, 0x00176704,
+    0x0015A605, 0x0017A78B, 0x00166A8D, 0x0015DC0F, 0x0015A3B5, 0x0017A888, 0x0015A68A, 0x0016E50B,
+    0x0015A68C, 0x00161A8D, 0x0017AA0E, 0x0015DC0F, 0x0015E892, 0x0015BA14, 0x0015A395, 0x0016B636,
+    0x0015A401, 0x0015A406, 0x0015BB08, 0x0015A40C, 0x00166A8D, 0x0015A68F, 0x00165312, 0x0015B137,
+    0x0015B580, 0x0015A804, 0x0015E12B, 0x0015AB01, 0x0015AB2C, 0x0015A403, 0x0015A40B, 0x0015A40D,
+    0x0015A431, 0x0015AB21, 0x0017AC80, 0x0015A404, 0x0015E107, 0x0015B68A, 0x0015A433, 0x0015B103,
+    0x0015B5A4, 0x0015A40B, 0x0015DC33, 0x0015A405, 0x0015A434, 0x0015D58D, 0x0015A433, 0x0015A400,
+    0x0015B584, 0x0015A12A, 0x0015A682, 0x0015A404, 0x0015A108, 0x00161F0B, 0x0015A6B2, 0x0015A400,
+    0x00162F01, 0x00165E8A, 0x0015E10C, 0x00161F2F, 0x0015AB80, 0x00160902, 0x0015A404, 0x0015B686,
+    0x0015A40A, 0x0016658D, 0x00159E12, 0x0015A433, 0x0017332C, 0x00163784, 0x0016530B, 0x0015B12F,
+    0x00162980, 0x0015B584, 0x0015B106, 0x0015A40D, 0x0017AD8E, 0x00173011, 0x0015A092, 0x0015AB94,
+    0x00159DB9, 0x00161F0A, 0x00161F33, 0x001625A2, 0x0015A624, 0x0015AC00, 0x0017AF0B, 0x0015A40C,
+    0x0015D58D, 0x00168211, 0x0015ABB4, 0x0015FF04, 0x0017B02B, 0x0015A68B, 0x0015A6AD, 0x0015C92D,
+    0x001629A4, 0x0015A804, 0x0015A38B, 0x0015A6B1, 0x0015A403, 0x00159D04, 0x00161F0B, 0x0015DC0D,
+    0x0015A092, 0x001625B3, 0x0017B104, 0x0015A68B, 0x0015A433, 0x0017B304, 0x0015A6A7, 0x0017B424,
+    0x00161F0D, 0x0015BA2E, 0x0015B584, 0x0015A42E, 0x0015A620, 0x0015A12C, 0x0015A602, 0x0015E105,
+    0x0015A68B, 0x0015A433, 0x0016F7A2, 0x0015B132, 0x0015A3A8, 0x0015AC84, 0x0015A42D, 0x0015A411,
+    0x0015A0B2, 0x0015B500, 0x0015BD24, 0x0015B504, 0x0015A42E, 0x0015A607, 0x0015A6AD, 0x00159D04,
+    0x0015ACAE, 0x0015AC24, 0x0015A622, 0x0015AB23, 0x0015AC88, 0x0015B58D, 0x0015A3B3, 0x0016CC2E,
+    0x00159DA7, 0x0015A804, 0x0015ACA8, 0x0015A602, 0x0015E106, 0x00159DAC, 0x00159D04, 0x0015BAA8,
+    0x00159D00, 0x0015A383, 0x0015A08D, 0x0015A3B3, 0x0015ACA4, 0x00165306, 0x0015AC88, 0x0016082F,
+    0x0015A383, 0x0015A6B3, 0x0015AC80, 0x0017B524, 0x0015A402, 0x0015C428, 0x00179300, 0x0017B684,
+    0x0017B78E, 0x0015A434, 0x0015A3A4, 0x0015B504, 0x00159D0D, 0x0017B911, 0x0015A434, 0x0015A402,
+    0x0015A411, 0x0015A433, 0x0015A400, 0x0017BA04, 0x0015A438, 0x00159D89, 0x0015D58D, 0x0015A693,
+    0x0015A6B5, 0x00161F33, 0x0015A68B, 0x0015A6B1, 0x0015F323, 0x0015A602, 0x0015AB91, 0x0015A6B3,
+    0x0017BB84, 0x0016CC0E, 0x0015A6B4, 0x0017BD0C, 0x0015A436, 0x0015B9A0, 0x0015E12E, 0x0015D58E,
+    0x0015DFB4, 0x00159D8A, 0x0015A40B, 0x0015AB91, 0x0015A436, 0x0015AA84, 0x0015B10A, 0x0015A3B4,
+    0x0015A804, 0x0015A108, 0x0015E131, 0x0017BE31, 0x0017BF2E, 0x0015ABB8, 0x0015A0A2, 0x0015D480,
+    0x0015BD2E, 0x0015A422, 0x00162582, 0x0015A683, 0x0015A08F, 0x0015E137, 0x0015C400, 0x0015A404,
+    0x0017C028, 0x0015A3B2, 0x0015A602, 0x0015A435, 0x0016D8AE, 0x0017C102, 0x0015D5AD, 0x0015A383,
+    0x0015A6B2, 0x00159D04, 0x0015A82E, 0x0015A082, 0x0015AB06, 0x0015A60F, 0x0015A435, 0x0015AC84,
+    0x0015AC28, 0x0015B500, 0x0015A0AE, 0x0015B500, 0x0015B524, 0x0015E100, 0x0015A424, 0x0015A804,
+    0x0017C28E, 0x0015AB31, 0x0015A686, 0x0015A68F, 0x0015A433, 0x0015AC00, 0x0015A804, 0x00161D88,
+    0x0015A68D, 0x0015E88E, 0x0015AC38, 0x0015AC88, 0x0015A6AB, 0x0015A383, 0x0015A428, 0x0015A427,
+    0x00159D20, 0x0016220D, 0x0017C391, 0x0015A433, 0x0015A6AE, 0x0015A602, 0x0015A40B, 0x0015A6B3,
+    0x0015A687, 0x0015A3AA, 0x0015A602, 0x0015A60B, 0x0015A42C, 0x0015C424, 0x0015A080, 0x0015A402,
+    0x0015AB84, 0x0015A68C, 0x0015A631, 0x0015A404, 0x0015A38B, 0x0017C48D, 0x0015A612, 0x0015A433,
+    0x0015A683, 0x0015A68C, 0x0015A42D, 0x0015A080, 0x0015C404, 0x0015A42E, 0x0015C40E, 0x0015E831,
+    0x0015A683, 0x0016220B, 0x0015FF31, 0x0015A432, 0x0015A400, 0x0015A404, 0x0015B8A8, 0x0015B101,
+    0x0015A3AB, 0x0017C584, 0x0015A108, 0x0015C233, 0x0015B103, 0x00163784, 0x0015A686, 0x0015A42E,
+    0x0015A10D, 0x0015B131, 0x0015A40A, 0x0015A40B, 0x00165B8D, 0x00161F11, 0x001625B3, 0x00179784,
+    0x0015B8A8, 0x0015C380, 0x0015A40B, 0x0015A3B2, 0x0015AC00, 0x0015E102, 0x0015A403, 0x0015A404,
+    0x0017C786, 0x0015A40A, 0x0015E10D, 0x0015EE8E, 0x0015ABB4, 0x00159D00, 0x0017C902, 0x0015A403,
+    0x00163784, 0x0015F30B, 0x0015A40C, 0x0015A40E, 0x0015AB11, 0x0015A692, 0x0015A433, 0x00159D82,
+    0x0015D3B3, 0x0015C400, 0x0015B584, 0x0015B10B, 0x0015AB12, 0x0015E113, 0x0015A136, 0x00159E06,
+    0x0017CA8B, 0x0017148D, 0x00159D11, 0x0015A413, 0x0015A6B5, 0x0015A400, 0x0017CB84, 0x0015A80E,
+    0x0015A434, 0x0015B6AD, 0x0015BD04, 0x0015A68D, 0x0015A6B1, 0x0015A40B, 0x00160411, 0x0015C592,
+    0x0015A413, 0x0015A6B9, 0x0015C400, 0x0015A404, 0x0015A087, 0x0015A088, 0x0015A42A, 0x0015BCA4,
+    0x0015A401, 0x0015A403, 0x0015A40B, 0x0015A40D, 0x0015A411, 0x0015A692, 0x0015A6B9, 0x0015A6AC,
+    0x0015BA86, 0x0015A08D, 0x0015A0B2, 0x00159E02, 0x00159D08, 0x0017CD0B, 0x0015BA8E, 0x0015B6B3,
+    0x0015AC00, 0x0015A404, 0x00161A8C, 0x0015A834, 0x0015A382, 0x0015B683, 0x0015A408, 0x0015A40A,
+    0x0015B10D, 0x0015A433, 0x0015A403, 0x00166CA5, 0x0015C400, 0x00166684, 0x0015A108, 0x0015B10B,
+    0x0015D38C, 0x0015B68D, 0x0015E131, 0x0015A692, 0x00173033, 0x00166080, 0x00162582, 0x0015B584,
+    0x0015BB08, 0x0015B50E, 0x0015C213, 0x0015E894, 0x0015A136, 0x0015B500, 0x0015A403, 0x00159D24,
+    0x0015BD04, 0x0015B12B, 0x0015A404, 0x0015B139, 0x0015A411, 0x0015A433, 0x0015A804, 0x0015AB31,
+    0x0015A404, 0x0017CE87, 0x0015AC88, 0x0015A40E, 0x0015E8B4, 0x0015A404, 0x0015A686, 0x0015A42E,
+    0x0015A405, 0x0015BB0B, 0x0016738D, 0x0015CD11, 0x0015A0B2, 0x00163784, 0x0015A408, 0x0017CFB3,
+    0x0015B106, 0x0015A607, 0x0015A42E, 0x0015B500, 0x00159E02, 0x0017D084, 0x00159D88, 0x0015A40A,
+    0x0017D28B, 0x00177E8C, 0x0015A40E, 0x00162593, 0x0015ABB4, 0x0015C400, 0x0017D482, 0x0015A403,
+    0x0015D204, 0x0015A408, 0x0015A40A, 0x0015B10D, 0x0015A42E, 0x00159D31, 0x0015A407, 0x0015A6B4,
+    0x00163784, 0x0015A688, 0x0015A40A, 0x0015A40C, 0x0015A40D, 0x0015B111, 0x0015A612, 0x00159E33,
+    0x0015A402, 0x0015E107, 0x0015A40A, 0x0015B6B3, 0x00159E02, 0x0015B10B, 0x0015A10D, 0x0015F333,
+    0x001666A4, 0x0015D204, 0x0015A0A8, 0x0015E139, 0x0015BB31, 0x0015A401, 0x00166A82, 0x00166C85,
+    0x0015A406, 0x0015F208, 0x0016568A, 0x0017D58C, 0x0016AE8D, 0x0015A40F, 0x00161A91, 0x0017D792,
+    0x0015A413, 0x0015A115, 0x0017D896, 0x0015B117, 0x0015A438, 0x00178F00, 0x00166A82, 0x0017DA04,
+    0x0015A406, 0x0015A68C, 0x00162592, 0x0015B514, 0x0015A416, 0x00173317, 0x0015A438, 0x00167B02,
+    0x0015D204, 0x0017DC0C, 0x0017DD0D, 0x0015A40F, 0x00162211, 0x0015BA12, 0x00160433, 0x0015A600,
+    0x0015A401, 0x00167B02, 0x0015A404, 0x0015A406, 0x0015D58D, 0x0017B68E, 0x0015A40F, 0x0017CD11,
+    0x0017DE12, 0x0015B193, 0x0017DF14, 0x0016B636, 0x0015A401, 0x00160E04, 0x00168205, 0x0015BB08,
+    0x00161A8A, 0x0017E00C, 0x0017E10D, 0x0015B50E, 0x0015B511, 0x00162592, 0x00161A93, 0x0015A0B8,
+    0x0015B101, 0x0015A804, 0x0015A68F, 0x0015A6B3, 0x0015A40B, 0x00161F2C, 0x0015C400, 0x0015E8B4,
+    0x0015ACA7, 0x0015B104, 0x0015E106, 0x0015A688, 0x0015A68B, 0x0015BE2E, 0x0015A403, 0x0015A40B,
+    0x0015A40D, 0x0015A632, 0x0015A403, 0x0015B104, 0x0017E208, 0x0015B68A, 0x0015E12B, 0x0017E403,
+    0x0015A404, 0x0015B10B, 0x0015A433, 0x0015B683, 0x0015A40B, 0x0015B6B3, 0x0017E580, 0x0015B681,
+    0x0015A382, 0x00162F03, 0x0017E684, 0x0017E806, 0x0015B68A, 0x0015F30C, 0x0017E913, 0x0015D994,
+    0x0015B1B9, 0x0015B1B2, 0x0015A080, 0x0015A403, 0x0017EB04, 0x0015F30B, 0x0016738D, 0x0015A411,
+    0x00159E33, 0x0015A124, 0x0015A40B, 0x00159E33, 0x0015A804, 0x0015A68B, 0x0015A6AD, 0x0015A401,
+    0x0017EC02, 0x0015A406, 0x00174B88, 0x0015A38C, 0x0017ED0D, 0x0015F30F, 0x0015A412, 0x00173193,
+    0x0015FB14, 0x0015A438, 0x00166A80, 0x0017EE04, 0x0015A088, 0x00159D0C, 0x0015A10D, 0x0015AC8E,
+    0x0015A691, 0x00162592, 0x0015A433, 0x0015A800, 0x0015A401, 0x0017F004, 0x0015A406, 0x0015C40B,
+    0x0017F192, 0x0017F313, 0x0017F539, 0x00166A82, 0x0015A404, 0x0015A406, 0x0017F60D, 0x0017F791,
+    0x0017F912, 0x00162593, 0x00167E16, 0x0015A3B9, 0x0015A406, 0x0015A608, 0x0015A18C, 0x0017FA32,
+    0x0015B500, 0x0015B101, 0x0015B132, 0x0015A40A, 0x0015A434, 0x0015B103, 0x00161AA6, 0x0015A40B,
+    0x0015AB31, 0x0015AC00, 0x0015B106, 0x00162308, 0x0016530B, 0x00160834, 0x00161F2B, 0x001662A4,
+    0x0016CA83, 0x0017FB06, 0x00161F0A, 0x0015E12D, 0x00160580, 0x0015A102, 0x0015A40B, 0x0017090E,
+    0x00161F11, 0x00159E13, 0x00165339, 0x0017FC84, 0x0015AC08, 0x0015A40A, 0x0015E112, 0x0015B6B3,
+    0x0017FE84, 0x0015AC08, 0x0015E139, 0x0015A6B3, 0x00165E81, 0x0015A6AB, 0x00159D83, 0x0015A404,
+    0x0015A686, 0x0015B588, 0x00162309, 0x0015AB32, 0x00160825, 0x0015A403, 0x0015E10B, 0x0015A40D,
+    0x0015A411, 0x00180033, 0x00180180, 0x00180304, 0x0015B68B, 0x0015A18E, 0x0015A094, 0x0015AB35,
+    0x0015B680, 0x00180481, 0x00174C84, 0x00173888, 0x0018068C, 0x0015A40F, 0x0015A634, 0x00159E02,
+    0x0015B103, 0x00180804, 0x0015A406, 0x0015A109, 0x00166C8E, 0x0015A433, 0x00163784, 0x0015A40E,
+    0x0015B12F, 0x0015EC01, 0x0015A103, 0x0015A404, 0x0015A408, 0x0015A40C, 0x00159D8D, 0x0015A691,
+    0x00159E13, 0x0015ABB4, 0x0015A404, 0x0015B68F, 0x0015E112, 0x0015A433, 0x00159E02, 0x00163784,
+    0x0015A407, 0x0015B52E, 0x00180902, 0x00161F03, 0x0015A386, 0x0015A689, 0x0015A08B, 0x0015B68C,
+    0x0015A60D, 0x0015A40F, 0x0015A411, 0x0015A412, 0x00161AB9, 0x0015C404, 0x0015A0AE, 0x0015B102,
+    0x0015A403, 0x00161F0A, 0x0015A40F, 0x0015B132, 0x0015AC00, 0x0015A804, 0x0015E12B, 0x00180A00,
+    0x0015D204, 0x00180B2E, 0x0015A40B, 0x0015A40D, 0x0015F311, 0x0015A433, 0x0015B534, 0x00168E2A,
+    0x00161F0A, 0x0015A40F, 0x00166E32, 0x0015A092, 0x0015A433, 0x0015A403, 0x0015A684, 0x00159D08,
+    0x0015B10B, 0x0015A433, 0x0015AC04, 0x00165E8C, 0x0015A0AE, 0x00162980, 0x0015DC04, 0x00180C08,
+    0x0015B10D, 0x00180E0E, 0x0015C011, 0x0015B693, 0x0015C234, 0x0015A683, 0x00159D28, 0x00159E00,
+    0x0015A681, 0x0015A404, 0x0015A68B, 0x0015B68C, 0x0015A6AD, 0x00162312, 0x0015F333, 0x0015A400,
+    0x0015A1B4, 0x0015A42C, 0x0015AC80, 0x0015B524, 0x0015A092, 0x0015A413, 0x0015A094, 0x00159DB9,
+    0x0015A404, 0x0015A0B2, 0x0015A612, 0x0015C434, 0x0015AC2B, 0x0015A62D, 0x0016E304, 0x00159D8B,
+    0x0015A434, 0x0015E123, 0x0015A400, 0x0015A687, 0x0015A08E, 0x0015A6B4, 0x0015A400, 0x0015A403,
+    0x0015A084, 0x0015B68B, 0x0015B10F, 0x0015A433, 0x0015AC04, 0x0015A68C, 0x0015B6AF, 0x00159E02,
+    0x0015F306, 0x0015A40A, 0x0015B10D, 0x0015AB39, 0x0015AC8E, 0x0016658F, 0x0015E132, 0x0015A403,
+    0x00161F0B, 0x0015A40D, 0x0015EE8E, 0x0015A411, 0x00159E12, 0x00180F33, 0x00162F0C, 0x0015A433,
+    0x00159E02, 0x0015A424, 0x0015A0B2, 0x00181024, 0x0015AB2C, 0x0015A682, 0x00166B03, 0x00181208,
+    0x0015A40C, 0x0015FB0D, 0x00161A91, 0x0015E892, 0x0015A714, 0x00161AB9, 0x00162600, 0x0016BA81,
+    0x0015F303, 0x00181304, 0x0015A408, 0x0015DC0D, 0x0015A438, 0x00162980, 0x0015A401, 0x0015A383,
+    0x00181505, 0x0015A68A, 0x0015F30C, 0x0015A60D, 0x0015BA12, 0x00181633, 0x00165100, 0x00181701,
+    0x0015A683, 0x0015D586, 0x0015A40C, 0x0018190E, 0x0015A40F, 0x0015E111, 0x00167492, 0x0015A094,
+    0x0015A395, 0x0015A416, 0x0015A6B9, 0x00179784, 0x0015A406, 0x0015F30C, 0x0015AC8E, 0x0015F333,
+    0x001625AF, 0x0017CB91, 0x00162592, 0x0015A413, 0x0015EEB6, 0x0015A38C, 0x0015A436, 0x0015A403,
+    0x0015A405, 0x0015A40B, 0x0015B111, 0x0015B6B3, 0x00161500, 0x0015C681, 0x0015A408, 0x0015A42E,
+    0x0015A084, 0x0015E10B, 0x0015AB32, 0x0015A40B, 0x0015A411, 0x0015A092, 0x00180933, 0x0015B504,
+    0x0015A425, 0x0015A106, 0x0015A42E, 0x0015B504, 0x0015C92D, 0x0015B683, 0x00179404, 0x0015A405,
+    0x0015E10B, 0x0015F32F, 0x0015AB01, 0x0015B504, 0x0015A12F, 0x0015BB00, 0x00159E02, 0x00181A04,
+    0x0015A406, 0x00171108, 0x0015A40A, 0x0015A10D, 0x00166C8E, 0x0015A418, 0x0015AB39, 0x0015B101,
+    0x00161F03, 0x0015E104, 0x00161F05, 0x0015A406, 0x0015B10A, 0x00160E0B, 0x0015B68D, 0x0015B68F,
+    0x0015B691, 0x00161AB2, 0x0015BA00, 0x0015BA28, 0x00162980, 0x0015B584, 0x0015A386, 0x0015A408,
+    0x0015B68C, 0x0015A40F, 0x00165332, 0x0015A087, 0x0015A6B2, 0x00159E02, 0x0015B687, 0x0015A133,
+    0x00159E02, 0x0015A386, 0x0015A40A, 0x00181B11, 0x0015B6B3, 0x0015AC80, 0x0015A403, 0x0015A405,
+    0x0015A40A, 0x0015A40B, 0x0015A42D, 0x0015AB88, 0x0015A6AB, 0x0015AC00, 0x0015A401, 0x0015A382,
+    0x00160803, 0x0017A305, 0x00181C08, 0x00181D8C, 0x00181F8D, 0x0018218F, 0x00182312, 0x0015A393,
+    0x00165695, 0x0015A418, 0x0015A3B9, 0x0015A600, 0x00162301, 0x0015A682, 0x00182404, 0x00162306,
+    0x0015AC88, 0x0015A40D, 0x0015A692, 0x0015A695, 0x0015A416, 0x0015A438, 0x0015A682, 0x0015F303,
+    0x00168204, 0x00181505, 0x0015A406, 0x0015A68A, 0x0015C40B, 0x0015F10C, 0x0015FB0D, 0x0015A08E,
+    0x0018268F, 0x0015CA92, 0x0015D493, 0x0015A6B9, 0x00182880, 0x0015B103, 0x0015A406, 0x0015BA88,
+    0x0015A40A, 0x0015A10C, 0x0015A68D, 0x0018298E, 0x0015A38F, 0x00182A92, 0x0015A413, 0x00182B94,
+    0x00161A95, 0x0016A5B6, 0x0015A40B, 0x0015AC31, 0x0015A401, 0x00165D04, 0x00182D05, 0x00182E0C,
+    0x0017CAAD, 0x0015A682, 0x0015A683, 0x0015A68A, 0x0016F7AF, 0x0015AB02, 0x0017C78D, 0x0015FB11,
+    0x0015E835, 0x0015B6AA, 0x0016F8B2, 0x00160803, 0x00182F0B, 0x0015A18C, 0x0015AB11, 0x0015A3B2,
+    0x00183080, 0x00162582, 0x0015DC04, 0x0015B685, 0x00161F0B, 0x00164AAF, 0x00163201, 0x0018320C,
+    0x0015A42F, 0x0015B103, 0x00165306, 0x0015B68A, 0x0015B12D, 0x0015E12F, 0x0015B103, 0x0015A686,
+    0x0015B68B, 0x0015A40D, 0x0015B111, 0x00159E12, 0x0015A434, 0x0015B107, 0x0016880B, 0x0015B112,
+    0x00179D33, 0x0015B112, 0x00165EB3, 0x00159D04, 0x0015A68B, 0x0015A08E, 0x0015A6B2, 0x0015A40B,
+    0x0015A42D, 0x0015A42F, 0x0015A680, 0x0015A688, 0x0015B10D, 0x0015A42E, 0x0015A139, 0x0015A40E,
+    0x0016658F, 0x0015E132, 0x0015AC00, 0x0015B584, 0x0015EE8E, 0x0015A434, 0x0015A405, 0x0015A431,
+    0x0015A608, 0x0015A68B, 0x0015A434, 0x0015BA04, 0x0015A42A, 0x0015AC00, 0x0015B584, 0x00159D89,
+    0x0015A0B2, 0x0015A40C, 0x0015A433, 0x0015A405, 0x0015B288, 0x0015A433, 0x0015A426, 0x0015BA02,
+    0x0017E40A, 0x0015B68B, 0x0015DC0D, 0x00161F11, 0x00159E33, 0x0015A404, 0x0015A408, 0x00159DA9,
+    0x00178F00, 0x0015C204, 0x0015AB88, 0x0015A434, 0x0015AC00, 0x00163784, 0x0015C205, 0x00159D08,
+    0x00162F0B, 0x0015C20C, 0x0015EE8E, 0x0015A692, 0x0015A413, 0x0015C815, 0x0015A136, 0x0015AC00,
+    0x0015A101, 0x0015B584, 0x0015B10C, 0x0015A139, 0x0015A180, 0x00162702, 0x00161F03, 0x0015D386,
+    0x0015B68A, 0x0015B192, 0x0015A433, 0x0015A68B, 0x0015A12C, 0x0015BC80, 0x0015B10B, 0x0017BF0F,
+    0x0015A434, 0x0015AB80, 0x00161F03, 0x00183384, 0x0015AB88, 0x0015A40A, 0x0015A40B, 0x0015A40C,
+    0x0015A40D, 0x0015A40E, 0x00161F0F, 0x0015E111, 0x00162592, 0x0015A433, 0x0015B107, 0x0015A40A,
+    0x0015A40F, 0x00183533, 0x00162582, 0x0015D204, 0x0015A127, 0x0015A403, 0x0015A405, 0x00159E06,
+    0x0018368B, 0x0016220D, 0x0015A692, 0x0015A3B3, 0x00183884, 0x00161DAE, 0x00159D04, 0x0015A40A,
+    0x0015A40C, 0x0015A6B2, 0x00183A04, 0x0015A6AB, 0x0015AC80, 0x0017B124, 0x00161F03, 0x0015B58B,
+    0x0015A68C, 0x0015B68F, 0x00183B91, 0x0015A092, 0x00180F13, 0x0015F135, 0x0015EEA4, 0x0015A087,
+    0x0015A42A, 0x0015B504, 0x00161AA6, 0x0015B683, 0x0015A40B, 0x0015A6B9, 0x0015CD33, 0x0015A403,
+    0x00159E06, 0x0015A40B, 0x0015A411, 0x0015A632, 0x0015FF00, 0x0015A131, 0x0015B584, 0x00183D88,
+    0x00168E0B, 0x0015A40C, 0x0015DC0E, 0x0015A40F, 0x0015A6B5, 0x0015AC00, 0x0015A404, 0x00173888,
+    0x0015B6AF, 0x00160902, 0x0015A403, 0x0015A686, 0x00165E8D, 0x0015B111, 0x0015A433, 0x0015B681,
+    0x0015A403, 0x0015A404, 0x0015A40B, 0x0015C20C, 0x0015A40D, 0x0016B60E, 0x0015B111, 0x0015A692,
+    0x0015B293, 0x0015A6B8, 0x0015A40F, 0x0015A433, 0x0015A404, 0x0015A427, 0x00159E02, 0x00159E26,
+    0x0015BD04, 0x00159E26, 0x00159D00, 0x00163784, 0x0015AC38, 0x0015A42A, 0x0015DC27, 0x00163784,
+    0x00159DAE, 0x0015B500, 0x00159E02, 0x00183E8B, 0x0015A413, 0x00178F34, 0x0015BE00, 0x0015A403,
+    0x00160806, 0x0015B10A, 0x0015B10D, 0x0015A433, 0x0015B10B, 0x0018402F, 0x00184124, 0x0015B112,
+    0x0015A433, 0x00162582, 0x0015A6A7, 0x00159D04, 0x0015B106, 0x00172D11, 0x0015A0B2, 0x0015E101,
+    0x0015A42E, 0x00159D00, 0x0015A129, 0x0015AC80, 0x0015AC84, 0x0015A406, 0x0015A427, 0x0015BA02,
+    0x00159D04, 0x0015A40A, 0x0015D58D, 0x0015C5B2, 0x0015A400, 0x00160E04, 0x0015A408, 0x0015BE0A,
+    0x0015ABB4, 0x0015A403, 0x00160E04, 0x0015A40A, 0x0018430B, 0x0015F30C, 0x0015EE8E, 0x0015A433,
+    0x0015A400, 0x00174C84, 0x0015A688, 0x0015A6AC, 0x0015AC80, 0x0015C203, 0x00168C04, 0x0015D386,
+    0x0015B68A, 0x0015A82E, 0x00159E02, 0x0015B683, 0x0015B104, 0x0015A405, 0x0017300A, 0x0015B10B,
+    0x0015A40D, 0x0015A40F, 0x0015B591, 0x00159E12, 0x0015B693, 0x0015A6B5, 0x0015BA00, 0x00163784,
+    0x0015B12F, 0x00184480, 0x0015A383, 0x0015A408, 0x0015A40A, 0x0015A68C, 0x00161F0D, 0x00184632,
+    0x00184784, 0x0015C233, 0x00159E02, 0x00163B04, 0x0015E10B, 0x0015B133, 0x00184A85, 0x00159E06,
+    0x0015BB0D, 0x0015D391, 0x0015A392, 0x0015A433, 0x00184BA4, 0x0015A681, 0x0015E103, 0x0015A404,
+    0x00184A85, 0x0015A40A, 0x0015A40B, 0x0015A691, 0x0015AB32, 0x0015A400, 0x00159D04, 0x0015A6AB,
+    0x0015B121, 0x0015A10D, 0x00159D34, 0x0015B504, 0x0015B126, 0x0015A400, 0x0015A404, 0x0015B68A,
+    0x001647AB, 0x0016B600, 0x0015A405, 0x00184E88, 0x0015A80E, 0x00184F8F, 0x0015E8B4, 0x00162582,
+    0x00161F0A, 0x0015A433, 0x0015A403, 0x0015B68B, 0x00185111, 0x0015A092, 0x0015A433, 0x0015B107,
+    0x00161F0A, 0x0015A40E, 0x0015E132, 0x00162582, 0x0015A128, 0x00165EB9, 0x00185231, 0x001714AD,
+    0x0015A6A6, 0x0015A400, 0x00168F04, 0x0015B9A8, 0x0015BA84, 0x0015A42D, 0x0015A6A3, 0x0015D204,
+    0x00165E87, 0x0015A42E, 0x0015BCA0, 0x0015A6A7, 0x0015D3A1, 0x0015BA28, 0x0015B584, 0x0015B52E,
+    0x0015B504, 0x0015E10B, 0x0015C92D, 0x0015B504, 0x0015A6AB, 0x0015AC00, 0x0015B988, 0x0015A434,
+    0x00166080, 0x0015A404, 0x0015A0AD, 0x0018532E, 0x0015C22B, 0x001660AB, 0x0015AB2F, 0x0016320E,
+    0x0015A434, 0x0015ABA0, 0x0015A40D, 0x0015A433, 0x00185400, 0x00178F34, 0x00185500, 0x0015ABB4,
+    0x0015B504, 0x00159E33, 0x0015C006, 0x0015A40C, 0x00159D91, 0x0015ABB4, 0x0015B500, 0x00159D04,
+    0x0015A3B4, 0x0015EC03, 0x0016232D, 0x0015AA84, 0x00171028, 0x00185684, 0x0015A408, 0x0015E10B,
+    0x0015A08E, 0x0015AB31, 0x0015A38D, 0x0015A08F, 0x0015ABB1, 0x0015C30E, 0x0015A6B8, 0x0015AC04,
+    0x0015A68B, 0x0015D58E, 0x001857B4, 0x00185904, 0x0015B188, 0x00185A0E, 0x00159D91, 0x0015A6B4,
+    0x0015A60F, 0x00165131, 0x0015A804, 0x0015BC88, 0x0015A40E, 0x0015A131, 0x0015AC80, 0x0015A68B,
+    0x0015A62E, 0x0015BD04, 0x0015A6AB, 0x0015E100, 0x0015A624, 0x00175A04, 0x0015A0A8, 0x0015FF31,
+    0x0015A634, 0x0015ACB4, 0x0015A084, 0x0015AB2F, 0x00170904, 0x00162988, 0x00185231, 0x0015A10B,
+    0x0017BE11, 0x0015A0B2, 0x00185B28, 0x0015A683, 0x0015A3B3, 0x0015A403, 0x0015D5AD, 0x0015AB0A,
+    0x0015CD2D, 0x00185CA4, 0x00159D84, 0x0015A3B4, 0x0015E127, 0x0015E131, 0x0015B5B1, 0x0015AC00,
+    0x0015B6AA, 0x0015A400, 0x0015A125, 0x0015A400, 0x0015B504, 0x0015B686, 0x0015B508, 0x0015A131,
+    0x001781A4, 0x0015A180, 0x0015A1AE, 0x00185E01, 0x0015A404, 0x0015B10C, 0x0015ACAE, 0x0015A404,
+    0x0015B68D, 0x0015B133, 0x0015AC80, 0x001637A4, 0x0015A40A, 0x0015A40B, 0x0015A40F, 0x0015A113,
+    0x0015AC34, 0x0015B104, 0x0015F32F, 0x0015A40A, 0x0015A60D, 0x0015A42F, 0x0015A400, 0x0015AC24,
+    0x0015AC80, 0x00159D24, 0x0015A6A8, 0x0015B68B, 0x0015A40F, 0x0015A411, 0x0015A6B9, 0x00159D00,
+    0x0015A434, 0x0015FF00, 0x00183EAB, 0x0015A681, 0x0015B12C, 0x0015B12D, 0x00159D08, 0x00161F0A,
+    0x0015B131, 0x0015A692, 0x0015A413, 0x0015A434, 0x0015A404, 0x0015AC8E, 0x0015E133, 0x00185684,
+    0x0015A6A8, 0x0015C201, 0x001637A4, 0x00161F25, 0x0015B106, 0x0015A0AE, 0x0015A40B, 0x0015A433,
+    0x0015B10C, 0x0015B12F, 0x0015AB06, 0x0015A40A, 0x001731AD, 0x0015A403, 0x0015A106, 0x0015A6B1,
+    0x001797A4, 0x0016478A, 0x0015A42E, 0x0016220D, 0x0015A632, 0x00174C84, 0x0015AC2E, 0x0015B584,
+    0x00161F0B, 0x0015B6B3, 0x0015EEAE, 0x0015A404, 0x0015A406, 0x0015B133, 0x0015AB80, 0x0015ABB4,
+    0x0015A400, 0x0015B113, 0x0015ACB4, 0x0015AC00, 0x0015A406, 0x0015A40A, 0x0015A68B, 0x0015A411,
+    0x0015A632, 0x0015B500, 0x00159D04, 0x0015B6AB, 0x0015A400, 0x0015A424, 0x0015A400, 0x00161A86,
+    0x0015A42E, 0x0015F122, 0x0015B584, 0x0015A434, 0x0015A1A4, 0x0015B500, 0x00186001, 0x00161F2F,
+    0x0015AB02, 0x0015B68A, 0x00186133, 0x0017AC80, 0x00162984, 0x0015A82E, 0x0015A404, 0x0015B133,
+    0x00186200, 0x0015FF2E, 0x0015A107, 0x0015A42A, 0x00159D80, 0x0015A404, 0x0015A428, 0x0015A40E,
+    0x0015A434, 0x0015BA00, 0x0015A403, 0x0015A404, 0x0015A405, 0x0015C20A, 0x0015A40B, 0x0015A40C,
+    0x00168F2D, 0x0015A400, 0x0015A428, 0x0015AB80, 0x0015A404, 0x00184A88, 0x0015A12F, 0x0015A400,
+    0x0015A404, 0x0015DB08, 0x0015A6AC, 0x0015F300, 0x0015B103, 0x0015D484, 0x0015C206, 0x00159D89,
+    0x0015A413, 0x0015BE39, 0x0015A400, 0x0015A407, 0x0018630E, 0x0015E80F, 0x0015DC34, 0x0015DC00,
+    0x0015A40A, 0x0015E80C, 0x0015A40D, 0x00162F0E, 0x00159D91, 0x00179512, 0x0015A413, 0x0015B139,
+    0x0015A107, 0x0015A6AC, 0x00162980, 0x0015A408, 0x00159DB3, 0x00159E06, 0x00186431, 0x001629A0,
+    0x00166980, 0x00159D24, 0x00166A80, 0x0015A68B, 0x0015A42E, 0x0015A408, 0x0015AB2E, 0x00186580,
+    0x0015FF2E, 0x00165326, 0x00159E02, 0x0015A405, 0x0015A40A, 0x0015A40B, 0x0015A10C, 0x00162F0D,
+    0x0015A40F, 0x0015A413, 0x0015A6B5, 0x0015A134, 0x0015A184, 0x0015AB88, 0x0015B68B, 0x0015B68F,
+    0x0015B6B3, 0x00162F01, 0x0015F9AF, 0x00166C80, 0x00159E02, 0x0015AB03, 0x0015A40E, 0x0015F333,
+    0x0015A401, 0x0015AC04, 0x0015A405, 0x0015B10A, 0x0015A10C, 0x0015F30D, 0x0015A40E, 0x0015B111,
+    0x0015A6B5, 0x0015B500, 0x0015A433, 0x0015A400, 0x00159E02, 0x0015A404, 0x0015AC2E, 0x0015AC04,
+    0x0015AC28, 0x00159D83, 0x0015A405, 0x0015DF8A, 0x0015A40D, 0x00159E0F, 0x0015A413, 0x0015A118,
+    0x00159DB9, 0x0015A103, 0x0015D4B3, 0x0015A109, 0x0015A411, 0x0015ABB4, 0x0015A080, 0x0015BA02,
+    0x0015D5AD, 0x0015EB01, 0x0015D384, 0x0015A12B, 0x00166583, 0x0015AC04, 0x0015A6A6, 0x0015A405,
+    0x0015A411, 0x0015F335, 0x0015A0A7, 0x00159DAE, 0x0015B104, 0x0015AB88, 0x0015A40B, 0x0015A40D,
+    0x0015A40E, 0x0015A40F, 0x0015B6B3, 0x0015A400, 0x00173003, 0x0015A404, 0x0015A406, 0x0015AC88,
+    0x00161F0A, 0x0015A42E, 0x0015A691, 0x00166AB2, 0x0015A404, 0x0015C22F, 0x0015B101, 0x0015A40A,
+    0x0015A40D, 0x00159DB1, 0x0015AC80, 0x0015B112, 0x0015A433, 0x00163784, 0x0015F307, 0x0015E113,
+    0x0015AC34, 0x0015D58D, 0x0015A42F, 0x0015A0B3, 0x0015BA02, 0x0015D584, 0x0015A42A, 0x0015D58D,
+    0x00166CAE, 0x0015A686, 0x0015B2B3, 0x00166A82, 0x0015A406, 0x0015A40F, 0x00162991, 0x0015B514,
+    0x0015A395, 0x0015A6B6, 0x0015BB00, 0x00186684, 0x0016DA2B, 0x0015A385, 0x00159E12, 0x0015A413,
+    0x0015A6B5, 0x0015A401, 0x00166A82, 0x0015C40B, 0x0015A40F, 0x0015A192, 0x0015A413, 0x0015A094,
+    0x00186836, 0x0015A401, 0x0017CB91, 0x0015A433, 0x0015E80B, 0x0015A40D, 0x0015A42F, 0x0015AC80,
+    0x0015A42E, 0x0015A405, 0x0015A133, 0x0015A400, 0x0015AC84, 0x0015A42B, 0x00178F00, 0x0015B504,
+    0x0015A111, 0x0015ABB4, 0x0015A400, 0x0015A42E, 0x0015BE21, 0x0015BE01, 0x0015AB03, 0x0015A42A,
+    0x0015B68A, 0x00159DB1, 0x0015BA04, 0x0015A407, 0x0015A689, 0x0015A12F, 0x00186980, 0x0015A404,
+    0x0015A10C, 0x0015A40E, 0x0015EEB4, 0x00159E02, 0x00186B2E, 0x0015AC00, 0x0015A401, 0x0015A085,
+    0x0015DC08, 0x00186C0D, 0x0015A094, 0x0015A438, 0x0015A184, 0x0015D58D, 0x0015A6B6, 0x0015C42B,
+    0x0015B18D, 0x0015ACAE, 0x00159D81, 0x0015BA2D, 0x0015A40E, 0x0015A414, 0x0015BE39, 0x00159D91,
+    0x0015A434, 0x00186D80, 0x00159DA5, 0x0015A408, 0x0015A438, 0x0015A408, 0x0015A691, 0x0015A113,
+    0x0015A434, 0x0015AB32, 0x0015A400, 0x00159E02, 0x0015A408, 0x0015A434, 0x0015BA02, 0x0015A40A,
+    0x0015D58D, 0x0015A411, 0x0015A433, 0x0015A404, 0x00186F08, 0x0015A6AE, 0x0015A404, 0x0015A6A7,
+    0x00159DB1, 0x0015A103, 0x0015C404, 0x0015C208, 0x0015A80E, 0x0015A131, 0x00187084, 0x0015A42A,
+    0x0015B103, 0x0017A004, 0x0015A3AB, 0x0015A411, 0x0015AB35, 0x0015AC80, 0x0015A824, 0x00180A20,
+    0x0015D482, 0x0015A403, 0x00159E06, 0x0015C20A, 0x00160E11, 0x00180933, 0x00163784, 0x0015A407,
+    0x0015AC88, 0x0015A132, 0x0015B103, 0x0015A42B, 0x0015A400, 0x0015B681, 0x00163784, 0x0015A108,
+    0x0015B10C, 0x0015A42F, 0x0015D380, 0x00160902, 0x0015F303, 0x0015A404, 0x00161F0A, 0x0015A433,
+    0x0015C404, 0x0015EE88, 0x0015A689, 0x0015A3B2, 0x00159E02, 0x0015B683, 0x0015F304, 0x0015C006,
+    0x0015A408, 0x0015B68A, 0x0015DC0D, 0x0015AB94, 0x0015E835, 0x00163784, 0x00187312, 0x0015A433,
+    0x00159E00, 0x00162582, 0x00187504, 0x00181707, 0x0015A68A, 0x0015A393, 0x0015A434, 0x0015AC80,
+    0x00159E02, 0x0015A403, 0x0015A405, 0x00162586, 0x00159D0D, 0x0015A131, 0x00162980, 0x00163784,
+    0x0015A111, 0x0015B135, 0x0015BD04, 0x0015AC88, 0x0015A40A, 0x0015B6AD, 0x00163784, 0x0015B12B,
+    0x00175A04, 0x0015AC88, 0x0015A1B4, 0x0015B500, 0x0015B584, 0x0015A40E, 0x00173339, 0x00162582,
+    0x0015B683, 0x00161F05, 0x00161F0A, 0x0015A40C, 0x0018770D, 0x0016220F, 0x00187891, 0x00187A92,
+    0x0015A413, 0x00161A95, 0x0015A6B9, 0x0015B122, 0x0015A404, 0x00161A86, 0x0015ABB4, 0x0015B500,
+    0x00162582, 0x0015A40A, 0x0015A40F, 0x00161F11, 0x0015A692, 0x0015A413, 0x0015A6B9, 0x0015C400,
+    0x00166684, 0x00187C06, 0x0015A0A8, 0x0015A411, 0x0015A134, 0x0015A411, 0x00159E32, 0x0015AC80,
+    0x00187D84, 0x0015B18C, 0x0015BA8E, 0x0015A834, 0x0015A403, 0x0015A404, 0x0015A406, 0x0015A408,
+    0x0015A40E, 0x0015A692, 0x00173333, 0x0015A804, 0x00159D08, 0x0015A111, 0x0015A133, 0x0015B584,
+    0x0015A42F, 0x0015A404, 0x0015A433, 0x00159E02, 0x0015A687, 0x0015A1B4, 0x00187F02, 0x0015A403,
+    0x00159E26, 0x0015A400, 0x00188004, 0x0015EEA8, 0x0015A404, 0x0015A428, 0x0015A404, 0x00165EB9,
+    0x0018820D, 0x001883B1, 0x00165F84, 0x0015C4B1, 0x00188507, 0x0015A088, 0x0015A42A, 0x0015B500,
+    0x0015A42E, 0x0015A405, 0x0015A386, 0x0015A40D, 0x0015A411, 0x0015A414, 0x0015A6B5, 0x00166684,
+    0x0015A433, 0x0015AC80, 0x0015B504, 0x0015A686, 0x0015A607, 0x0015A6AD, 0x0017A004, 0x0015ACA8,
+    0x00161D80, 0x0015A40B, 0x0015A40E, 0x0015A433, 0x00188600, 0x00188781, 0x00175C04, 0x0015A608,
+    0x0015A10C, 0x0015A40D, 0x0015A40E, 0x0015C22F, 0x0015B980, 0x00159E02, 0x0015B683, 0x00188A04,
+    0x00188C86, 0x0015AC88, 0x0015B68A, 0x0015B68D, 0x0015A40E, 0x0015B693, 0x00188EB4, 0x0015A400,
+    0x0015A404, 0x00188F88, 0x0015A40E, 0x0015B12F, 0x0015A400, 0x0015A40A, 0x0015A0AE, 0x0015A40A,
+    0x0015A68B, 0x0015A40F, 0x0015A433, 0x0015D380, 0x00163784, 0x00189087, 0x0015A6B1, 0x00162C04,
+    0x0015BB08, 0x0015B50E, 0x0015A6B1, 0x0015E80C, 0x0015AB2D, 0x00159E02, 0x0015A403, 0x0015A405,
+    0x00161F0C, 0x0015A40D, 0x0015A092, 0x00162593, 0x0015A6B5, 0x0015B500, 0x0015E101, 0x0015B584,
+    0x0015A40E, 0x0015A434, 0x0015C400, 0x0015F307, 0x0015F308, 0x0015A40A, 0x0015A40E, 0x0015B334,
+    0x0015EE84, 0x0015A3A6, 0x0015AC80, 0x0015A404, 0x0015B106, 0x00189208, 0x0018942E, 0x0015A403,
+    0x0015A40D, 0x0015A68F, 0x0015A431, 0x0015B68B, 0x0015D5AE, 0x0015A400, 0x0015B5A4, 0x0015B504,
+    0x0016C7A6, 0x0015B101, 0x00189584, 0x0015C205, 0x0015A688, 0x0015B68A, 0x0015A40C, 0x0015B68D,
+    0x00161F0F, 0x00159D11, 0x0015A392, 0x0015A433, 0x00163784, 0x0015B12F, 0x00160580, 0x0015B683,
+    0x00162984, 0x00160F88, 0x0015E131, 0x00189684, 0x0015B132, 0x0015D480, 0x0015A404, 0x0015B988,
+    0x0015A40E, 0x0015A112, 0x00174513, 0x0015A434, 0x00159D04, 0x00159E06, 0x0015F308, 0x0015A10C,
+    0x0015B58D, 0x0015F30F, 0x00163411, 0x0015F112, 0x0015A433, 0x0015A080, 0x00174C84, 0x0015A6A8,
+    0x0015AC80, 0x0015D204, 0x0015E10B, 0x0017FE8D, 0x0015A40F, 0x0015B111, 0x0015A692, 0x0015A433,
+    0x0015C420, 0x0015B584, 0x0015A131, 0x0015A404, 0x0015BB08, 0x00161F0A, 0x0015A6B1, 0x0015A404,
+    0x0015B988, 0x0015A42E, 0x0015C225, 0x0015A40B, 0x0015A434, 0x0015A400, 0x00159D81, 0x0015BA84,
+    0x0016530C, 0x00161F2F, 0x0016E080, 0x00162582, 0x0015DC04, 0x00189906, 0x0015A40A, 0x0015A433,
+    0x0015AC88, 0x0015E8B4, 0x00162582, 0x00189A84, 0x0015FE06, 0x0015BB08, 0x0015A40A, 0x0015B111,
+    0x0015A6B5, 0x0015B504, 0x0015B107, 0x0015A40A, 0x00161F13, 0x0015A434, 0x00189CA4, 0x0015B135,
+    0x0015A40C, 0x0017B411, 0x0015A6B2, 0x0015B184, 0x0015A131, 0x0015A404, 0x001625AF, 0x0015A404,
+    0x00161DA8, 0x0015B584, 0x0015EE88, 0x0015AC0E, 0x0015A132, 0x0015B584, 0x0015A687, 0x0015B988,
+    0x0015A133, 0x00159D04, 0x0015F331, 0x00189E80, 0x00163784, 0x00189F87, 0x0015A40A, 0x0015A68B,
+    0x0015AC8E, 0x00163231, 0x0015D980, 0x0015A686, 0x00159D08, 0x0015E10B, 0x0015A6B1, 0x0018A1A8,
+    0x0015A404, 0x0015A406, 0x00161D88, 0x0015E80C, 0x0015A08E, 0x0015A434, 0x0015A68E, 0x0015A114,
+    0x0015A136, 0x0015A403, 0x00162F0A, 0x00173B0B, 0x0015A40C, 0x0015A40D, 0x0015F311, 0x0016F792,
+    0x0015A3B9, 0x0015B500, 0x0016E084, 0x0015A408, 0x0015A42E, 0x0018A280, 0x0015A404, 0x00168688,
+    0x0015A40B, 0x0015B68C, 0x0015B693, 0x0015A414, 0x0015A115, 0x0015A136, 0x0015A400, 0x00185201,
+    0x00165304, 0x0015A688, 0x0017BD2C, 0x0015DC00, 0x00159D83, 0x0018A484, 0x0018A706, 0x0018A988,
+    0x0015B10A, 0x0015E10B, 0x0015A10D, 0x0016E08E, 0x0015A692, 0x00162A93, 0x001629B4, 0x0015BE00,
+    0x0015A3AB, 0x0018AB00, 0x00180F02, 0x0015B103, 0x0015A404, 0x0015F306, 0x0018AC88, 0x0015C20A,
+    0x0016340B, 0x0015A40C, 0x0016150E, 0x00183211, 0x00169612, 0x0015A413, 0x0015B135, 0x0015A400,
+    0x00163784, 0x0015B107, 0x0015A40A, 0x0015BA8E, 0x0018AD92, 0x0015B693, 0x0015A434, 0x00159D80,
+    0x00162582, 0x00168C04, 0x0015A407, 0x0015AC88, 0x0015AB0B, 0x0015F313, 0x0015EDB9, 0x0015B101,
+    0x0015A403, 0x0015A40B, 0x00159D0D, 0x00159D91, 0x0015B112, 0x0015A413, 0x0015A395, 0x0015B139,
+    0x0015AC84, 0x0018AF28, 0x00159D04, 0x0015B68A, 0x0015A40D, 0x0015A431, 0x0015B584, 0x00179428,
+    0x0015EE80, 0x0015A381, 0x00159D04, 0x0016E08E, 0x0015A0B2, 0x00179784, 0x0015A0B4, 0x0015A403,
+    0x00161F0B, 0x0018B08D, 0x0015A691, 0x0015A692, 0x00160BB3, 0x0015E802, 0x0015A407, 0x0015A42A,
+    0x0015C400, 0x0018B288, 0x0015A6AB, 0x0015A403, 0x0015A411, 0x0015A433, 0x0015F98D, 0x00159E33,
+    0x0015A12A, 0x0015A400, 0x0015A101, 0x0015A403, 0x0015A384, 0x0018B408, 0x0015A40B, 0x0015BA8E,
+    0x0015B6B3, 0x0015A404, 0x0015A42E, 0x00159D00, 0x0015A403, 0x0015B584, 0x0015F306, 0x0018B512,
+    0x0015ED93, 0x0015A434, 0x0015A414, 0x0015A436, 0x00160B82, 0x0015A683, 0x0016E304, 0x0015A386,
+    0x0018B688, 0x0015A40A, 0x0015F30B, 0x0015E111, 0x0015A6B2, 0x00162980, 0x00162984, 0x0015B107,
+    0x0015B988, 0x0015A68D, 0x0015AC8E, 0x0015B112, 0x0015AB33, 0x0015C400, 0x0015D204, 0x00162F07,
+    0x0018B808, 0x0015AC0E, 0x0018B9B1, 0x0015A6B2, 0x0015A404, 0x00162339, 0x0015B531, 0x0018BA8E,
+    0x0015AB92, 0x0015AC34, 0x0015A400, 0x0016F787, 0x0015B68A, 0x0015A40E, 0x00185231, 0x0015B103,
+    0x00161A86, 0x0015A408, 0x0015A632, 0x0015A40D, 0x0015A6B5, 0x0015B685, 0x0015B133, 0x0015A406,
+    0x0015A627, 0x0015B584, 0x0015A111, 0x0015A135, 0x00159E02, 0x0015A403, 0x00166684, 0x0015A405,
+    0x0015A108, 0x00183E8A, 0x0015F30B, 0x0016668E, 0x0015A10F, 0x001693B3, 0x0018BB84, 0x00161D88,
+    0x0015B132, 0x0015F700, 0x00161A82, 0x0015A403, 0x0015D204, 0x00163406, 0x00179408, 0x0015F30A,
+    0x0015B10D, 0x0016E08E, 0x00161F13, 0x0015E8B4, 0x0018BD84, 0x0015DE88, 0x0015B68A, 0x0015B10B,
+    0x0015A40E, 0x00162593, 0x0015A415, 0x0015A139, 0x00159E02, 0x0015AB03, 0x0016E084, 0x0015AB06,
+    0x0015A40E, 0x00185112, 0x0015B6B3, 0x00159E02, 0x00166684, 0x0015A408, 0x0015A691, 0x0015A433,
+    0x00163C04, 0x0015A693, 0x0015A1B4, 0x0015AC84, 0x0015B139, 0x0015B101, 0x0015B684, 0x0015A688,
+    0x0015A6AB, 0x0018BF07, 0x0015A42A, 0x0015C400, 0x0018C104, 0x0015A686, 0x00159D88, 0x0015A434,
+    0x0015B106, 0x0015C434, 0x0015AC04, 0x0015A40E, 0x0015A411, 0x0015DA34, 0x0015F30B, 0x0015B191,
+    0x0015A612, 0x0015A433, 0x0018C300, 0x00161F03, 0x0015B584, 0x0017300B, 0x00162F13, 0x0015A438,
+    0x0015A404, 0x00165E8C, 0x0015A434, 0x00187D80, 0x00162303, 0x0018C484, 0x00162F06, 0x0018C588,
+    0x0015A40A, 0x0015A40E, 0x0018C6B3, 0x0015A401, 0x00159E02, 0x00161F03, 0x00159D04, 0x0015A40A,
+    0x0018C80B, 0x0018CA0D, 0x0015A40F, 0x0015B691, 0x0015A392, 0x0015A413, 0x0015A6B5, 0x00179784,
+    0x0015B10F, 0x0015B112, 0x0015A434, 0x0018CB80, 0x00162984, 0x0015A108, 0x0015F30D, 0x0015BA8E,
+    0x0016258F, 0x0015ED91, 0x0015A692, 0x0015A433, 0x00160E04, 0x0015A40A, 0x0018CE12, 0x0015F333,
+    0x0018CF04, 0x0015B687, 0x0015E708, 0x0015A80E, 0x0018D213, 0x0015A414, 0x0015A139, 0x00159E02,
+    0x0015A404, 0x00185C8B, 0x0016C08D, 0x0015A40F, 0x0015BA91, 0x00184612, 0x001625B3, 0x0015D204,
+    0x0015A3A8, 0x0015A400, 0x00175A04, 0x0015A131, 0x0015A400, 0x0015A6A8, 0x0015A400, 0x0015F32B,
+    0x0015A0A4, 0x0015AB07, 0x00185B08, 0x00161F0A, 0x0015B50E, 0x0015AB11, 0x0015E8B4, 0x0015E103,
+    0x0015A686, 0x0015B508, 0x0015A131, 0x0015A405, 0x00159DB3, 0x00173026, 0x0015B12B, 0x0015A403,
+    0x0015A40B, 0x0015A411, 0x0015A0B2, 0x00171382, 0x00160E04, 0x0015A106, 0x0015A688, 0x0015C20B,
+    0x00162732, 0x00161F0C, 0x0015A40F, 0x0015B112, 0x0015A434, 0x00162582, 0x00180486, 0x0015A408,
+    0x001669B3, 0x00166080, 0x0018BD84, 0x00159D08, 0x00161F0A, 0x0015B68B, 0x0018D411, 0x00159D93,
+    0x0015A135, 0x0015B500, 0x0015A102, 0x00166284, 0x00185107, 0x00177C08, 0x00161F0A, 0x0015A40E,
+    0x00165312, 0x00160BB3, 0x00159E02, 0x00163784, 0x0015A107, 0x0015A408, 0x0015AC8E, 0x0015A433,
+    0x0015BA00, 0x0015B139, 0x0015D4A0, 0x00159D08, 0x0015A10C, 0x0016342F, 0x001625B1, 0x0016CAA7,
+    0x0015A40C, 0x0015A42D, 0x0015A404, 0x0015A408, 0x0015A40A, 0x0015A10B, 0x0015FF2E, 0x00162307,
+    0x0015A6B1, 0x0015A400, 0x0015A828, 0x0015EB35, 0x0015A400, 0x0015B106, 0x0015B52E, 0x00159D00,
+    0x0015A405, 0x0015A40A, 0x0015A40B, 0x0018D691, 0x0015A3B5, 0x0015BD04, 0x0015A125, 0x0015A400,
+    0x00159D04, 0x0015A12B, 0x00163784, 0x0015A10C, 0x0015A434, 0x0015A400, 0x00165302, 0x0015BE03,
+    0x0018510D, 0x0015A40E, 0x0015A134, 0x0015A400, 0x0015B584, 0x0015AB0E, 0x0016BAAF, 0x0015A400,
+    0x00162F02, 0x0015A403, 0x0015A404, 0x00160F88, 0x0015B68A, 0x0015A6B1, 0x0015C400, 0x00159D87,
+    0x0015E133, 0x0015C400, 0x00159E02, 0x0015A404, 0x0015A408, 0x0015B133, 0x00159E02, 0x0015A0AD,
+    0x00165F80, 0x0018D784, 0x0015B135, 0x0015FF20, 0x0015A404, 0x001666A8, 0x0015A129, 0x0015A685,
+    0x0015A40B, 0x0015A40F, 0x0015A411, 0x0015D4B3, 0x0018D924, 0x00161F03, 0x0016020B, 0x0015B40C,
+    0x0015A40F, 0x0015A692, 0x0015A6B9, 0x0015AB11, 0x0015A434, 0x0015A405, 0x00162586, 0x0015A092,
+    0x0015A6B5, 0x0015A408, 0x0015B12B, 0x0015A400, 0x0015A40D, 0x0015A0AF, 0x0015B504, 0x0015A0A8,
+    0x0015AC00, 0x00161F03, 0x0015C20A, 0x0015AC0E, 0x00181613, 0x00161AB5, 0x0015A404, 0x0015A18E,
+    0x0015B6B3, 0x0015A40A, 0x0015F32C, 0x0018C304, 0x0015A434, 0x0015A401, 0x0018DA04, 0x0015A688,
+    0x0015E10B, 0x0015B112, 0x0015A433, 0x0015A413, 0x0015A434, 0x0015AB08, 0x0015A10D, 0x00159DB3,
+    0x00159D00, 0x0015A804, 0x00166E07, 0x0015A40A, 0x0015AC2E, 0x0015AC00, 0x0015B584, 0x0015B50E,
+    0x0015A434, 0x0015A382, 0x0015A405, 0x0015A6B5, 0x0015A404, 0x0015B685, 0x0015B133, 0x0015B504,
+    0x00162227, 0x0018DBA0, 0x0015D381, 0x0015A42F, 0x00166684, 0x0015E809, 0x0015E10D, 0x0015AC8E,
+    0x001625B3, 0x0015A400, 0x0015B12F, 0x0015B6AB, 0x00159D84, 0x0015A692, 0x0015A434, 0x00166684,
+    0x00159D08, 0x0015AC8E, 0x0018DD11, 0x0015B133, 0x0015B101, 0x0015F12B, 0x0015AC00, 0x0015B103,
+    0x0015A404, 0x0015A434, 0x0015B68B, 0x0015A08D, 0x0015A411, 0x0015F132, 0x0015A404, 0x0015A40B,
+    0x0015A42E, 0x0015FB00, 0x0015EE84, 0x0015B988, 0x0015D3AE, 0x0015A400, 0x0015A682, 0x0015DC04,
+    0x0015A406, 0x0015A408, 0x0015B10D, 0x0015AC38, 0x0015A401, 0x0015A088, 0x0015B68A, 0x0015A40D,
+    0x0015A40F, 0x0015A3B2, 0x0015C208, 0x0015A40A, 0x0015C20C, 0x001625B3, 0x00168C24, 0x0015AC00,
+    0x00162582, 0x00163784, 0x0015ABB4, 0x0017FE8B, 0x0015B68D, 0x0015A42F, 0x0015F300, 0x0015C404,
+    0x0015ABB4, 0x0015B100, 0x00159D04, 0x0015A40B, 0x0015B6B3, 0x0015AC00, 0x0015A424, 0x0015BE00,
+    0x0015B5A4, 0x0015B101, 0x0015A128, 0x0015A127, 0x0015B103, 0x00166684, 0x0015A386, 0x0015A688,
+    0x00159E39, 0x0015A401, 0x0015AC84, 0x0015B12C, 0x0015B683, 0x0015A40B, 0x0015A411, 0x0015A3B2,
+    0x00166592, 0x0015E133, 0x00166C85, 0x0015A12B, 0x0015BAAE, 0x0015A132, 0x0018DE84, 0x0015ABB4,
+    0x0015A404, 0x0015A408, 0x0015A433, 0x00161504, 0x0015A427, 0x00159E00, 0x00159D8B, 0x0015A392,
+    0x0015A438, 0x0015A400, 0x00159D04, 0x0015A088, 0x0015A433, 0x0015A404, 0x001731AB, 0x0015AB80,
+    0x0015A834, 0x0015BAA0, 0x00166684, 0x00165331, 0x0018E000, 0x0015A604, 0x0015AC38, 0x0015A407,
+    0x0015A42B, 0x0015A804, 0x0015E12B, 0x0015AC8E, 0x0015ABB4, 0x0015C992, 0x0015ABB4, 0x0015A411,
+    0x0015B534, 0x0015F32B, 0x0015C400, 0x00175A04, 0x0015A6A8, 0x0015D5A0, 0x0018E224, 0x0015A400,
+    0x0015D5AD, 0x0015A40A, 0x0015A433, 0x00159D8F, 0x0015A438, 0x0017B304, 0x0015A6A8, 0x00173888,
+    0x0015A08D, 0x0015A40E, 0x0015ABB4, 0x0015A40E, 0x0015A3B5, 0x0018E300, 0x0015B504, 0x0015A6A8,
+    0x0015B126, 0x0015A680, 0x0015A424, 0x0015B504, 0x0015A391, 0x0015A434, 0x0015E806, 0x0015A40D,
+    0x0015A431, 0x0015A435, 0x0018E404, 0x0015A434, 0x0015B10B, 0x0015B6B1, 0x0015BA8E, 0x0015ABB4,
+    0x00159E2F, 0x0015A40D, 0x0015A68F, 0x0015E831, 0x0018E58D, 0x0015D9B4, 0x0015BD04, 0x00161DA8,
+    0x00180902, 0x0015A40B, 0x0018E68D, 0x0015A6B3, 0x00159D04, 0x0015A628, 0x0015A400, 0x0015ACA8,
+    0x0015A804, 0x0015A42E, 0x0015BA80, 0x0016E808, 0x0015A6B4, 0x00159D81, 0x0015AC04, 0x0015A137,
+    0x0015A404, 0x0018E7AE, 0x0015B988, 0x0015AC2E, 0x0015BE0A, 0x0015B131, 0x0015B500, 0x0015A804,
+    0x0015A42E, 0x0015A627, 0x0015A382, 0x0015B123, 0x0015A400, 0x00159D04, 0x0015F327, 0x0015AC04,
+    0x0015A433, 0x0015B101, 0x00163203, 0x00175A04, 0x00163206, 0x00162311, 0x0015A133, 0x0015AC04,
+    0x0015A42E, 0x0015A40B, 0x0015E111, 0x0015A3B3, 0x0015A38D, 0x0015A0B2, 0x0015BB08, 0x0017332B,
+    0x0015A404, 0x0015C92D, 0x00160A24, 0x00175A24, 0x0015A411, 0x0015A6B8, 0x00160803, 0x0015A404,
+    0x0015F32C, 0x0015A1A8, 0x00159DAA, 0x0015A3AD, 0x0015A400, 0x00179784, 0x0015A107, 0x0015A40A,
+    0x0015A40E, 0x0015C233, 0x0015E103, 0x0015A408, 0x0015A68B, 0x0015A10C, 0x0015EB31, 0x0015AC80,
+    0x0015AB03, 0x0015ACAE, 0x0015BA80, 0x00163784, 0x0015A68B, 0x00159D0E, 0x00159DB1, 0x0015A40A,
+    0x0015A40B, 0x0016220D, 0x0015F311, 0x0015B1B2, 0x0015B680, 0x0018E884, 0x0015A408, 0x00159D8A,
+    0x0017300B, 0x0015B68C, 0x0015D38F, 0x00185132, 0x0015A12F, 0x0015BC80, 0x0015A682, 0x00173003,
+    0x00165D04, 0x0015C206, 0x0018EB08, 0x0015AB0A, 0x0015EB0D, 0x0015E112, 0x001647B3, 0x0017332B,
+    0x0018D780, 0x0016E084, 0x0015FE2F, 0x0015F300, 0x00159E02, 0x0016CA83, 0x0018EC04, 0x00162306,
+    0x0015A408, 0x0018BF0A, 0x0016530B, 0x0015A10C, 0x0015AC0E, 0x0015A40F, 0x0016C191, 0x0015A392,
+    0x00177E93, 0x00162335, 0x00162F04, 0x00180E07, 0x0015A10A, 0x0015B10F, 0x0015A692, 0x0018EFB3,
+    0x00162582, 0x00163C04, 0x0015A407, 0x0018F188, 0x0015A10A, 0x0015B10B, 0x0015E112, 0x00178493,
+    0x0015A434, 0x0015A400, 0x0015A40B, 0x0015A3B2, 0x0015AC80, 0x00163C04, 0x0018F2A8, 0x00186B00,
+    0x0015BD04, 0x0015B68A, 0x0015A40B, 0x0015A42D, 0x0018F404, 0x0015B50E, 0x00159D32, 0x0018F582,
+    0x0015F306, 0x0015B68A, 0x0015A40B, 0x0015A40D, 0x0018F691, 0x0015A692, 0x0015B693, 0x0015B115,
+    0x0015A6B9, 0x0015BA80, 0x0015A407, 0x0016342A, 0x0015C400, 0x0015A404, 0x0015A408, 0x0015AB31,
+    0x0015A682, 0x0015A40A, 0x0015A40B, 0x0015A40D, 0x0015B10E, 0x0015F30F, 0x0015B691, 0x0015A6B5,
+    0x0015B106, 0x0015A427, 0x0015A40D, 0x0015A692, 0x0015A6B9, 0x0015AC80, 0x0015A404, 0x0015AC88,
+    0x0015A6AE, 0x00166980, 0x0015A404, 0x0015A405, 0x0015A40B, 0x0015A10C, 0x0015AC8E, 0x0015C233,
+    0x0015C400, 0x0015A382, 0x00166983, 0x0015B584, 0x0015AB06, 0x0015F308, 0x0015A40A, 0x0018F88D,
+    0x0015A433, 0x0015A10B, 0x0015A40E, 0x0015B10F, 0x00159DB2, 0x00159D80, 0x00172982, 0x0018FA83,
+    0x0015C204, 0x00166088, 0x00161F0A, 0x0015A40C, 0x0015A40D, 0x0015D58E, 0x0015A40F, 0x0015B111,
+    0x0016F792, 0x0015A413, 0x001635B5, 0x0015E10A, 0x0015A40E, 0x0018FBB3, 0x00165F80, 0x0015B504,
+    0x0015A088, 0x0015EB11, 0x0018FD33, 0x0015A684, 0x0015A0A8, 0x0015A686, 0x0015D58D, 0x0017AF11,
+    0x0015A3B2, 0x0015B504, 0x0015A68D, 0x0015AC8E, 0x0015A6B2, 0x0015AC00, 0x00159E12, 0x0015B2B9,
+    0x0015BCAE, 0x0015A102, 0x0018FE8D, 0x00168E33, 0x0015B1AB, 0x00179BAD, 0x00162980, 0x0015B102,
+    0x00161F0A, 0x0015A08E, 0x0015A111, 0x0015AC34, 0x0015A382, 0x00159D0D, 0x0015DC11, 0x0016C193,
+    0x0015AB39, 0x0015E106, 0x0015A087, 0x0015B12C, 0x00166980, 0x00179784, 0x0015A408, 0x0015AC34,
+    0x00190080, 0x00159E02, 0x00190384, 0x0015A408, 0x0015A40B, 0x0019060E, 0x00178F34, 0x0015A400,
+    0x0015A42F, 0x0015A400, 0x00162582, 0x0015A484, 0x00162F06, 0x00183E8A, 0x00165E8D, 0x0016B70E,
+    0x00190713, 0x0015A1B4, 0x0015B68D, 0x0015A414, 0x0015F338, 0x00162980, 0x00190884, 0x0015DC08,
+    0x0015B10F, 0x0015AC34, 0x0015A3B4, 0x00159D80, 0x0015A40B, 0x0015A40D, 0x0015D5AE, 0x0015AB02,
+    0x0015A404, 0x0015B10A, 0x0015A40E, 0x0015B112, 0x0015A6B3, 0x0015A400, 0x00162582, 0x00161F07,
+    0x0016B70E, 0x0015A133, 0x0015A62E, 0x00166084, 0x0015A3A8, 0x0015B584, 0x0015E839, 0x0015A400,
+    0x00190A82, 0x0015A686, 0x00190B88, 0x00190D0D, 0x0015A40F, 0x00190F12, 0x00182693, 0x0015C218,
+    0x0015E839, 0x0017F600, 0x0015F301, 0x0015A10D, 0x0015AC8E, 0x00159E12, 0x0015A436, 0x0015A102,
+    0x00176704, 0x0015A40C, 0x001689AD, 0x0015A080, 0x0015A403, 0x0016898D, 0x0015BA0E, 0x0015A40F,
+    0x00181613, 0x0015BA14, 0x0015A416, 0x0015F338, 0x00166A82, 0x0015A404, 0x00166C85, 0x0015A406,
+    0x0019108C, 0x00166A8D, 0x0015A08E, 0x00162592, 0x0015AB33, 0x00159E02, 0x0015B1AA, 0x0015B12E,
+    0x0015AC00, 0x0015B103, 0x0015BC84, 0x00165306, 0x0015A128, 0x0015A40C, 0x0015A40F, 0x0015E112,
+    0x0015A433, 0x0015B104, 0x0015A686, 0x0015A42E, 0x0015BE0B, 0x0017CA8D, 0x0015A3B2, 0x0015AC00,
+    0x00174C84, 0x0015A6A8, 0x0015A800, 0x00179784, 0x00162F08, 0x0015A689, 0x0017148A, 0x0015B68B,
+    0x0015A40E, 0x0015A413, 0x001661B8, 0x0015A681, 0x0015A404, 0x0015B10C, 0x0015A40E, 0x0015A42F,
+    0x00165302, 0x0015A403, 0x0015B684, 0x00191306, 0x0015A40A, 0x0015B693, 0x0015BE39, 0x00162582,
+    0x0015A403, 0x00159D04, 0x0015B685, 0x0015A407, 0x0015A109, 0x0015C20A, 0x0015A40B, 0x0015A40D,
+    0x0015B68F, 0x00188511, 0x0015A413, 0x00165335, 0x0015A404, 0x0018510F, 0x0015B132, 0x00175B00,
+    0x00162582, 0x00163784, 0x00165306, 0x0015AC88, 0x0015B68A, 0x0016478D, 0x00173033, 0x00174C84,
+    0x0015AB07, 0x0015A608, 0x0015A392, 0x0015A433, 0x0015A680, 0x00159E02, 0x0015B584, 0x0015AC88,
+    0x0015AB0E, 0x0015B112, 0x001647B3, 0x00162582, 0x00184A85, 0x0015F30A, 0x0019150B, 0x0015BB0D,
+    0x0016F78F, 0x0015A411, 0x00161F33, 0x0015AC80, 0x0015A804, 0x0015AC88, 0x00160E0D, 0x0015A6B1,
+    0x0015A08D, 0x0015BE0E, 0x0015A6B2, 0x0015AB80, 0x0015A403, 0x0015BE07, 0x0015A40C, 0x0019168D,
+    0x0015A40E, 0x0015A692, 0x00191813, 0x0015A414, 0x0015BA96, 0x0015A438, 0x0015B103, 0x00191A04,
+    0x00166C88, 0x0015B68C, 0x0015A08D, 0x0018E78E, 0x0015A40F, 0x00191B92, 0x0015A695, 0x0015B117,
+    0x0015A438, 0x0015AC00, 0x00191D82, 0x0015A383, 0x00191F04, 0x0015A406, 0x0015AC0B, 0x0019210C,
+    0x0016828D, 0x0015BB8E, 0x00192492, 0x0015E115, 0x0015A3B9, 0x0015A400, 0x00160801, 0x0015A403,
+    0x0015AB84, 0x0015A405, 0x0015A406, 0x0015AC88, 0x0015A68A, 0x00175B0B, 0x00162F0C, 0x0019260D,
+    0x0016820E, 0x0015A40F, 0x0015A691, 0x00192792, 0x0015AB13, 0x00192A14, 0x0015A395, 0x00166096,
+    0x0015E117, 0x0015ACB8, 0x0015A383, 0x00166E0D, 0x0015A133, 0x0015B504, 0x0015A6B2, 0x0015D9AB,
+    0x00159D34, 0x0015AAA0, 0x00173180, 0x0015A131, 0x00159E02, 0x0015A1AE, 0x0015AB02, 0x0015A404,
+    0x0015F8A8, 0x0015AC80, 0x00166684, 0x0015C22A, 0x0015B103, 0x00178486, 0x0015B988, 0x0015B50E,
+    0x0015B112, 0x0015A434, 0x0016C1A5, 0x0015B106, 0x0015AC28, 0x0015A400, 0x00179784, 0x0015A10A,
+    0x0015A434, 0x00162F00, 0x00163784, 0x0015DB08, 0x0015C20A, 0x0016CA8B, 0x0015AB0C, 0x00161F0F,
+    0x0015A392, 0x0015A434, 0x0015A400, 0x0015A688, 0x0015A42F, 0x0015A400, 0x00169602, 0x0015C206,
+    0x00159D89, 0x0017300A, 0x0015B10D, 0x001647B3, 0x0015F300, 0x0015C408, 0x0015E10F, 0x0015A434,
+    0x0015A103, 0x00192B04, 0x0015A386, 0x0015EE88, 0x0015A40B, 0x0015B10F, 0x0015A411, 0x00161A92,
+    0x0015B133, 0x0015A404, 0x0015E107, 0x0015A6AB, 0x00159D08, 0x0015AC8E, 0x00192D33, 0x0015AC00,
+    0x0015E12C, 0x00159D08, 0x0015A433, 0x00160580, 0x00192F04, 0x0015B988, 0x0015A42E, 0x0015B584,
+    0x0015F328, 0x0015B2B9, 0x00193020, 0x00166A82, 0x0015A403, 0x00166C85, 0x0015A406, 0x00193088,
+    0x00161A8A, 0x0019320B, 0x0015A08D, 0x00193311, 0x00193492, 0x0015F313, 0x0015B5B8, 0x0015AC80,
+    0x0017B304, 0x0015C40B, 0x0015A68C, 0x0015A10D, 0x00193611, 0x0015A612, 0x0015A394, 0x0015EEB8,
+    0x00171702, 0x0015A403, 0x0015A604, 0x00166C85, 0x0017B00B, 0x0015A40C, 0x0019370D, 0x0016BC0F,
+    0x0017F191, 0x0015A092, 0x00160833, 0x00159D00, 0x0015A403, 0x00193988, 0x0015AC0B, 0x0015BA0D,
+    0x0015A40F, 0x00193B33, 0x00159E32, 0x0015A080, 0x0015DF81, 0x00193CA8, 0x0015D204, 0x0015A687,
+    0x0015A40A, 0x0015ACAE, 0x0015A800, 0x0015A686, 0x00193E08, 0x0015ACAE, 0x0015A405, 0x0015A433,
+    0x0015A400, 0x0015A683, 0x00184104, 0x00173006, 0x0015A408, 0x0015A434, 0x00159D04, 0x00159DB4,
+    0x0015A400, 0x0015A403, 0x0015A40A, 0x0015F30B, 0x0015CD0D, 0x00159D11, 0x0015A392, 0x0015C233,
+    0x00180F00, 0x0015A424, 0x00184104, 0x0015C208, 0x0015A434, 0x0015A404, 0x0015E10B, 0x001625AF,
+    0x0015AC00, 0x00193F84, 0x0018AF08, 0x0015B10C, 0x0015A40F, 0x0015A434, 0x0015A400, 0x00169602,
+    0x00161F03, 0x0015A684, 0x00194106, 0x0015B588, 0x0015F30A, 0x0015A433, 0x00163784, 0x0015A687,
+    0x0015BB08, 0x0015A6AF, 0x00194384, 0x0015A42A, 0x00163784, 0x00161F0F, 0x0015A692, 0x0015A133,
+    0x00194580, 0x00159E02, 0x0016E304, 0x0016C787, 0x00163208, 0x00162F0E, 0x0015E113, 0x0015A434,
+    0x0015A40D, 0x0015AB2F, 0x00194704, 0x0015ACA8, 0x0015B504, 0x0015AC88, 0x0015B10B, 0x0015A42D,
+    0x0015D480, 0x00159D04, 0x0015A68B, 0x0015A68D, 0x0015BAAE, 0x00184104, 0x00194A2E, 0x00194B02,
+    0x0015A483, 0x0015A408, 0x0015A40A, 0x00194C0B, 0x0016340C, 0x0015A40D, 0x0015A40F, 0x00179411,
+    0x0015A092, 0x0015B193, 0x0015A6B5, 0x0015A800, 0x0015A681, 0x00194D84, 0x0017B408, 0x0015A18E,
+    0x00194EB4, 0x00195000, 0x0018DD02, 0x0015A088, 0x0015A40A, 0x0015AC8E, 0x00170B93, 0x0017DF34,
+    0x0015AC80, 0x0015B683, 0x0015B584, 0x00195108, 0x0015B10B, 0x0018860E, 0x0015B111, 0x00195294,
+    0x0015A6B8, 0x00159E02, 0x0015CD03, 0x0015B685, 0x0015B68A, 0x0015A40B, 0x0015A40D, 0x0015A092,
+    0x0015A6B5, 0x0018DA04, 0x0015AB05, 0x00195388, 0x0015B10B, 0x0015B131, 0x00165F80, 0x0015A404,
+    0x0015AB06, 0x0015A688, 0x0015A10C, 0x0015A10D, 0x0015A40E, 0x0015B534, 0x00195500, 0x0015ABA4,
+    0x0015B685, 0x0015BA86, 0x0015D38A, 0x0015DB0D, 0x00159D11, 0x0015A092, 0x0015A6B5, 0x0015D588,
+    0x0015ACAE, 0x00195580, 0x0015A084, 0x00195688, 0x0015AB2B, 0x0018E780, 0x00195804, 0x001959A8,
+    0x0017A780, 0x0015A403, 0x00195A84, 0x0015A106, 0x00195B88, 0x0015A68D, 0x0015A40E, 0x0015F333,
+    0x0015AC08, 0x0015D5B1, 0x0015E100, 0x00195C84, 0x0015AC88, 0x0018510B, 0x0015DC0E, 0x0015A40F,
+    0x0015AB31, 0x0015AC80, 0x0015D588, 0x0015BAB4, 0x00195D80, 0x00195F04, 0x00196108, 0x0019628E,
+    0x00164793, 0x0015A434, 0x00196380, 0x00162582, 0x0015AB84, 0x0015B188, 0x0015BC8E, 0x00184031,
+    0x00196484, 0x0015A688, 0x0015A3B4, 0x00196580, 0x0017B404, 0x0015AC88, 0x0015AC8E, 0x00159E33,
+    0x0015A400, 0x0015A68C, 0x0015ABB4, 0x0015A404, 0x0015A68C, 0x0018B9AD, 0x0015B103, 0x0015FF0C,
+    0x0015A6AD, 0x0015FF2C, 0x0015A38C, 0x0015A68D, 0x0015A133, 0x0015A403, 0x0015A40B, 0x0015A08D,
+    0x0015A133, 0x0015A400, 0x0015B101, 0x0015A424, 0x00179784, 0x0015A087, 0x0015AC88, 0x0015A42A,
+    0x0016E084, 0x00161A86, 0x0015B9A8, 0x0015A40B, 0x0015A40C, 0x0015A6B5, 0x0015B504, 0x0015A405,
+    0x0015A38B, 0x00163433, 0x0015A406, 0x0015A607, 0x0015BB08, 0x0017092E, 0x00160E04, 0x0015F32B,
+    0x0015A680, 0x00163784, 0x0015A434, 0x0015B683, 0x0015A404, 0x0015A406, 0x0015A40A, 0x0015A3B2,
+    0x0015A109, 0x0015A433, 0x00181004, 0x0015A42F, 0x0016EC04, 0x00159D87, 0x00161F0A, 0x0015A40F,
+    0x0015A434, 0x0015A404, 0x0015A413, 0x0015B139, 0x00166080, 0x001966A4, 0x00162582, 0x0015A403,
+    0x0015A40C, 0x0015A40D, 0x0015B691, 0x0015A612, 0x0015A6B3, 0x0015B584, 0x0015BA88, 0x0015A68B,
+    0x0015A62E, 0x00161F2A, 0x001969A4, 0x0015A804, 0x00161AB4, 0x0015A403, 0x0015B68B, 0x0015A40D,
+    0x0015A0B2, 0x0015BA00, 0x0015A428, 0x0015D580, 0x0015A404, 0x0015A405, 0x0015A42B, 0x00160580,
+    0x0015AB04, 0x0015A42F, 0x00162303, 0x00162F04, 0x0015AC88, 0x0015A68D, 0x0015F333, 0x0015A403,
+    0x0015B685, 0x0015B68A, 0x00161F0C, 0x0015A40D, 0x0015B68F, 0x0016C912, 0x0015B6B3, 0x0015A6B4,
+    0x0015AC00, 0x0015A404, 0x00196B08, 0x0015B6B3, 0x00188384, 0x00159D87, 0x0016B708, 0x0015D3B3,
+    0x00194580, 0x00159E02, 0x0015B584, 0x0015A408, 0x0015A40B, 0x00196C8E, 0x0015A6B3, 0x0015EE84,
+    0x0018F586, 0x0015F30B, 0x0015A40C, 0x0015BB0D, 0x0015B68F, 0x00166E12, 0x00196E33, 0x00162C24,
+    0x0015AC80, 0x0015E103, 0x00196F84, 0x0015A688, 0x0015A68C, 0x00159D0D, 0x0015D4B3, 0x0015C400,
+    0x0015A68D, 0x0015A0B2, 0x0015A084, 0x0015A0A8, 0x00159D80, 0x0015B101, 0x00162984, 0x0015AC88,
+    0x0015EB0B, 0x0015A434, 0x0015A687, 0x0015A42A, 0x0015A400, 0x00161F03, 0x0016E084, 0x0015F328,
+    0x0015A103, 0x0015A431, 0x0015F325, 0x00175B00, 0x0015E101, 0x0015B126, 0x00168F2D, 0x0015AC00,
+    0x00197181, 0x0015EE84, 0x0015B10B, 0x0015B10C, 0x0015A80E, 0x001647AF, 0x00159E02, 0x0015A403,
+    0x0015B584, 0x0015A406, 0x0015B988, 0x0015B10D, 0x0015B6B3, 0x0015A384, 0x0015A128, 0x0015C400,
+    0x0015A40F, 0x0015A434, 0x0015A400, 0x0015A404, 0x0015B107, 0x0015A40A, 0x0015A10C, 0x0015A692,
+    0x00161F33, 0x0015A407, 0x0015AC88, 0x0015B133, 0x0015AC00, 0x00163784, 0x0015A107, 0x00161508,
+    0x0015A68B, 0x0015A08E, 0x0015B1B1, 0x0015A40A, 0x0015A131, 0x0015AB03, 0x0015A404, 0x0017CE87,
+    0x0015A408, 0x0015E10B, 0x0015A40E, 0x0015A139, 0x0015A400, 0x00166684, 0x0015B106, 0x0015A40E,
+    0x0015ABB4, 0x0015FF04, 0x0015FF28, 0x00197282, 0x0015A403, 0x0015A106, 0x0015A40B, 0x0015A40C,
+    0x00165B8D, 0x0015A411, 0x0015A092, 0x00159E33, 0x00159D80, 0x00166684, 0x0015C208, 0x00159DB3,
+    0x00197400, 0x00197584, 0x00197708, 0x0017848B, 0x00159D8C, 0x0019780E, 0x0015C20F, 0x00160312,
+    0x00183E93, 0x0016F794, 0x0017E835, 0x0015EE80, 0x0015ED81, 0x00197984, 0x0015BE05, 0x0015B10C,
+    0x0015D3AF, 0x00161F03, 0x0015D204, 0x00197C06, 0x0015AB0A, 0x0015A112, 0x00162F33, 0x0015AC80,
+    0x00159D08, 0x0015B50E, 0x0015E12F, 0x0015AC80, 0x0015A403, 0x00160204, 0x00162306, 0x0015EE88,
+    0x0015B68A, 0x0015B58E, 0x0015A434, 0x0015B504, 0x0015AC88, 0x001784B2, 0x0015FE00, 0x00197E04,
+    0x0016B608, 0x0015A838, 0x0015A101, 0x00197F82, 0x00159E06, 0x0015DC0B, 0x0019810D, 0x0015B111,
+    0x00160833, 0x00179784, 0x0015AC88, 0x0019820E, 0x0015E135, 0x00159E00, 0x0015BD24, 0x0015BD04,
+    0x00159D08, 0x0015A68D, 0x0015AC8E, 0x0015A0B2, 0x0015A401, 0x0015A403, 0x00166C85, 0x0015A406,
+    0x0015AC08, 0x0019830B, 0x0016618C, 0x00185C8D, 0x0016880F, 0x00198611, 0x0016B013, 0x00198914,
+    0x0015A436, 0x0015A080, 0x00198AAD, 0x00198C80, 0x0015AB0C, 0x0015AC14, 0x0015A136, 0x0015ABA8,
+    0x0015B103, 0x00168205, 0x0015A406, 0x0015BB0B, 0x0015A38D, 0x00198D0E, 0x00198E8F, 0x0015C111,
+    0x0015A413, 0x00199014, 0x00199236, 0x00199380, 0x00199804, 0x00199908, 0x00199A0E, 0x00199C34,
+    0x0015E801, 0x00199D03, 0x00181505, 0x0015A406, 0x00199E8B, 0x0015A40C, 0x0015A40F, 0x00184A91,
+    0x0015A692, 0x0016C793, 0x0015B2B9, 0x0015ACB8, 0x0015A40B, 0x0016340C, 0x0015A40D, 0x0015F311,
+    0x0015A692, 0x0015A413, 0x0015A6B9, 0x0015AB02, 0x0015A407, 0x0015A433, 0x0015BA80, 0x00166684,
+    0x00165306, 0x0015ABB4, 0x00161F03, 0x0015A40A, 0x00160E0B, 0x0015A40C, 0x0015B68F, 0x0015A431,
+    0x0015B500, 0x0017330D, 0x0016298E, 0x0015A3B4, 0x0015A405, 0x0015A40B, 0x0015A68D, 0x0015A411,
+    0x0017AF12, 0x0015B113, 0x0015C839, 0x0015A40E, 0x0015A433, 0x00159E00, 0x0015A404, 0x0015A405,
+    0x0016C78B, 0x0015A135, 0x00186804, 0x0015F328, 0x0015A400, 0x0015A403, 0x0015A404, 0x00159D86,
+    0x0015A10D, 0x0015B50E, 0x0015F412, 0x00173193, 0x0015B115, 0x0015A139, 0x0015E000, 0x0018A188,
+    0x0015B10E, 0x0015C233, 0x0019A080, 0x00163784, 0x0015A405, 0x0015A686, 0x0019A208, 0x0015A40A,
+    0x0019A38E, 0x0019A491, 0x0015D994, 0x0015C035, 0x0015B104, 0x0015A132, 0x00175B00, 0x0015AC8E,
+    0x0015A413, 0x00172EB4, 0x0017B324, 0x00161500, 0x00196F84, 0x0015ACA8, 0x00163784, 0x00162F33,
+    0x00166A82, 0x00165683, 0x0015A605, 0x0015A406, 0x0015A407, 0x0019A68A, 0x0019A88B, 0x00198E8C,
+    0x0016E18D, 0x0016080F, 0x0019AB11, 0x00159E12, 0x0015AC14, 0x0015A395, 0x0019AD96, 0x0015C238,
+    0x0019AF80, 0x0015A403, 0x0019B184, 0x00166A88, 0x0019B40B, 0x0017B40D, 0x0015AC0E, 0x0019B511,
+    0x0015A413, 0x0015A115, 0x0015EEB6, 0x00159D80, 0x0019B684, 0x0015A605, 0x0015FD0B, 0x0015A40C,
+    0x0016568D, 0x0015A40F, 0x0019B891, 0x0019BB12, 0x0015F313, 0x0015B514, 0x0016C7B5, 0x0015A184,
+    0x0015FF34, 0x0015BA04, 0x0015A6AE, 0x00196480, 0x00166A82, 0x00163784, 0x0015D386, 0x00173309,
+    0x0015A10B, 0x0015A38D, 0x0019BC8E, 0x0015F30F, 0x0019BF11, 0x00160413, 0x0015A614, 0x0015A395,
+    0x0019C116, 0x0015BE38, 0x0019C304, 0x0015A408, 0x0015AA8E, 0x0019C434, 0x0015BA08, 0x00199934,
+    0x00166A82, 0x0018AF0B, 0x0016220D, 0x0015A111, 0x00162592, 0x0015F333, 0x0015B504, 0x0015E12B,
+    0x0015A401, 0x0015AC38, 0x0015A404, 0x0015A087, 0x001647AA, 0x0015A400, 0x00163784, 0x0015B187,
+    0x0015A6AB, 0x0015A386, 0x00159D0B, 0x0015DC0D, 0x00159E13, 0x0015B514, 0x0015A3B5, 0x00162207,
+    0x0015AC08, 0x0015A10B, 0x0015E80C, 0x0015C22D, 0x0015A400, 0x001666A4, 0x0015A403, 0x0019C504,
+    0x00161F0A, 0x00161F0B, 0x0015A40E, 0x0015B693, 0x0015A135, 0x00166680, 0x0015A101, 0x0015A408,
+    0x0015A40F, 0x0015AC34, 0x0015A382, 0x0015A403, 0x0019C784, 0x00160806, 0x0015A407, 0x0015B68A,
+    0x0015A434, 0x0015B584, 0x0015B12F, 0x0019C904, 0x0015D488, 0x0015B98E, 0x0015A111, 0x0015A1B4,
+    0x0015AC00, 0x0015A404, 0x0015E112, 0x0015C233, 0x0015B500, 0x0015B584, 0x0015A687, 0x0015A10A,
+    0x0017DC34, 0x00166684, 0x0015AB0C, 0x0019CB33, 0x0015B500, 0x0016E324, 0x0015A406, 0x0015AC08,
+    0x00159D0B, 0x0015BA0D, 0x0015A091, 0x0019CC93, 0x0015A436, 0x00161500, 0x0015A403, 0x0019CE04,
+    0x00168F06, 0x0015AC88, 0x0019D10B, 0x0015F30D, 0x0015A40E, 0x0015A40F, 0x0015A411, 0x0015A413,
+    0x0015A436, 0x0015A403, 0x00174C84, 0x00168205, 0x0015C40B, 0x0019D30C, 0x0019D48D, 0x0015A40E,
+    0x0015A40F, 0x0019D611, 0x0015F313, 0x00165335, 0x0015AC00, 0x0015B103, 0x00166C85, 0x0015A406,
+    0x0015A40B, 0x0015AC0E, 0x0015A091, 0x00159E32, 0x0015AC80, 0x0015BA28, 0x0015A400, 0x0015A406,
+    0x0019D78B, 0x00166AAD, 0x00183A04, 0x0015A405, 0x0015F311, 0x0015A6B3, 0x0015A401, 0x00166A82,
+    0x0015A683, 0x0015A404, 0x0015A406, 0x0016CD88, 0x0015A68A, 0x0015A40C, 0x0019D88D, 0x0015A40F,
+    0x0015A091, 0x00162592, 0x00166B13, 0x0015A416, 0x0015A438, 0x0015A401, 0x0015A403, 0x0019DA84,
+    0x0015A60F, 0x0015A416, 0x0015A438, 0x0019DC82, 0x0015A383, 0x0015B504, 0x0015B10B, 0x0016568C,
+    0x0017E10D, 0x0016040F, 0x00159E12, 0x0015A413, 0x0015A6B5, 0x0015AC80, 0x0015A401, 0x0015A404,
+    0x0015A406, 0x00159D08, 0x00159D09, 0x0015AB0C, 0x0019DD8E, 0x00166B0F, 0x0015AB91, 0x00162592,
+    0x00180F13, 0x0015A695, 0x0015A416, 0x00159D38, 0x0015B401, 0x0015B584, 0x00166C85, 0x0015A406,
+    0x0015A088, 0x0016618C, 0x0017E10D, 0x0019DF11, 0x00169632, 0x0015B504, 0x0015E10B, 0x0015A6AF,
+    0x0015BA00, 0x00166A82, 0x0015BA08, 0x0019E08B, 0x00165111, 0x00162592, 0x0015A6B9, 0x0015A800,
+    0x0015DB04, 0x0015BA08, 0x0015A68A, 0x0017B00B, 0x0015BA11, 0x0015A436, 0x0015A38B, 0x0019E211,
+    0x0019E3B3, 0x00166A82, 0x0015A406, 0x0019E50A, 0x0015A08B, 0x0017EB0E, 0x0017C491, 0x0015A393,
+    0x0015A094, 0x0015A0B6, 0x0015A406, 0x0015A411, 0x00159E12, 0x0015A433, 0x0015A401, 0x00166A82,
+    0x0015BE05, 0x0015A406, 0x0015C408, 0x0015F10A, 0x0015A40F, 0x0019E691, 0x00159E12, 0x00159E13,
+    0x0015A436, 0x0019E980, 0x0015A401, 0x0015BA02, 0x0015A403, 0x0015D204, 0x0015AC2B, 0x0015A401,
+    0x0015BA02, 0x0015A383, 0x0015A404, 0x00172105, 0x0015A406, 0x00166B0F, 0x0015A091, 0x0015A433,
+    0x0015A401, 0x0015A403, 0x00172004, 0x0015A406, 0x0015A68A, 0x0019EB0E, 0x0019ED91, 0x0015A413,
+    0x0015A614, 0x0019EEB6, 0x0015A401, 0x00166A82, 0x00168205, 0x0015A406, 0x00159E32, 0x0015A40A,
+    0x00161F0F, 0x0015F311, 0x0015A6B5, 0x0015A400, 0x0015A824, 0x0015A400, 0x0015A404, 0x00162F0A,
+    0x0015A6AB, 0x0015A400, 0x0015B103, 0x0015B988, 0x0015ABAE, 0x00166680, 0x00173033, 0x0015B504,
+    0x0015E126, 0x0015A400, 0x0015A434, 0x00159E00, 0x0015EE84, 0x0015AC2E, 0x0019F000, 0x0019F203,
+    0x0019F404, 0x0015BB08, 0x0015EE8E, 0x00178F14, 0x0015A3B5, 0x0015EEA0, 0x0015A800, 0x0015A682,
+    0x0015A683, 0x0015A404, 0x0015A406, 0x00161D88, 0x0015B10B, 0x0016530D, 0x00165332, 0x0015B104,
+    0x0015B68A, 0x0015F30B, 0x0015A40C, 0x0015A40F, 0x0019F633, 0x0015B687, 0x0015B50E, 0x0015B10F,
+    0x0015A131, 0x00162980, 0x00162F01, 0x0017C783, 0x0019F804, 0x0015AB06, 0x0015A40D, 0x00185111,
+    0x0015C213, 0x0015A434, 0x0015A407, 0x0015AC2E, 0x0016F782, 0x00159E06, 0x0015A40A, 0x0015A40B,
+    0x0015A40C, 0x0015BB0D, 0x0015B68F, 0x0015A411, 0x0015A692, 0x00180F33, 0x0015B500, 0x0015A682,
+    0x00175A04, 0x00184A85, 0x0015F30B, 0x0015A40C, 0x0016020D, 0x0015A40F, 0x0015A692, 0x00159E33,
+    0x0015A400, 0x0015A68B, 0x0015B2B4, 0x00161A82, 0x0015C003, 0x00163784, 0x0015A406, 0x00159D87,
+    0x00160688, 0x0015A68A, 0x0019FB0B, 0x0015A40C, 0x0019FD0D, 0x0019FF11, 0x0015D992, 0x0015F313,
+    0x0015AC14, 0x001A0196, 0x0015B598, 0x001A0339, 0x001A0400, 0x001A0682, 0x001A0804, 0x00180A08,
+    0x0015A40A, 0x001A098B, 0x0016C08D, 0x0015A40E, 0x0015D991, 0x0015A413, 0x0015D594, 0x0015B6B6,
+    0x0015AC00, 0x00183502, 0x0015A683, 0x001A0B84, 0x00184A85, 0x0015F10A, 0x001A0D8B, 0x0015A40C,
+    0x001A0F0D, 0x00184611, 0x001A1193, 0x0015A435, 0x001A1300, 0x0015A608, 0x0015D5AE, 0x0015F303,
+    0x0015C408, 0x0015A38A, 0x001A140E, 0x001A1791, 0x00159E12, 0x0015A413, 0x0015A634, 0x001A1900,
+    0x001A1B04, 0x001A1C88, 0x0015E50E, 0x0017C4B4, 0x0015A403, 0x00163784, 0x0015A406, 0x0015A68B,
+    0x0016530C, 0x00166A8D, 0x001A1D91, 0x0015A133, 0x0015AC00, 0x0015A6B1, 0x001A1F00, 0x0015D584,
+    0x001A2128, 0x0015A401, 0x00166A82, 0x0015A683, 0x00168205, 0x00166B06, 0x001A2308, 0x0015A38A,
+    0x001A250B, 0x00172E8C, 0x001A268D, 0x0015D48F, 0x001A2891, 0x00162592, 0x00160813, 0x0015AC94,
+    0x0015A395, 0x0015A416, 0x0015A438, 0x001A2B80, 0x0017FE83, 0x001A2E84, 0x0017A408, 0x001A320B,
+    0x0015F30C, 0x001A338D, 0x0015DC0F, 0x001A3591, 0x0015A413, 0x0015B696, 0x0015A438, 0x00171702,
+    0x0015B584, 0x00168205, 0x001A368B, 0x0016340C, 0x001A388D, 0x0015B18F, 0x001A3A11, 0x00165335,
+    0x001A3C00, 0x0015A401, 0x00166A82, 0x0015A184, 0x0015B106, 0x00177C08, 0x0015A38A, 0x001A3E0B,
+    0x001A3F0C, 0x001A400D, 0x001A430E, 0x0016040F, 0x001A4591, 0x0015A412, 0x0015DC13, 0x001A4794,
+    0x0015A395, 0x001A49B6, 0x001A4B00, 0x001A4E84, 0x001A4F88, 0x001A518E, 0x00165134, 0x0015A401,
+    0x00166A82, 0x0015CD03, 0x00168205, 0x001A530B, 0x001A540C, 0x001A558D, 0x0015B18F, 0x0016F7B1,
+    0x0015B584, 0x001A578B, 0x0016530C, 0x0015A691, 0x0015A6B3, 0x0015A3B5, 0x0015D480, 0x0015B101,
+    0x0015B504, 0x0015A127, 0x00159D82, 0x0015B68A, 0x0015A6B1, 0x0015A403, 0x0015B50E, 0x0015B132,
+    0x0015A683, 0x0015A08D, 0x0015A411, 0x00163433, 0x0015BB80, 0x0015A407, 0x0015A42E, 0x0015A403,
+    0x001A1C8D, 0x00160833, 0x0015A407, 0x0015BA34, 0x00159D82, 0x0015ED85, 0x00161F0A, 0x0015E10B,
+    0x00159E0F, 0x0015A434, 0x00161D80, 0x0015A408, 0x0015A10C, 0x0015A40E, 0x0015D4AF, 0x0015A408,
+    0x0015A40A, 0x0016C18D, 0x0015A1B4, 0x0016E084, 0x0015A131, 0x001A5900, 0x0015A403, 0x0015D204,
+    0x0015B685, 0x00161A86, 0x0015E10B, 0x0015A131, 0x0015B584, 0x0015DF87, 0x0015A434, 0x0015B50E,
+    0x0015A111, 0x0015A133, 0x0015A401, 0x0015BA02, 0x0015A403, 0x0015F306, 0x00160588, 0x0016530B,
+    0x001A5B0C, 0x001A5C8D, 0x0015DC0F, 0x001A5E11, 0x00162592, 0x00180F13, 0x001629B8, 0x001A6080,
+    0x0015A683, 0x001A6204, 0x0015B508, 0x0019648B, 0x0015A60F, 0x00166C91, 0x0015A438, 0x0015A404,
+    0x0015A605, 0x0015A406, 0x0016E50B, 0x0015A40C, 0x0019260D, 0x0015A68F, 0x0016E511, 0x00180F12,
+    0x0015D493, 0x0015A695, 0x0015B2B9, 0x0015A401, 0x0017BE0B, 0x001A650E, 0x0015DC0F, 0x001A6611,
+    0x0015A413, 0x0015ACB4, 0x0015A681, 0x0015AC08, 0x001A67AE, 0x0015F304, 0x0015ACAE, 0x0015A408,
+    0x00159E0F, 0x0015A135, 0x0015D482, 0x0015A403, 0x0015B584, 0x0015BB0E, 0x00159E33, 0x0015B584,
+    0x0015A427, 0x00159E00, 0x0015AC84, 0x00172EB4, 0x0015A40B, 0x0015A133, 0x0015E101, 0x00166684,
+    0x0015B588, 0x0015C80B, 0x001A688E, 0x0015EEB4, 0x0015AC80, 0x0015DC04, 0x0015EC07, 0x0015A608,
+    0x00161F0A, 0x0015A40E, 0x0015A433, 0x0015E105, 0x0015A128, 0x0015B106, 0x0015A12C, 0x0015A400,
+    0x0015A431, 0x0015C206, 0x0015AB0A, 0x0015A40B, 0x0016220D, 0x0015A111, 0x00159E12, 0x0015A433,
+    0x0015A400, 0x0016EC04, 0x00159D87, 0x0015EE88, 0x0015B12A, 0x001A6980, 0x0015B682, 0x001A6B84,
+    0x0015B68A, 0x00161F0B, 0x0015A10C, 0x0015BA8E, 0x0015A10F, 0x0015DB34, 0x0015AC00, 0x0015D204,
+    0x0015EE88, 0x0015B10C, 0x0015A42F, 0x0015A400, 0x001A6D06, 0x0015A407, 0x0017300A, 0x0015A10D,
+    0x0015B112, 0x0015C6B3, 0x0015A400, 0x001A6F84, 0x0016E088, 0x0015A10F, 0x0015A434, 0x0015A400,
+    0x0018CE03, 0x0015B584, 0x0015B186, 0x0015A40D, 0x001A720E, 0x0015A40F, 0x00165311, 0x00159D92,
+    0x0015B6B3, 0x0015B500, 0x00163784, 0x0015A40A, 0x00174512, 0x0015F133, 0x0015B500, 0x00166684,
+    0x0015A407, 0x0015A688, 0x0015BE0E, 0x00161F13, 0x0015A434, 0x0015A681, 0x00159D0B, 0x0015A60D,
+    0x0015AC8E, 0x0015A68F, 0x0015A433, 0x0015D480, 0x0015B524, 0x0015D380, 0x0015BD04, 0x0015A688,
+    0x0015E10D, 0x0015A692, 0x0015A433, 0x00163784, 0x0015A408, 0x001A740E, 0x0015A434, 0x0015B1B9,
+    0x00162582, 0x0015F303, 0x00159D04, 0x0015A40A, 0x0015A40B, 0x0015A40C, 0x00161F11, 0x0015A392,
+    0x0015A413, 0x0015A6B9, 0x0015B687, 0x0015A133, 0x0015A40B, 0x0015A40C, 0x001A758D, 0x0015A411,
+    0x001625B3, 0x0015A406, 0x0015C234, 0x00159D08, 0x0015A40B, 0x0015B5AD, 0x0015A680, 0x0015AB02,
+    0x00192F04, 0x0016E808, 0x0015B68B, 0x0015D3AE, 0x0015B584, 0x001A778F, 0x0015A6B2, 0x00159E02,
+    0x00166983, 0x00162204, 0x0015A686, 0x0015A108, 0x0018DD0D, 0x0015BB8E, 0x0015A392, 0x00184F93,
+    0x0015A6B4, 0x00162980, 0x0015A384, 0x0015BB08, 0x0015B12E, 0x0015D380, 0x0015A682, 0x0015DB04,
+    0x0015F305, 0x0015A106, 0x0015A40C, 0x0015F30D, 0x001A7991, 0x0015A392, 0x0015A433, 0x0015A10B,
+    0x001A7AB3, 0x0015A404, 0x0015A407, 0x0015C4B1, 0x0015E004, 0x0015A0A8, 0x0015A400, 0x0015A404,
+    0x0015A433, 0x0015BA02, 0x00159D86, 0x0015AB88, 0x0015EB0B, 0x001A7C8D, 0x00178F11, 0x0015B6B6,
+    0x0015A681, 0x0015A102, 0x001A7F84, 0x0015A605, 0x0015AC86, 0x001A8108, 0x00166C8B, 0x0015C80C,
+    0x0015A40D, 0x0015AA8E, 0x001A8291, 0x0017E012, 0x00160313, 0x0015B6B6, 0x00166A82, 0x00168204,
+    0x00180F06, 0x0018D90B, 0x001A838D, 0x0015AC0E, 0x00192A31, 0x0015A085, 0x0015EB0B, 0x0015C90D,
+    0x001A8591, 0x0015A392, 0x0015A414, 0x0015AC36, 0x001A6780, 0x00199804, 0x001A8708, 0x001A880E,
+    0x0015D9B4, 0x0015A403, 0x0015A406, 0x0015A109, 0x0017770C, 0x0015BA0D, 0x0015AC11, 0x0015A138,
+    0x0017C92C, 0x0015A40D, 0x001714B1, 0x0015E828, 0x0015AC00, 0x0015A102, 0x0015B584, 0x0015B107,
+    0x0015B6AA, 0x0015C400, 0x0015B103, 0x0015B5A4, 0x0015A405, 0x0015A40E, 0x0015A433, 0x0016E084,
+    0x0015A607, 0x0015ACAE, 0x0015A400, 0x0015A404, 0x0015A408, 0x0015A12A, 0x0015BA00, 0x0015A383,
+    0x00163784, 0x0015B68B, 0x0015D4B3, 0x0015AB01, 0x0015D204, 0x0015BB08, 0x0015AC8E, 0x0015A42F,
+    0x0015A400, 0x0015A082, 0x0015A403, 0x00180304, 0x0015F306, 0x0015A40A, 0x0015B10D, 0x0015B6B3,
+    0x0015A408, 0x0015B10F, 0x0015E132, 0x0015B584, 0x0015A40B, 0x0015A40E, 0x0015A431, 0x0015BA80,
+    0x00159E02, 0x0015B504, 0x0015A387, 0x0015A408, 0x0015A38B, 0x0015A691, 0x0015B113, 0x0015A1B4,
+    0x0015AC88, 0x0015A42D, 0x0015B683, 0x0015A612, 0x0015A6B9, 0x0015B68A, 0x0015A42E, 0x0015E100,
+    0x001784A3, 0x0015B685, 0x0015A413, 0x0015A434, 0x0015F300, 0x0015B584, 0x0015A6B4, 0x0015F30B,
+    0x0015D58D, 0x0015A692, 0x0015A433, 0x0015B100, 0x0017A004, 0x0015A42E, 0x0017B500, 0x0015B584,
+    0x0015B68B, 0x0015A413, 0x0015A414, 0x0015AC38, 0x0015AC80, 0x0015A401, 0x0015A404, 0x0015A108,
+    0x0015B10C, 0x0015A42E, 0x0015C400, 0x00173303, 0x00179784, 0x00171486, 0x00161D88, 0x0015C20A,
+    0x0015A68D, 0x0015A434, 0x0015A40B, 0x0015A40C, 0x0015A40D, 0x00180F33, 0x001A8980, 0x001A8A04,
+    0x00173187, 0x0015F888, 0x0015D38E, 0x0015B12F, 0x001A8C80, 0x00180F02, 0x0015A404, 0x001A8E08,
+    0x0015DC0E, 0x0015A411, 0x001A8F12, 0x0016C793, 0x0015E8B4, 0x0015A400, 0x0015B584, 0x0015B107,
+    0x0015B132, 0x0015C400, 0x001A9104, 0x0015B133, 0x00162582, 0x00162586, 0x0015A40A, 0x0015A40D,
+    0x0015A411, 0x00165312, 0x0015A413, 0x00165339, 0x001A9304, 0x0015A688, 0x0015B68D, 0x00165312,
+    0x0015A413, 0x00165339, 0x001A94A8, 0x0015BD04, 0x0015EEAE, 0x0015A401, 0x001A9582, 0x00160803,
+    0x00159D86, 0x001A9708, 0x0016618C, 0x001A990D, 0x0016040F, 0x00180F12, 0x0015DC13, 0x0015A695,
+    0x0015C416, 0x00184AB8, 0x0016C080, 0x0015BA02, 0x0018F284, 0x0015A105, 0x00166C88, 0x0015A40A,
+    0x0015C20C, 0x0015BB0D, 0x0015DC12, 0x0015A413, 0x0015A416, 0x00184AB8, 0x001A9B00, 0x0015A381,
+    0x0019DC82, 0x0015A683, 0x0017F004, 0x00166C85, 0x00162F06, 0x0015A68A, 0x0015E00B, 0x0015A40C,
+    0x0015F30D, 0x0017CB8E, 0x00166B0F, 0x0015A092, 0x0015A3B3, 0x001A9C80, 0x0015BA02, 0x0015F303,
+    0x0015A406, 0x0015A408, 0x0015A68A, 0x0015C40B, 0x0015A18C, 0x001A9E0D, 0x001AA08E, 0x0015A38F,
+    0x0015D493, 0x0015A614, 0x0015A395, 0x0015A416, 0x0015A438, 0x0019DC82, 0x0015D204, 0x00162F06,
+    0x001AA18B, 0x00172E8C, 0x00166A8D, 0x0016F892, 0x001625B3, 0x0015B504, 0x0015A68A, 0x0015A10C,
+    0x0015A40F, 0x0015A632, 0x0015EB03, 0x0015A431, 0x0015EDA1, 0x0015A40D, 0x0015A091, 0x00159E33,
+    0x001AA280, 0x0015B101, 0x0015D224, 0x0015A400, 0x0015F305, 0x0015B6B3, 0x0015A68B, 0x0015A10D,
+    0x0015ABB2, 0x0015BE33, 0x0015A404, 0x00172E88, 0x0015A38B, 0x0015A10F, 0x00159DB2, 0x00159D08,
+    0x0015B10C, 0x0015A80E, 0x0015B6AF, 0x0015A400, 0x0015A403, 0x00163784, 0x0015A406, 0x00161D88,
+    0x0015B12D, 0x0015BA04, 0x0015BA08, 0x0015A6AB, 0x00163201, 0x0015A403, 0x0015B685, 0x0015A40A,
+    0x0015F30C, 0x0015DC0D, 0x0015A40F, 0x0015A431, 0x0015B107, 0x0015B6AA, 0x0015A684, 0x0015A80E,
+    0x0015FE13, 0x0015A434, 0x0015A404, 0x0015AC88, 0x0015A40B, 0x00172F0D, 0x0015A413, 0x0015A438,
+    0x00166A80, 0x001AA484, 0x00172031, 0x0015A382, 0x0015B504, 0x0015A406, 0x0017AC8B, 0x001AA78D,
+    0x001AA991, 0x0015A612, 0x0015F313, 0x0015A637, 0x0015A404, 0x0015A431, 0x0015C90D, 0x0015ACB8,
+    0x0015A683, 0x0015B5A4, 0x0015AC00, 0x00160E04, 0x0015B988, 0x0015A40E, 0x0015A40F, 0x0015AB33,
+    0x0015AC80, 0x0015B584, 0x0015A42E, 0x0015BE31, 0x0015A10C, 0x0015A42D, 0x00184120, 0x0015E831,
+    0x00159DAC, 0x00180A04, 0x0015A68B, 0x0015A40E, 0x00160331, 0x001AAB20, 0x0015D480, 0x00159D24,
+    0x00159D04, 0x0015A407, 0x0015A688, 0x0015B133, 0x0015A408, 0x0015A08F, 0x0015AE91, 0x0015A434,
+    0x001AAC80, 0x00159D04, 0x00159D08, 0x0015BCAE, 0x0015A180, 0x0015A404, 0x0015A108, 0x0015A38B,
+    0x0015B68E, 0x00162234, 0x0015AB80, 0x001AAE04, 0x0015BB08, 0x0015A40E, 0x0018E5B4, 0x0015BB04,
+    0x001959A8, 0x0015D580, 0x0015A084, 0x0017B40E, 0x0015ABB4, 0x0015A080, 0x0015A1A8, 0x0015A102,
+    0x0015E105, 0x0015BA8E, 0x001656B3, 0x0017B404, 0x00159D28, 0x001AAF00, 0x0017B404, 0x0017CAA8,
+    0x0015AC80, 0x00190604, 0x0015BCA8, 0x0015B100, 0x00195B84, 0x0015ACA8, 0x00159D04, 0x001AB028,
+    0x001AAF00, 0x001AB184, 0x00159D2E, 0x0015BC80, 0x001AB3A8, 0x00167384, 0x0015A088, 0x0015ACAE,
+    0x00172EA8, 0x0015AA8E, 0x0015A6B8, 0x0015A40E, 0x0015B131, 0x00159D2D, 0x0015B100, 0x00159D04,
+    0x0015A0A8, 0x0015AC80, 0x0015ACB4, 0x001AB524, 0x0015BA00, 0x0015B504, 0x0015A6A8, 0x00159D84,
+    0x00159D8B, 0x0015A40E, 0x0015EB11, 0x0015A692, 0x0015A6B3, 0x0015BA80, 0x0015BC84, 0x0015A128,
+    0x00162980, 0x0015AB03, 0x0015B988, 0x001664AD, 0x0015AC00, 0x0015A38D, 0x0015A6B3, 0x0015AC00,
+    0x00159D24, 0x0015A680, 0x00159D08, 0x0015ACAE, 0x0015A3A6, 0x0015C400, 0x001AB6B1, 0x0015AC00,
+    0x00160834, 0x0015A40B, 0x00163431, 0x0015A400, 0x0015AC28, 0x00162204, 0x0015FB08, 0x0015A80E,
+    0x0015A692, 0x0015A394, 0x0015A3B5, 0x0015B6AF, 0x0015A103, 0x0015B584, 0x0015A406, 0x0015A433,
+    0x00163784, 0x0015BB08, 0x0015A82E, 0x0015EE80, 0x0015B103, 0x00160F84, 0x001AB808, 0x0015A10D,
+    0x0015A414, 0x0015A6B5, 0x0015AC00, 0x0015A404, 0x0015B6B3, 0x0015B988, 0x0015A434, 0x00159E02,
+    0x0015A60B, 0x0015A60D, 0x0015F333, 0x0016342B, 0x0015A10D, 0x0015A40F, 0x0015B6B1, 0x0016B600,
+    0x0015A404, 0x0015A688, 0x0015A42E, 0x0015B68B, 0x0015B6AD, 0x0015B500, 0x0015DC03, 0x0015A404,
+    0x0015A40B, 0x0015ABB4, 0x00175B00, 0x00166983, 0x0015B104, 0x0015A686, 0x0015AC88, 0x0015D98E,
+    0x0015A413, 0x00160834, 0x0015A401, 0x0015A386, 0x00165E91, 0x001AB912, 0x00166993, 0x0015A3B5,
+    0x0015A10F, 0x0015C233, 0x00163784, 0x0015AC28, 0x0015A40B, 0x00159D2D, 0x001ABAA4, 0x0015A800,
+    0x0015B584, 0x0015B127, 0x00163224, 0x0015A411, 0x0015B6B6, 0x0015A103, 0x0015A425, 0x0015A400,
+    0x001ABC08, 0x0015A82E, 0x0015A683, 0x0015B504, 0x001ABD2B, 0x00162980, 0x0015A102, 0x001ABE84,
+    0x0015B988, 0x0015A40E, 0x0015A413, 0x0015C438, 0x001AC0AB, 0x0015C400, 0x001AC204, 0x0015B186,
+    0x00159D08, 0x0015A40B, 0x0015BE13, 0x0015E8B4, 0x0015A400, 0x0015B584, 0x0015C588, 0x0015A68D,
+    0x0015BB8E, 0x001971B3, 0x001AC380, 0x0015BC84, 0x0015AB11, 0x0015A133, 0x0015DC00, 0x0015A103,
+    0x00166684, 0x0015BB28, 0x0015BAA4, 0x0015B508, 0x0015B52E, 0x001AC500, 0x0015A424, 0x0015B103,
+    0x0015E80A, 0x0015BE0E, 0x0015ACB4, 0x0015A688, 0x0015A3B4, 0x0015A382, 0x0015A403, 0x0016030B,
+    0x0015A42F, 0x0015B880, 0x00188384, 0x0015A40A, 0x001AC613, 0x0015B1B5, 0x0015B504, 0x0015A628,
+    0x00162582, 0x0015A686, 0x0015BE2B, 0x00179EA4, 0x00159D27, 0x0015AB8E, 0x00186B14, 0x0015A436,
+    0x0015B686, 0x0015B6A7, 0x0015AB06, 0x0015A40D, 0x0015A135, 0x0015B133, 0x0017D2AA, 0x0015B683,
+    0x00163784, 0x0015A686, 0x0015A408, 0x0015A433, 0x0015A804, 0x0015A405, 0x0015A433, 0x0015D204,
+    0x0015A106, 0x0015BA8E, 0x0015BE38, 0x0015AB2E, 0x0015A683, 0x0015DC05, 0x0015A40B, 0x0015A40D,
+    0x0015A411, 0x0015A612, 0x0015F313, 0x0015A3B5, 0x0015A400, 0x00163C04, 0x0015A425, 0x00162F03,
+    0x00163784, 0x0015F308, 0x0015A40A, 0x0017300B, 0x001AC833, 0x0015A403, 0x00160E04, 0x0015A406,
+    0x0015B68A, 0x0016530B, 0x0015A10D, 0x0015B693, 0x0015A6B9, 0x0015B681, 0x0015A403, 0x001AC904,
+    0x0015A40A, 0x0015A40C, 0x0015A40D, 0x0015A40F, 0x0015A691, 0x0015A092, 0x00161F33, 0x0015A404,
+    0x0015B107, 0x0015A40C, 0x0015B68F, 0x00160833, 0x0015A180, 0x00162582, 0x0015A804, 0x0015A433,
+    0x00166C85, 0x00159E06, 0x0015A40A, 0x0015DB0B, 0x0015A431, 0x00174CA4, 0x0015A400, 0x0015A404,
+    0x0015A42B, 0x0015B508, 0x0015AB2E, 0x0015B58B, 0x0015FF0C, 0x0015A40D, 0x00161F11, 0x0015A3B5,
+    0x0015B101, 0x0015B524, 0x0015AC04, 0x00161AA6, 0x00161F03, 0x0015F30A, 0x0015A40B, 0x0015A40C,
+    0x0015B68D, 0x0015B68F, 0x0015A092, 0x0015F333, 0x0015F333, 0x0015A403, 0x00162586, 0x0015A40B,
+    0x0015FB11, 0x0015A692, 0x0015A6B9, 0x00162582, 0x0015A403, 0x0016040A, 0x0015B68B, 0x00162592,
+    0x0015A433, 0x0015A403, 0x0015A686, 0x0015B10D, 0x0015A433, 0x0015A40E, 0x00159E32, 0x0015A400,
+    0x0015B12B, 0x00166A82, 0x0015A38B, 0x00162F0C, 0x0015D58D, 0x0015A40F, 0x00182D11, 0x0015C213,
+    0x00161CB4, 0x0019D600, 0x001ACA84, 0x0015A085, 0x001ACC0B, 0x0015A40D, 0x0015A391, 0x0015A413,
+    0x0015A416, 0x0015A438, 0x00162582, 0x0015A403, 0x00172105, 0x0015A406, 0x00190A8B, 0x0015A40C,
+    0x0016568D, 0x0015A40E, 0x0015DC0F, 0x00193091, 0x001ACD92, 0x00166B13, 0x0015B2B9, 0x0015A38B,
+    0x0015A18C, 0x001ACF8E, 0x0015A40F, 0x0017AC91, 0x0015C012, 0x0015A436, 0x0015A18C, 0x0015A42F,
+    0x0015A102, 0x0015B6AA, 0x0015B103, 0x0016EC04, 0x0016CC0E, 0x001625B3, 0x0015FB2B, 0x00160E04,
+    0x0015A688, 0x0015B133, 0x0015AC80, 0x00165E86, 0x0015A627, 0x0015AB02, 0x0015A403, 0x0015B584,
+    0x0015A106, 0x0015A408, 0x0015A109, 0x00161F0B, 0x0015A433, 0x00161F2F, 0x0018F582, 0x00161F03,
+    0x00160E04, 0x00163406, 0x0015A40A, 0x0015C20D, 0x0015A40E, 0x0015A6B9, 0x00163784, 0x0015A131,
+    0x0015D204, 0x00166487, 0x00161F0F, 0x0015A433, 0x0015AC80, 0x00162582, 0x0015B584, 0x00163407,
+    0x0015E133, 0x0015A403, 0x00159D2B, 0x0015AC34, 0x0018E204, 0x0015A12A, 0x0015A403, 0x0015A405,
+    0x0015B10B, 0x0015A6B5, 0x0015BA80, 0x0015B681, 0x0015BA84, 0x0015ACB8, 0x0015C486, 0x0015B68A,
+    0x0015A433, 0x00161F03, 0x00175A04, 0x0015B685, 0x0015A48B, 0x0015A40D, 0x0015B68F, 0x00162712,
+    0x0015B293, 0x0015E139, 0x00161F03, 0x0015A40A, 0x0015BB0B, 0x0015B68C, 0x0015E111, 0x0019ED92,
+    0x00180F33, 0x0015BB0B, 0x0015BB2D, 0x00160224, 0x00166A82, 0x0015D58D, 0x0015DC0F, 0x0015A092,
+    0x00169613, 0x0015AC36, 0x00166A80, 0x00166A82, 0x0015A40D, 0x0015A632, 0x0015BA02, 0x00163784,
+    0x0015C90D, 0x0015A612, 0x00160833, 0x0015A68A, 0x0015C90D, 0x0015A08E, 0x00160933, 0x0015B103,
+    0x0015A434, 0x0015A404, 0x0015BE07, 0x0015B132, 0x0015A403, 0x0015A42D, 0x0015B9A4, 0x0016E808,
+    0x0015ACAE, 0x0015B988, 0x0015BC8E, 0x0015A434, 0x0015AC80, 0x0015AB84, 0x0015B988, 0x0015AC0E,
+    0x0015AC38, 0x0015D3B3, 0x0015A400, 0x00165EA1, 0x0015A102, 0x0015A607, 0x0015C22A, 0x00166684,
+    0x0015A428, 0x0015A10A, 0x0015AAAE, 0x0015AC84, 0x0015B10F, 0x0015ACB4, 0x0015A406, 0x0015A42A,
+    0x001AD10E, 0x0015B6AF, 0x0015BA00, 0x0015AB02, 0x0015A403, 0x0015B504, 0x0015A105, 0x0015A40A,
+    0x0015A40D, 0x0015A411, 0x0015EDB3, 0x0015A403, 0x00159D0B, 0x0015A42F, 0x00189584, 0x0015A40B,
+    0x0015B68D, 0x0015A42F, 0x0015A403, 0x0015A407, 0x0015AB8B, 0x0015A40D, 0x00191A11, 0x0015A632,
+    0x00159E02, 0x0015B6A7, 0x0015A403, 0x00159E32, 0x0015A40A, 0x0015A40B, 0x0015A40C, 0x0015A40F,
+    0x0015A433, 0x0015B1B3, 0x0015A101, 0x0015A403, 0x0015A42A, 0x0015A404, 0x0015A40A, 0x0015B6B3,
+    0x0015A408, 0x0015A433, 0x0015BB2B, 0x0015A6A2, 0x0015A404, 0x0015B12F, 0x0015A403, 0x0015A40A,
+    0x0015A411, 0x00159E33, 0x0015A6AA, 0x0015A0AB, 0x001665A1, 0x0015AC04, 0x0015A407, 0x0015A6AB,
+    0x0015A400, 0x0015A684, 0x0015A407, 0x001AD228, 0x0015BA22, 0x0016E304, 0x0015AC34, 0x0015AB88,
+    0x0015A42F, 0x00160F88, 0x0015A42A, 0x0015A405, 0x0015A42F, 0x0015A404, 0x0015A40A, 0x0015A42F,
+    0x0015A40A, 0x0015C90D, 0x0016D891, 0x0015A692, 0x001625B3, 0x0015B584, 0x0015A688, 0x0015A40B,
+    0x0015A139, 0x0015A0AF, 0x00159D35, 0x00159E24, 0x0015A400, 0x00175602, 0x001647AA, 0x0015B584,
+    0x0015B10A, 0x0015A42E, 0x0015AC80, 0x0015A424, 0x0016658C, 0x0015A42F, 0x0015AC8E, 0x0015B12F,
+    0x0015C233, 0x00165E83, 0x0015A6B1, 0x0015AC80, 0x0015AB01, 0x0015A128, 0x0015A109, 0x0015A693,
+    0x0015B1B9, 0x0015A405, 0x0015A428, 0x0015B984, 0x0015E811, 0x0015B434, 0x0015A103, 0x0015A40A,
+    0x0015A42E, 0x0015A400, 0x00159E02, 0x0015C22B, 0x00164782, 0x0015B404, 0x0015B686, 0x0016532A,
+    0x001665AF, 0x0015AC04, 0x0015A0A8, 0x00165333, 0x0015AB22, 0x00173B20, 0x0015C9B2, 0x0016E500,
+    0x0015A103, 0x00163784, 0x0015A42A, 0x00165E84, 0x00159D08, 0x0015A40A, 0x0015A40C, 0x0015A40D,
+    0x0015B133, 0x0015EDAF, 0x00162988, 0x0015AB31, 0x0015A684, 0x0015A6A8, 0x0015EE80, 0x0015A12F,
+    0x0015AC00, 0x0015ACAE, 0x00000023, 0x00000028, 0x00000027, 0x00000000, 0x00000008, 0x0000004A,
+    0x00000032, 0x00000033, 0x00000020, 0x0000002F, 0x00000044, 0x00000007, 0x0000002A, 0x00000064,
+    0x00000032, 0x00000003, 0x00000012, 0x00000078, 0x00000073, 0x00000024, 0x0000000C, 0x00000031,
+    0x00000071, 0x00000043, 0x00000011, 0x00000012, 0x00000033, 0x00000036, 0x0000002E, 0x0000002C,
+    0x0000002B, 0x0000002D, 0x00000003, 0x00000004, 0x00000073, 0x0000000C, 0x00000038, 0x0000000C,
+    0x0000000D, 0x00000032, 0x00000038, 0x00000000, 0x00000024, 0x00000039, 0x0000000C, 0x00000072,
+    0x00000001, 0x00000032, 0x00000031, 0x00000003, 0x00000032, 0x00000012, 0x00000038, 0x00000006,
+    0x00000028, 0x00000004, 0x00000031, 0x00000022, 0x0000002A, 0x0000006D, 0x00000063, 0x0000000D,
+    0x00000071, 0x00000037, 0x00000003, 0x00000031, 0x00000034, 0x0000004D, 0x00000053, 0x00000037,
+    0x00000044, 0x0000002E, 0x00000044, 0x0000006D, 0x00000000, 0x00000032, 0x00000077, 0x00000029,
+    0x0000006B, 0x00000000, 0x00000028, 0x00000004, 0x00000073, 0x00000008, 0x0000000E, 0x00000038,
+    0x00000000, 0x00000064, 0x00000066, 0x0000000C, 0x00000033, 0x00000004, 0x00000013, 0x00000038,
+    0x0000000E, 0x00000076, 0x00000004, 0x00000012, 0x00000078, 0x00000000, 0x0000002D, 0x00000043,
+    0x0000002F, 0x00000003, 0x00000006, 0x00000033, 0x00000003, 0x00000051, 0x00000032, 0x00000008,
+    0x00000032, 0x00000007, 0x00000032, 0x00000026, 0x00000003, 0x00000004, 0x00000006, 0x00000012,
+    0x00000033, 0x0000004C, 0x00000038, 0x0000006C, 0x00000000, 0x00000031, 0x0000000A, 0x00000032,
+    0x00000012, 0x00000033, 0x00000044, 0x0000000B, 0x00000032, 0x00000003, 0x0000002D, 0x00000068,
+    0x00000003, 0x0000002B, 0x00000078, 0x00000004, 0x0000000B, 0x00000078, 0x00000003, 0x00000053,
+    0x00000056, 0x00000078, 0x00000003, 0x00000026, 0x00000044, 0x00000066, 0x00000045, 0x00000032,
+    0x00000060, 0x00000072, 0x00000043, 0x00000004, 0x00000012, 0x00000033, 0x00000004, 0x00000028,
+    0x00000004, 0x0000000E, 0x00000032, 0x00000000, 0x0000002E, 0x0000000D, 0x00000032, 0x00000000,
+    0x00000002, 0x0000002E, 0x00000044, 0x00000078, 0x0000004B, 0x00000071, 0x00000004, 0x00000032,
+    0x00000000, 0x00000044, 0x00000028, 0x0000000B, 0x00000012, 0x00000033, 0x00000004, 0x00000011,
+    0x00000032, 0x00000042, 0x00000032, 0x00000012, 0x00000013, 0x00000038, 0x00000043, 0x00000032,
+    0x00000007, 0x0000002C, 0x0000000B, 0x00000038, 0x00000008, 0x00000038, 0x00000021, 0x00000003,
+    0x00000004, 0x0000000B, 0x00000011, 0x00000032, 0x00000003, 0x00000024, 0x00000040, 0x00000024,
+    0x00000004, 0x00000012, 0x00000033, 0x0000000B, 0x0000002D, 0x0000000B, 0x0000000D, 0x00000033,
+    0x00000044, 0x00000032, 0x00000044, 0x00000027, 0x00000003, 0x00000011, 0x00000033, 0x00000007,
+    0x00000012, 0x00000078, 0x00000056, 0x00000039, 0x00000003, 0x00000012, 0x00000038, 0x00000002,
+    0x00000032, 0x0000000D, 0x00000073, 0x00000003, 0x0000004D, 0x00000012, 0x00000033, 0x00000003,
+    0x00000011, 0x00000076, 0x0000000D, 0x00000031, 0x00000002, 0x00000004, 0x00000032, 0x00000008,
+    0x0000000C, 0x00000078, 0x00000012, 0x00000053, 0x00000039, 0x00000044, 0x00000038, 0x00000000,
+    0x0000002F, 0x0000000F, 0x00000031, 0x00000062, 0x0000004E, 0x00000073, 0x00000012, 0x00000078,
+    0x00000004, 0x0000000B, 0x00000011, 0x00000032, 0x00000012, 0x00000073, 0x00000004, 0x0000002E,
+    0x00000043, 0x00000044, 0x0000002D, 0x00000067, 0x0000004C, 0x0000006D, 0x00000004, 0x00000027,
+    0x00000044, 0x0000000D, 0x00000038, 0x0000000B, 0x00000032, 0x00000000, 0x0000000E, 0x00000038,
+    0x00000003, 0x0000000D, 0x00000051, 0x00000032, 0x0000000A, 0x0000006B, 0x0000000E, 0x00000032,
+    0x00000000, 0x00000007, 0x00000012, 0x00000038, 0x0000006E, 0x00000012, 0x00000014, 0x00000038,
+    0x00000004, 0x00000012, 0x00000038, 0x00000004, 0x0000000E, 0x00000012, 0x00000038, 0x00000003,
+    0x00000011, 0x00000032, 0x00000000, 0x00000004, 0x0000000E, 0x00000038, 0x0000004B, 0x0000002D,
+    0x00000003, 0x0000000D, 0x00000011, 0x00000032, 0x00000042, 0x00000009, 0x0000004B, 0x0000004D,
+    0x00000072, 0x00000004, 0x00000008, 0x0000000E, 0x00000038, 0x00000000, 0x00000044, 0x00000008,
+    0x0000000E, 0x00000032, 0x00000000, 0x00000012, 0x00000014, 0x00000078, 0x00000074, 0x0000000E,
+    0x00000012, 0x00000038, 0x00000043, 0x00000004, 0x00000032, 0x00000007, 0x00000012, 0x00000038,
+    0x00000012, 0x00000013, 0x00000037, 0x0000000B, 0x00000012, 0x00000036, 0x00000003, 0x0000004D,
+    0x00000011, 0x00000073, 0x0000000C, 0x00000073, 0x0000000C, 0x0000006D, 0x00000004, 0x00000038,
+    0x00000046, 0x00000032, 0x00000007, 0x00000011, 0x00000038, 0x00000044, 0x00000012, 0x00000078,
+    0x0000000D, 0x00000076, 0x00000004, 0x00000008, 0x00000038, 0x00000013, 0x00000036, 0x00000004,
+    0x00000012, 0x00000073, 0x00000003, 0x0000004B, 0x00000032, 0x00000000, 0x00000038, 0x0000004B,
+    0x00000031, 0x0000004B, 0x00000032, 0x0000004F, 0x00000032, 0x00000003, 0x00000011, 0x00000012,
+    0x00000033, 0x00000000, 0x00000033, 0x0000000E, 0x00000038, 0x00000011, 0x00000032, 0x00000044,
+    0x0000004E, 0x00000012, 0x00000038, 0x00000012, 0x00000034, 0x0000006A, 0x00000044, 0x00000012,
+    0x00000038, 0x00000025, 0x00000043, 0x0000006A, 0x00000044, 0x00000033, 0x00000004, 0x00000007,
+    0x00000073, 0x0000004A, 0x00000011, 0x00000073, 0x00000043, 0x0000004F, 0x00000032, 0x00000043,
+    0x00000033, 0x00000052, 0x00000033, 0x0000004F, 0x00000038, 0x00000043, 0x00000006, 0x00000008,
+    0x0000004A, 0x00000012, 0x00000038, 0x00000004, 0x00000012, 0x00000079, 0x0000004A, 0x00000032,
+    0x00000043, 0x0000000A, 0x0000004C, 0x0000002F, 0x0000004D, 0x00000012, 0x00000038, 0x00000003,
+    0x00000051, 0x00000012, 0x00000013, 0x00000038, 0x00000065, 0x0000000A, 0x00000073, 0x00000041,
+    0x00000012, 0x00000073, 0x00000043, 0x00000012, 0x00000033, 0x00000002, 0x0000000A, 0x00000032,
+    0x00000000, 0x00000004, 0x00000028, 0x00000006, 0x0000002A, 0x00000003, 0x00000007, 0x00000032,
+    0x00000003, 0x00000011, 0x00000012, 0x00000078, 0x0000004E, 0x00000032, 0x00000006, 0x00000032,
+    0x00000047, 0x00000012, 0x00000078, 0x0000000A, 0x0000000B, 0x00000012, 0x00000077, 0x00000012,
+    0x00000018, 0x00000039, 0x0000004C, 0x0000002D, 0x00000004, 0x00000067, 0x00000003, 0x00000006,
+    0x0000002D, 0x00000003, 0x0000004B, 0x00000011, 0x00000012, 0x00000033, 0x00000011, 0x00000034,
+    0x00000044, 0x00000007, 0x0000000A, 0x00000033, 0x00000043, 0x0000000B, 0x0000006D, 0x00000043,
+    0x00000004, 0x0000000A, 0x00000012, 0x00000033, 0x00000047, 0x00000052, 0x00000033, 0x00000000,
+    0x00000044, 0x00000008, 0x0000006E, 0x0000004B, 0x0000004D, 0x00000032, 0x00000043, 0x0000004A,
+    0x0000002C, 0x00000043, 0x0000000C, 0x00000011, 0x00000032, 0x00000045, 0x00000011, 0x00000032,
+    0x00000044, 0x00000046, 0x0000004A, 0x00000012, 0x00000078, 0x00000004, 0x0000004A, 0x00000032,
+    0x00000007, 0x00000012, 0x00000033, 0x00000007, 0x0000002A, 0x00000002, 0x00000023, 0x00000043,
+    0x0000004A, 0x0000000B, 0x0000004C, 0x00000032, 0x0000004D, 0x00000032, 0x0000000D, 0x00000033,
+    0x00000006, 0x00000073, 0x00000047, 0x0000000A, 0x00000033, 0x00000000, 0x00000004, 0x00000038,
+    0x0000000E, 0x00000012, 0x00000034, 0x00000000, 0x00000004, 0x00000008, 0x0000000E, 0x00000012,
+    0x00000038, 0x00000043, 0x00000073, 0x00000000, 0x00000012, 0x00000078, 0x00000004, 0x00000047,
+    0x0000002E, 0x00000004, 0x00000007, 0x00000012, 0x00000013, 0x00000014, 0x00000038, 0x00000000,
+    0x00000004, 0x00000032, 0x00000000, 0x00000004, 0x00000073, 0x00000008, 0x00000012, 0x00000038,
+    0x00000076, 0x00000001, 0x00000022, 0x00000003, 0x0000006D, 0x00000003, 0x00000005, 0x00000037,
+    0x0000004B, 0x0000004E, 0x00000032, 0x00000008, 0x0000000E, 0x00000012, 0x00000038, 0x00000003,
+    0x00000007, 0x00000011, 0x00000032, 0x0000000E, 0x00000033, 0x00000003, 0x00000051, 0x00000012,
+    0x00000037, 0x0000000D, 0x00000012, 0x00000033, 0x0000000B, 0x00000073, 0x0000000F, 0x00000073,
+    0x00000003, 0x00000011, 0x00000012, 0x00000013, 0x00000037, 0x00000001, 0x0000004B, 0x0000000C,
+    0x0000002D, 0x00000051, 0x00000032, 0x00000003, 0x0000004A, 0x00000032, 0x00000003, 0x0000000B,
+    0x00000011, 0x00000032, 0x00000004, 0x0000006B, 0x00000000, 0x00000008, 0x0000004E, 0x00000032,
+    0x00000000, 0x00000022, 0x00000004, 0x0000000A, 0x0000002E, 0x00000044, 0x00000045, 0x00000033,
+    0x0000004D, 0x00000051, 0x00000032, 0x00000000, 0x00000006, 0x0000000A, 0x00000073, 0x00000000,
+    0x00000043, 0x00000004, 0x0000000A, 0x0000004C, 0x00000011, 0x00000012, 0x00000053, 0x00000038,
+    0x00000044, 0x0000006C, 0x0000004F, 0x00000073, 0x0000004A, 0x0000000F, 0x00000071, 0x00000004,
+    0x00000033, 0x00000052, 0x00000073, 0x00000000, 0x00000007, 0x0000004A, 0x0000000E, 0x00000032,
+    0x00000045, 0x0000002B, 0x00000043, 0x00000004, 0x00000048, 0x0000006B, 0x00000001, 0x00000044,
+    0x0000000E, 0x0000002F, 0x00000040, 0x00000004, 0x00000006, 0x0000000E, 0x00000032, 0x0000000A,
+    0x0000000B, 0x0000000C, 0x0000000E, 0x0000004F, 0x00000011, 0x00000013, 0x00000034, 0x0000004A,
+    0x0000000E, 0x00000032, 0x0000000B, 0x00000071, 0x00000044, 0x0000000E, 0x00000038, 0x00000000,
+    0x00000008, 0x0000002E, 0x00000005, 0x0000000A, 0x0000000C, 0x0000002D, 0x00000043, 0x00000064,
+    0x00000013, 0x00000037, 0x00000000, 0x00000025, 0x0000000B, 0x0000004D, 0x00000031, 0x00000047,
+    0x00000033, 0x00000040, 0x00000032, 0x00000042, 0x00000004, 0x0000006B, 0x00000007, 0x0000006A,
+    0x00000004, 0x0000004F, 0x00000032, 0x00000046, 0x0000004A, 0x00000032, 0x0000000E, 0x00000013,
+    0x00000038, 0x00000047, 0x0000004F, 0x00000052, 0x00000033, 0x0000004D, 0x00000051, 0x00000073,
+    0x0000000A, 0x0000002F, 0x00000045, 0x00000033, 0x00000041, 0x00000024, 0x00000004, 0x00000046,
+    0x0000004A, 0x00000033, 0x0000004A, 0x0000002C, 0x00000001, 0x0000002F, 0x00000044, 0x0000000A,
+    0x00000032, 0x0000000F, 0x00000033, 0x00000004, 0x00000047, 0x00000032, 0x00000043, 0x00000011,
+    0x00000012, 0x00000073, 0x00000043, 0x00000012, 0x00000038, 0x0000006F, 0x00000046, 0x0000002A,
+    0x00000000, 0x00000012, 0x00000038, 0x00000004, 0x00000008, 0x00000032, 0x00000008, 0x0000002E,
+    0x00000002, 0x00000003, 0x0000000D, 0x00000011, 0x00000012, 0x00000037, 0x00000004, 0x00000006,
+    0x00000032, 0x00000002, 0x0000002D, 0x00000006, 0x0000004D, 0x00000071, 0x00000004, 0x0000000B,
+    0x00000032, 0x00000004, 0x00000008, 0x0000000E, 0x00000012, 0x00000038, 0x00000011, 0x00000012,
+    0x00000073, 0x00000042, 0x00000037, 0x00000040, 0x0000000E, 0x00000012, 0x00000038, 0x0000000E,
+    0x00000012, 0x00000033, 0x00000000, 0x00000004, 0x0000002E, 0x00000000, 0x00000042, 0x0000002D,
+    0x00000003, 0x00000004, 0x00000011, 0x00000038, 0x00000001, 0x00000012, 0x00000038, 0x0000004B,
+    0x0000002C, 0x00000003, 0x00000051, 0x00000012, 0x00000038, 0x00000008, 0x0000000E, 0x00000012,
+    0x00000014, 0x00000078, 0x00000002, 0x00000003, 0x00000012, 0x00000013, 0x00000038, 0x00000001,
+    0x00000003, 0x00000004, 0x00000012, 0x00000073, 0x00000000, 0x00000027, 0x00000003, 0x0000004D,
+    0x00000051, 0x00000012, 0x00000053, 0x00000078, 0x00000003, 0x00000071, 0x00000004, 0x0000002B,
+    0x00000003, 0x0000000D, 0x00000012, 0x00000038, 0x00000002, 0x00000026, 0x00000044, 0x0000004A,
+    0x00000032, 0x00000047, 0x00000072, 0x0000004A, 0x0000006C, 0x00000043, 0x0000004A, 0x0000000B,
+    0x0000004F, 0x00000032, 0x00000044, 0x00000012, 0x00000053, 0x00000038, 0x00000043, 0x00000051,
+    0x00000032, 0x00000044, 0x0000004F, 0x00000032, 0x00000004, 0x0000006F, 0x00000008, 0x0000004A,
+    0x00000032, 0x00000001, 0x00000024, 0x00000044, 0x0000000A, 0x00000012, 0x00000078, 0x0000004A,
+    0x0000000B, 0x0000002D, 0x0000004F, 0x00000033, 0x00000043, 0x0000004D, 0x00000032, 0x00000044,
+    0x0000000E, 0x00000012, 0x00000038, 0x0000004B, 0x00000012, 0x00000033, 0x00000041, 0x0000006F,
+    0x00000004, 0x00000047, 0x00000053, 0x00000038, 0x00000001, 0x00000003, 0x00000011, 0x00000032,
+    0x00000042, 0x00000033, 0x00000000, 0x00000004, 0x0000006E, 0x00000008, 0x00000012, 0x00000078,
+    0x00000044, 0x00000008, 0x00000033, 0x00000011, 0x00000012, 0x00000038, 0x00000044, 0x0000000D,
+    0x00000032, 0x00000004, 0x00000078, 0x00000004, 0x0000000D, 0x00000012, 0x00000038, 0x00000006,
+    0x00000071, 0x00000003, 0x00000046, 0x00000011, 0x00000012, 0x00000073, 0x00000003, 0x00000005,
+    0x0000004B, 0x0000000D, 0x00000078, 0x00000051, 0x00000012, 0x00000078, 0x0000000C, 0x00000032,
+    0x00000002, 0x00000033, 0x00000001, 0x00000008, 0x0000004D, 0x00000032, 0x00000011, 0x00000038,
+    0x0000004C, 0x00000032, 0x00000013, 0x00000038, 0x0000000D, 0x00000011, 0x00000037, 0x00000003,
+    0x00000011, 0x00000012, 0x00000038, 0x00000004, 0x0000004E, 0x00000012, 0x00000078, 0x00000008,
+    0x0000004E, 0x00000032, 0x0000004E, 0x00000012, 0x00000078, 0x00000003, 0x0000004B, 0x00000031,
+    0x00000003, 0x0000004D, 0x00000011, 0x00000032, 0x0000000A, 0x0000002E, 0x00000005, 0x00000073,
+    0x0000000B, 0x0000006D, 0x0000004A, 0x00000033, 0x00000043, 0x0000004C, 0x00000031, 0x0000004B,
+    0x00000038, 0x00000003, 0x0000000B, 0x00000073, 0x00000001, 0x00000006, 0x0000000A, 0x0000004B,
+    0x0000006F, 0x0000000B, 0x00000033, 0x00000002, 0x00000012, 0x00000038, 0x00000004, 0x0000002C,
+    0x0000004B, 0x00000073, 0x00000003, 0x0000004B, 0x00000011, 0x00000032, 0x0000004D, 0x00000071,
+    0x00000003, 0x00000033, 0x0000000D, 0x00000011, 0x00000032, 0x00000043, 0x00000071, 0x00000006,
+    0x00000016, 0x00000037, 0x00000006, 0x00000038, 0x00000011, 0x00000013, 0x00000036, 0x00000003,
+    0x00000011, 0x00000036, 0x00000040, 0x00000078, 0x00000004, 0x0000002D, 0x00000008, 0x00000078,
+    0x00000003, 0x0000006F, 0x00000000, 0x0000000A, 0x00000032, 0x00000002, 0x0000002F, 0x00000013,
+    0x00000078, 0x00000004, 0x00000026, 0x00000003, 0x00000011, 0x00000012, 0x00000073, 0x00000000,
+    0x0000000E, 0x00000032, 0x00000044, 0x00000008, 0x00000038, 0x00000003, 0x00000073, 0x0000000B,
+    0x00000011, 0x00000032, 0x00000040, 0x00000012, 0x00000038, 0x00000004, 0x00000034, 0x00000047,
+    0x00000078, 0x00000003, 0x00000051, 0x00000012, 0x00000073, 0x00000004, 0x0000000E, 0x00000012,
+    0x00000078, 0x00000000, 0x00000067, 0x00000044, 0x0000000C, 0x00000012, 0x00000038, 0x00000047,
+    0x0000006A, 0x0000000D, 0x00000012, 0x00000038, 0x0000000A, 0x00000011, 0x00000012, 0x00000073,
+    0x0000000F, 0x00000032, 0x00000046, 0x00000073, 0x00000007, 0x00000072, 0x00000051, 0x00000073,
+    0x00000044, 0x0000002F, 0x00000046, 0x0000006A, 0x00000000, 0x00000002, 0x00000004, 0x0000006E,
+    0x00000000, 0x00000012, 0x00000034, 0x0000000C, 0x00000078, 0x0000000B, 0x00000012, 0x00000037,
+    0x00000044, 0x0000006E, 0x00000044, 0x00000047, 0x00000012, 0x00000078, 0x00000011, 0x00000033,
+    0x0000000A, 0x00000033, 0x00000002, 0x0000006A, 0x00000043, 0x00000051, 0x00000012, 0x00000033,
+    0x00000043, 0x00000011, 0x00000032, 0x00000004, 0x0000004A, 0x00000033, 0x00000007, 0x00000012,
+    0x00000013, 0x00000079, 0x00000004, 0x00000039, 0x00000043, 0x00000012, 0x00000073, 0x00000004,
+    0x0000000D, 0x00000038, 0x00000007, 0x00000073, 0x00000007, 0x00000033, 0x00000048, 0x0000000E,
+    0x00000032, 0x00000003, 0x00000004, 0x0000000B, 0x00000032, 0x00000003, 0x00000004, 0x00000032,
+    0x00000000, 0x00000012, 0x00000033, 0x00000007, 0x00000012, 0x00000037, 0x00000000, 0x00000003,
+    0x00000032, 0x00000000, 0x00000004, 0x0000000E, 0x00000032, 0x00000040, 0x00000004, 0x00000038,
+    0x00000005, 0x00000035, 0x00000007, 0x00000038, 0x0000000B, 0x00000031, 0x0000000D, 0x0000002E,
+    0x00000002, 0x00000044, 0x00000008, 0x0000002F, 0x00000000, 0x0000002C, 0x00000047, 0x00000032,
+    0x00000003, 0x0000004D, 0x00000051, 0x00000032, 0x0000000A, 0x00000031, 0x00000003, 0x0000000A,
+    0x00000012, 0x00000033, 0x00000005, 0x00000033, 0x00000012, 0x00000039, 0x00000044, 0x00000008,
+    0x00000012, 0x00000038, 0x0000004C, 0x0000002F, 0x00000005, 0x00000071, 0x00000000, 0x00000063,
+    0x0000004B, 0x0000004D, 0x0000002F, 0x00000000, 0x00000004, 0x0000000F, 0x00000032, 0x00000000,
+    0x00000043, 0x00000012, 0x00000073, 0x00000044, 0x00000047, 0x00000038, 0x0000004F, 0x00000072,
+    0x00000043, 0x0000000A, 0x0000004D, 0x00000012, 0x00000073, 0x00000044, 0x00000012, 0x00000013,
+    0x00000038, 0x0000004D, 0x00000033, 0x00000005, 0x0000006C, 0x00000052, 0x00000039, 0x00000005,
+    0x0000004F, 0x00000073, 0x00000004, 0x00000065, 0x00000004, 0x0000002F, 0x00000043, 0x00000044,
+    0x00000073, 0x00000006, 0x00000011, 0x00000032, 0x00000000, 0x00000008, 0x00000078, 0x00000003,
+    0x0000004C, 0x00000032, 0x00000000, 0x00000044, 0x00000078, 0x00000003, 0x0000000C, 0x00000012,
+    0x00000033, 0x0000004D, 0x00000011, 0x00000032, 0x00000003, 0x00000011, 0x00000038, 0x00000043,
+    0x00000004, 0x00000012, 0x00000073, 0x0000000E, 0x00000077, 0x0000000E, 0x00000012, 0x00000078,
+    0x0000004E, 0x00000078, 0x00000003, 0x00000004, 0x00000011, 0x00000032, 0x00000000, 0x0000000E,
+    0x00000078, 0x00000007, 0x0000000B, 0x00000032, 0x00000044, 0x00000013, 0x00000038, 0x00000003,
+    0x0000000B, 0x0000000D, 0x00000011, 0x00000012, 0x00000038, 0x00000005, 0x00000032, 0x00000000,
+    0x00000003, 0x0000004B, 0x0000000D, 0x00000051, 0x00000032, 0x00000002, 0x00000063, 0x00000047,
+    0x00000012, 0x00000038, 0x00000000, 0x00000078, 0x00000000, 0x0000006E, 0x0000004C, 0x00000073,
+    0x00000002, 0x0000002B, 0x00000042, 0x00000003, 0x0000002B, 0x00000003, 0x0000006B, 0x00000051,
+    0x00000012, 0x00000033, 0x00000016, 0x00000077, 0x0000000B, 0x00000036, 0x00000002, 0x00000003,
+    0x0000002D, 0x00000003, 0x00000012, 0x00000073, 0x00000004, 0x0000000E, 0x00000012, 0x00000034,
+    0x0000004E, 0x00000038, 0x00000040, 0x0000006E, 0x00000001, 0x00000031, 0x0000000A, 0x00000036,
+    0x00000008, 0x00000014, 0x00000038, 0x00000041, 0x00000031, 0x00000043, 0x0000004B, 0x00000032,
+    0x00000004, 0x0000004D, 0x00000032, 0x00000008, 0x00000012, 0x00000033, 0x00000012, 0x00000036,
+    0x00000006, 0x00000012, 0x00000039, 0x0000000A, 0x0000000D, 0x00000032, 0x00000004, 0x0000000D,
+    0x00000037, 0x00000003, 0x00000011, 0x00000012, 0x00000013, 0x00000038, 0x00000008, 0x0000004E,
+    0x00000014, 0x00000038, 0x00000003, 0x0000000D, 0x00000051, 0x00000037, 0x00000012, 0x00000053,
+    0x00000038, 0x00000004, 0x0000004D, 0x00000012, 0x00000038, 0x00000044, 0x00000047, 0x00000073,
+    0x00000004, 0x0000000E, 0x00000078, 0x00000003, 0x0000000B, 0x00000032, 0x00000007, 0x0000002E,
+    0x00000004, 0x0000004B, 0x00000051, 0x00000032, 0x00000000, 0x00000004, 0x00000026, 0x00000003,
+    0x00000012, 0x00000033, 0x00000008, 0x00000033, 0x0000000D, 0x00000012, 0x00000037, 0x00000000,
+    0x00000008, 0x0000004E, 0x00000012, 0x00000038, 0x00000003, 0x0000004D, 0x00000051, 0x00000012,
+    0x00000038, 0x00000000, 0x0000004E, 0x00000012, 0x00000038, 0x0000000C, 0x00000037, 0x00000043,
+    0x0000002D, 0x00000044, 0x0000000E, 0x00000032, 0x00000000, 0x00000042, 0x00000004, 0x0000006D,
+    0x00000008, 0x0000000D, 0x00000032, 0x00000003, 0x00000038, 0x00000003, 0x0000000B, 0x0000000D,
+    0x00000051, 0x00000032, 0x00000044, 0x00000008, 0x00000032, 0x00000003, 0x00000011, 0x00000012,
+    0x00000037, 0x00000000, 0x00000003, 0x00000011, 0x00000032, 0x00000012, 0x00000076, 0x00000004,
+    0x00000008, 0x0000004E, 0x00000032, 0x00000040, 0x00000022, 0x0000000C, 0x00000011, 0x00000012,
+    0x00000037, 0x00000001, 0x00000003, 0x00000007, 0x00000012, 0x00000033, 0x00000040, 0x00000044,
+    0x0000004E, 0x00000012, 0x00000078, 0x00000040, 0x00000042, 0x00000032, 0x00000004, 0x00000007,
+    0x00000032, 0x00000000, 0x00000023, 0x00000000, 0x00000044, 0x00000038, 0x00000004, 0x0000000D,
+    0x00000032, 0x00000004, 0x00000012, 0x00000053, 0x00000038, 0x00000040, 0x00000042, 0x00000028,
+    0x00000002, 0x0000002A, 0x00000000, 0x00000004, 0x00000027, 0x0000000B, 0x00000012, 0x00000073,
+    0x00000002, 0x00000005, 0x00000032, 0x00000004, 0x0000006E, 0x00000014, 0x00000036, 0x00000003,
+    0x0000000E, 0x00000011, 0x00000032, 0x00000003, 0x00000012, 0x00000037, 0x00000040, 0x00000008,
+    0x00000012, 0x00000038, 0x0000004B, 0x0000004C, 0x00000011, 0x00000032, 0x0000000B, 0x00000051,
+    0x00000032, 0x00000011, 0x00000078, 0x00000002, 0x00000024, 0x00000004, 0x00000047, 0x00000038,
+    0x00000000, 0x00000008, 0x00000012, 0x00000038, 0x00000006, 0x00000012, 0x00000038, 0x00000004,
+    0x0000004B, 0x00000012, 0x00000013, 0x00000038, 0x0000000E, 0x00000078, 0x00000003, 0x0000004B,
+    0x0000000D, 0x00000012, 0x00000013, 0x00000038, 0x00000004, 0x0000004E, 0x00000012, 0x00000038,
+    0x00000000, 0x00000004, 0x00000008, 0x00000012, 0x00000038, 0x00000000, 0x00000034, 0x0000004B,
+    0x00000012, 0x00000036, 0x0000000A, 0x0000002B, 0x00000003, 0x0000000B, 0x00000071, 0x00000001,
+    0x00000007, 0x00000034, 0x00000004, 0x0000000E, 0x00000038, 0x00000003, 0x0000004D, 0x00000031,
+    0x00000003, 0x0000004B, 0x0000000D, 0x00000032, 0x0000004D, 0x00000031, 0x00000012, 0x00000035,
+    0x00000011, 0x00000012, 0x00000033, 0x00000044, 0x00000026, 0x00000006, 0x00000033, 0x0000000D,
+    0x0000002F, 0x00000000, 0x00000003, 0x00000051, 0x00000012, 0x00000033, 0x00000042, 0x0000002C,
+    0x00000003, 0x0000000D, 0x0000000E, 0x00000051, 0x00000012, 0x00000014, 0x00000035, 0x00000040,
+    0x00000044, 0x00000012, 0x00000078, 0x0000000D, 0x0000006E, 0x00000003, 0x0000000D, 0x00000032,
+    0x00000003, 0x00000044, 0x00000071, 0x00000044, 0x00000067, 0x00000004, 0x0000004B, 0x00000012,
+    0x00000033, 0x00000000, 0x00000044, 0x00000008, 0x00000078, 0x00000014, 0x00000038, 0x0000004E,
+    0x00000012, 0x00000038, 0x00000008, 0x0000000E, 0x00000078, 0x00000044, 0x0000000E, 0x00000012,
+    0x00000078, 0x00000004, 0x00000005, 0x0000000E, 0x00000011, 0x00000014, 0x00000036, 0x00000000,
+    0x00000003, 0x00000008, 0x00000011, 0x00000032, 0x00000053, 0x00000036, 0x00000000, 0x0000004E,
+    0x00000032, 0x00000003, 0x00000051, 0x00000012, 0x00000033, 0x00000044, 0x0000002A, 0x00000043,
+    0x0000004D, 0x00000073, 0x00000044, 0x0000004A, 0x00000012, 0x00000073, 0x00000007, 0x0000000C,
+    0x00000033, 0x00000041, 0x00000044, 0x0000004F, 0x00000012, 0x00000038, 0x00000000, 0x0000000E,
+    0x00000012, 0x00000038, 0x00000004, 0x0000000F, 0x00000033, 0x00000000, 0x00000006, 0x0000006A,
+    0x00000004, 0x00000012, 0x00000013, 0x00000038, 0x00000003, 0x0000004D, 0x00000032, 0x00000000,
+    0x00000004, 0x00000052, 0x00000033, 0x00000044, 0x0000004A, 0x00000038, 0x00000043, 0x00000005,
+    0x00000011, 0x00000032, 0x00000000, 0x00000044, 0x00000008, 0x0000004E, 0x0000000F, 0x00000012,
+    0x00000038, 0x00000004, 0x0000004C, 0x00000032, 0x00000044, 0x00000046, 0x0000002A, 0x00000044,
+    0x0000000E, 0x00000012, 0x00000013, 0x00000038, 0x00000043, 0x0000002B, 0x00000003, 0x00000044,
+    0x00000051, 0x00000032, 0x00000008, 0x0000000E, 0x00000012, 0x00000078, 0x00000012, 0x00000037,
+    0x00000030, 0x0000004B, 0x00000011, 0x00000032, 0x00000004, 0x0000006C, 0x00000004, 0x0000004A,
+    0x00000073, 0x00000047, 0x00000048, 0x00000032, 0x0000000D, 0x00000078, 0x00000000, 0x00000004,
+    0x0000000E, 0x00000012, 0x00000033, 0x00000005, 0x0000000D, 0x00000033, 0x00000040, 0x00000044,
+    0x00000067, 0x00000002, 0x00000043, 0x00000032, 0x00000048, 0x0000004E, 0x00000037, 0x00000004,
+    0x0000004D, 0x00000033, 0x00000000, 0x00000044, 0x00000008, 0x00000012, 0x00000038, 0x00000003,
+    0x00000004, 0x00000051, 0x00000032, 0x0000000B, 0x0000000D, 0x00000032, 0x00000003, 0x0000000B,
+    0x0000004D, 0x00000011, 0x00000012, 0x00000038, 0x0000000E, 0x00000071, 0x00000047, 0x00000073,
+    0x0000004C, 0x0000000E, 0x00000032, 0x00000002, 0x0000006B, 0x00000052, 0x00000053, 0x00000038,
+    0x0000000B, 0x0000006F, 0x00000000, 0x00000003, 0x0000002F, 0x00000001, 0x00000037, 0x00000012,
+    0x00000053, 0x00000037, 0x00000061, 0x00000057, 0x00000078, 0x00000042, 0x00000004, 0x00000033,
+    0x0000000D, 0x00000013, 0x00000037, 0x00000053, 0x00000037, 0x00000056, 0x00000038, 0x00000006,
+    0x0000002D, 0x00000006, 0x0000006B, 0x00000013, 0x00000016, 0x00000038, 0x00000004, 0x00000012,
+    0x00000053, 0x00000036, 0x00000003, 0x0000004D, 0x00000033, 0x00000003, 0x00000036, 0x00000006,
+    0x00000037, 0x0000004B, 0x00000033, 0x0000000D, 0x00000037, 0x00000003, 0x0000000B, 0x0000000D,
+    0x00000051, 0x00000012, 0x00000073, 0x00000003, 0x0000004E, 0x00000032, 0x00000002, 0x00000003,
+    0x00000024, 0x0000000D, 0x00000051, 0x00000032, 0x00000044, 0x00000007, 0x00000032, 0x00000003,
+    0x0000000B, 0x0000000D, 0x00000071, 0x00000040, 0x0000002E, 0x00000004, 0x0000000A, 0x00000032,
+    0x00000043, 0x0000000B, 0x00000033, 0x0000000F, 0x00000012, 0x00000033, 0x00000002, 0x00000037,
+    0x0000000B, 0x0000004D, 0x0000002F, 0x0000000A, 0x0000000B, 0x0000000D, 0x00000012, 0x00000038,
+    0x00000000, 0x00000007, 0x0000000E, 0x00000032, 0x00000003, 0x0000000C, 0x00000032, 0x00000044,
+    0x00000007, 0x00000078, 0x00000040, 0x00000033, 0x00000051, 0x00000078, 0x00000000, 0x00000043,
+    0x00000044, 0x0000000B, 0x0000004F, 0x00000078, 0x00000044, 0x00000045, 0x0000000F, 0x00000012,
+    0x00000013, 0x00000078, 0x00000003, 0x0000000F, 0x00000031, 0x00000000, 0x00000003, 0x00000044,
+    0x00000073, 0x00000035, 0x00000006, 0x0000004F, 0x00000033, 0x00000000, 0x00000044, 0x00000032,
+    0x00000006, 0x0000000F, 0x00000051, 0x00000073, 0x0000004B, 0x0000000F, 0x00000032, 0x00000001,
+    0x00000004, 0x00000006, 0x0000004C, 0x0000000D, 0x0000004F, 0x00000013, 0x00000016, 0x00000038,
+    0x00000044, 0x00000076, 0x0000000C, 0x0000002F, 0x00000001, 0x00000003, 0x00000006, 0x00000036,
+    0x00000041, 0x0000006C, 0x00000008, 0x0000000E, 0x00000032, 0x0000000A, 0x0000000B, 0x0000000F,
+    0x00000032, 0x00000002, 0x00000008, 0x0000002B, 0x00000002, 0x00000045, 0x0000002D, 0x0000000D,
+    0x00000036, 0x00000000, 0x00000004, 0x00000012, 0x00000038, 0x00000044, 0x0000000E, 0x00000013,
+    0x00000078, 0x00000044, 0x0000004B, 0x0000000C, 0x00000053, 0x00000038, 0x00000043, 0x00000044,
+    0x0000004A, 0x0000000D, 0x0000006F, 0x0000004B, 0x0000000C, 0x0000000D, 0x00000032, 0x00000005,
+    0x0000000B, 0x00000051, 0x00000032, 0x0000000B, 0x0000004D, 0x0000004F, 0x00000051, 0x00000073,
+    0x00000045, 0x0000006B, 0x00000003, 0x00000004, 0x0000002E, 0x00000043, 0x0000000B, 0x00000011,
+    0x00000032, 0x00000044, 0x0000004A, 0x00000011, 0x00000012, 0x00000073, 0x00000007, 0x0000000E,
+    0x00000033, 0x0000004A, 0x0000000B, 0x0000000D, 0x00000012, 0x00000073, 0x00000044, 0x0000000B,
+    0x0000004D, 0x00000073, 0x00000003, 0x0000004D, 0x00000012, 0x00000078, 0x00000003, 0x00000076,
+    0x00000041, 0x00000066, 0x00000003, 0x0000000D, 0x00000011, 0x00000012, 0x00000037, 0x00000003,
+    0x00000012, 0x00000076, 0x00000003, 0x00000004, 0x0000004D, 0x00000032, 0x00000004, 0x00000047,
+    0x00000078, 0x00000044, 0x00000012, 0x00000033, 0x00000003, 0x00000005, 0x0000000D, 0x00000011,
+    0x00000012, 0x00000033, 0x00000005, 0x0000000B, 0x0000000C, 0x0000002F, 0x0000000E, 0x0000004F,
+    0x00000032, 0x0000000A, 0x00000012, 0x00000033, 0x0000000B, 0x00000011, 0x00000073, 0x0000004A,
+    0x0000006B, 0x00000004, 0x00000046, 0x0000000A, 0x00000073, 0x0000004A, 0x0000004F, 0x00000011,
+    0x00000073, 0x00000044, 0x0000006A, 0x0000000C, 0x0000004F, 0x00000033, 0x00000001, 0x0000004F,
+    0x00000032, 0x0000004B, 0x0000000C, 0x00000033, 0x0000004A, 0x00000011, 0x00000032, 0x00000044,
+    0x00000047, 0x00000032, 0x00000044, 0x0000000E, 0x00000078, 0x00000044, 0x00000005, 0x0000000A,
+    0x0000004B, 0x00000012, 0x00000038, 0x00000003, 0x0000004A, 0x0000002F, 0x00000003, 0x0000000A,
+    0x0000000B, 0x0000004F, 0x00000033, 0x00000044, 0x00000073, 0x0000000A, 0x00000012, 0x00000078,
+    0x00000007, 0x0000000D, 0x00000051, 0x00000032, 0x00000004, 0x00000008, 0x0000000E, 0x00000032,
+    0x00000003, 0x00000008, 0x00000011, 0x00000032, 0x00000004, 0x00000047, 0x00000012, 0x00000078,
+    0x00000003, 0x00000004, 0x0000000B, 0x00000011, 0x00000012, 0x00000037, 0x00000003, 0x00000004,
+    0x0000000B, 0x00000033, 0x00000004, 0x00000006, 0x0000004A, 0x00000032, 0x00000003, 0x00000044,
+    0x0000004A, 0x00000012, 0x00000033, 0x0000000B, 0x0000004D, 0x00000032, 0x00000000, 0x00000039,
+    0x0000004A, 0x0000000B, 0x0000000D, 0x00000051, 0x00000033, 0x0000004A, 0x00000012, 0x00000033,
+    0x00000043, 0x0000000B, 0x00000031, 0x00000003, 0x0000000A, 0x0000004B, 0x00000073, 0x00000043,
+    0x0000004B, 0x00000011, 0x00000032, 0x00000004, 0x0000004B, 0x00000073, 0x00000000, 0x00000044,
+    0x0000000A, 0x00000012, 0x00000078, 0x00000044, 0x00000012, 0x00000039, 0x00000053, 0x00000038,
+    0x00000045, 0x0000004A, 0x0000004B, 0x0000000C, 0x0000004D, 0x00000011, 0x00000033, 0x00000044,
+    0x0000000A, 0x00000073, 0x00000003, 0x00000006, 0x00000013, 0x00000078, 0x00000003, 0x00000044,
+    0x00000036, 0x00000046, 0x00000033, 0x0000004D, 0x00000012, 0x00000073, 0x00000001, 0x00000043,
+    0x00000053, 0x00000036, 0x00000041, 0x00000003, 0x00000013, 0x00000039, 0x00000043, 0x00000006,
+    0x0000004D, 0x00000071, 0x00000044, 0x0000004A, 0x0000006B, 0x00000043, 0x00000004, 0x00000006,
+    0x0000006A, 0x00000044, 0x0000004A, 0x0000000D, 0x00000011, 0x00000012, 0x00000073, 0x00000043,
+    0x0000004A, 0x0000004B, 0x0000004C, 0x0000000D, 0x00000031, 0x00000043, 0x0000000A, 0x0000004B,
+    0x0000000C, 0x0000000D, 0x0000004F, 0x00000071, 0x00000000, 0x00000004, 0x0000002B, 0x00000003,
+    0x0000000E, 0x00000012, 0x00000033, 0x00000004, 0x0000006D, 0x00000001, 0x00000004, 0x0000004B,
+    0x00000073, 0x00000046, 0x0000004A, 0x00000073, 0x00000004, 0x0000000A, 0x0000000F, 0x00000032,
+    0x00000004, 0x00000008, 0x00000012, 0x00000033, 0x00000044, 0x0000002D, 0x00000000, 0x0000006F,
+    0x00000003, 0x00000044, 0x00000006, 0x0000000A, 0x0000000D, 0x00000078, 0x00000043, 0x0000000A,
+    0x0000004B, 0x0000004F, 0x00000031, 0x00000044, 0x0000004A, 0x0000004C, 0x00000078, 0x0000000D,
+    0x0000000F, 0x00000011, 0x00000073, 0x0000000D, 0x0000000F, 0x00000032, 0x00000003, 0x00000004,
+    0x00000006, 0x0000000A, 0x0000004F, 0x00000056, 0x00000078, 0x0000000F, 0x00000036, 0x00000000,
+    0x00000006, 0x0000000C, 0x0000006F, 0x0000000F, 0x00000016, 0x00000038, 0x0000000B, 0x0000002C,
+    0x0000000C, 0x0000004F, 0x00000032, 0x00000046, 0x0000004A, 0x00000012, 0x00000073, 0x00000044,
+    0x00000008, 0x0000002E, 0x00000007, 0x0000000B, 0x00000012, 0x00000033, 0x00000048, 0x0000004F,
+    0x00000038, 0x00000006, 0x0000000A, 0x00000032, 0x00000003, 0x00000004, 0x00000005, 0x0000004C,
+    0x00000033, 0x0000000B, 0x00000051, 0x00000073, 0x00000003, 0x0000000B, 0x0000004F, 0x00000011,
+    0x00000012, 0x00000073, 0x0000004D, 0x0000006F, 0x00000043, 0x00000044, 0x0000006D, 0x00000004,
+    0x00000036, 0x0000004E, 0x00000031, 0x0000000A, 0x00000010, 0x00000011, 0x00000032, 0x00000000,
+    0x00000011, 0x00000032, 0x00000000, 0x00000008, 0x0000004E, 0x00000012, 0x00000078, 0x00000003,
+    0x0000000D, 0x00000051, 0x00000012, 0x00000033, 0x00000002, 0x0000000A, 0x00000012, 0x00000073,
+    0x0000000B, 0x0000000D, 0x00000031, 0x00000003, 0x00000004, 0x00000012, 0x00000038, 0x00000008,
+    0x0000004E, 0x00000012, 0x00000033, 0x00000040, 0x00000038, 0x00000000, 0x00000004, 0x00000012,
+    0x00000078, 0x00000000, 0x00000004, 0x00000006, 0x0000004A, 0x00000012, 0x00000037, 0x00000003,
+    0x0000000A, 0x00000032, 0x00000002, 0x0000000D, 0x00000071, 0x00000044, 0x0000002C, 0x00000004,
+    0x00000046, 0x0000004A, 0x00000032, 0x0000004D, 0x0000000E, 0x0000002F, 0x00000003, 0x0000002F,
+    0x00000041, 0x00000004, 0x00000076, 0x00000079, 0x00000003, 0x00000004, 0x0000000A, 0x00000011,
+    0x00000032, 0x00000007, 0x0000000D, 0x00000032, 0x00000002, 0x00000028, 0x00000004, 0x00000008,
+    0x0000000A, 0x0000006E, 0x00000003, 0x0000004C, 0x00000011, 0x00000032, 0x00000003, 0x0000004B,
+    0x00000071, 0x00000042, 0x0000006D, 0x00000044, 0x0000004A, 0x00000073, 0x0000000A, 0x0000004B,
+    0x0000004D, 0x00000073, 0x0000000A, 0x00000010, 0x00000012, 0x00000033, 0x00000002, 0x00000043,
+    0x0000006B, 0x00000003, 0x0000000A, 0x00000033, 0x00000000, 0x00000002, 0x00000004, 0x0000000A,
+    0x00000032, 0x0000004F, 0x00000039, 0x0000000B, 0x00000078, 0x00000004, 0x0000004B, 0x00000011,
+    0x00000032, 0x00000043, 0x0000000B, 0x0000000D, 0x0000000F, 0x00000011, 0x00000073, 0x00000044,
+    0x0000000A, 0x00000012, 0x00000038, 0x00000004, 0x0000004B, 0x0000002F, 0x00000002, 0x0000000A,
+    0x00000030, 0x00000006, 0x0000000D, 0x00000031, 0x00000004, 0x00000071, 0x00000016, 0x00000038,
+    0x00000003, 0x00000006, 0x0000002F, 0x00000004, 0x00000053, 0x00000016, 0x00000037, 0x00000044,
+    0x0000004B, 0x0000002D, 0x00000004, 0x00000053, 0x00000038, 0x00000004, 0x0000004F, 0x00000038,
+    0x00000000, 0x00000037, 0x00000044, 0x0000004E, 0x00000033, 0x00000012, 0x00000017, 0x00000038,
+    0x00000000, 0x0000006B, 0x00000040, 0x00000008, 0x00000032, 0x00000003, 0x00000011, 0x00000012,
+    0x00000036, 0x00000040, 0x00000003, 0x00000032, 0x00000003, 0x0000000E, 0x00000032, 0x00000004,
+    0x0000004B, 0x00000032, 0x00000001, 0x0000006B, 0x00000000, 0x00000004, 0x00000008, 0x00000032,
+    0x00000018, 0x00000079, 0x00000003, 0x00000012, 0x00000039, 0x0000004B, 0x0000000D, 0x0000002F,
+    0x0000000A, 0x0000000C, 0x0000006F, 0x00000007, 0x0000004A, 0x00000012, 0x00000033, 0x00000005,
+    0x0000004F, 0x00000033, 0x0000000A, 0x0000002D, 0x00000002, 0x0000000D, 0x00000032,
+};
@@ -0,0 +1,189 @@
+#pragma once
+
+/*
+
+Word Game.
+
+The rules of the game for any word length from 4 to 8 and any number of
+rows, played against a WordList loaded at runtime.
+
+Length and rows are template parameters, so each variant gets its own
+copy of the scoring loops with the bounds known at compile time. The
+compiler unrolls them the same way it does for the hand written 5 letter
+code in scoring.cpp, which the 5 letter rules call instead.
+
+This is the core for lists loaded from files (see word_list_file.h).
+The game's own boards play the compiled in list with Board and
+MultiBoard, which are built around its precomputed tables.
+
+Feedback is the same base 3 number as Scoring::Feedback, but needs a u16
+past 5 letters (3^8 = 6561).
+
+*/
+
+#include "core/types.h"
+#include "board.h"
+#include "packed_word.h"
+#include "scoring.h"
+#include "word_list_file.h"
+
+template <s32 Length>
+struct WordRules
+{
+    static_assert(Length >= minWordFileLength && Length <= maxWordFileLength, "Unsupported word length!");
+
+    using Feedback = u16;
+
+    static constexpr s32 length = Length;
+
+    static constexpr s32 ComputeFeedbackCount()
+    {
+        s32 count = 1;
+        for (s32 i = 0; i < Length; i++)
+            count *= 3;
+
+        return count;
+    }
+
+    static constexpr s32 feedbackCount = ComputeFeedbackCount();
+    static constexpr Feedback allCorrectFeedback = feedbackCount - 1;
+
+    static constexpr u64 allCorrectMask = (1u << Length) - 1;
+
+    // Returns the letter at the position as 0..25
+    static constexpr s32 GetLetter(u64 word, s32 position)
+    {
+        return (s32) ((word >> (5 * position)) & 0x1F) - 1;
+    }
+
+    static Feedback Score(u64 guess, u64 answer)
+    {
+        // Packed the same way, and digits come out the same, as the built in list's scoring
+        if constexpr (Length == wordLength)
+            return Scoring::Score((PackedWord) guess, (PackedWord) answer);
+        else
+            return ScoreLetters(guess, answer);
+    }
+
+    static Feedback ScoreLetters(u64 guess, u64 answer)
+    {
+        u8 lettersLeft[26] = {};
+        u32 correctMask = 0;
+
+        for (s32 i = 0; i < Length; i++)
+        {
+            if (GetLetter(guess, i) == GetLetter(answer, i))
+                correctMask |= 1u << i;
+            else
+                lettersLeft[GetLetter(answer, i)]++;
+        }
+
+        Feedback feedback = 0;
+        Feedback power = 1;
+
+        for (s32 i = 0; i < Length; i++, power *= 3)
+        {
+            if (correctMask & (1u << i))
+            {
+                feedback += 2 * power;
+                continue;
+            }
+
+            s32 letter = GetLetter(guess, i);
+            if (lettersLeft[letter] > 0)
+            {
+                lettersLeft[letter]--;
+                feedback += power;
+            }
+        }
+
+        return feedback;
+    }
+
+    // Bit i is set if position i is correct
+    static constexpr u32 GetCorrectMask(Feedback feedback)
+    {
+        u32 mask = 0;
+        for (s32 i = 0; i < Length; i++, feedback /= 3)
+            mask |= (u32) (feedback % 3 == 2) << i;
+
+        return mask;
+    }
+
+    // Bit i is set if position i is placed
+    static constexpr u32 GetPlacedMask(Feedback feedback)
+    {
+        u32 mask = 0;
+        for (s32 i = 0; i < Length; i++, feedback /= 3)
+            mask |= (u32) (feedback % 3 == 1) << i;
+
+        return mask;
+    }
+};
+
+template <s32 Length, s32 Rows>
+struct WordGame
+{
+    using Rules = WordRules<Length>;
+    using Feedback = typename Rules::Feedback;
+
+    static constexpr s32 length = Length;
+    static constexpr s32 rows = Rows;
+
+    const WordList* list;
+
+    u64 answer;
+    u64 guesses[Rows];
+    Feedback feedback[Rows];
+
+    s32 guessCount;
+    BoardStatus status;
+
+    // Starts a new game with list.answers[answerIndex] as the answer
+    void Reset(const WordList& wordList, s32 answerIndex)
+    {
+        list = &wordList;
+        answer = wordList.answers[answerIndex];
+        guessCount = 0;
+        status = BoardStatus::PLAYING;
+    }
+
+    // Plays a packed guess. Returns false (and changes nothing) if it isn't in the list.
+    bool Guess(u64 guess, Feedback& result)
+    {
+        if (status != BoardStatus::PLAYING || !WordListFile::Contains(*list, guess))
+            return false;
+
+        result = Rules::Score(guess, answer);
+
+        guesses[guessCount] = guess;
+        feedback[guessCount] = result;
+        guessCount++;
+
+        if (result == Rules::allCorrectFeedback)
+            status = BoardStatus::WON;
+        else if (guessCount >= Rows)
+            status = BoardStatus::LOST;
+
+        return true;
+    }
+
+    // Plays an uppercase word of Length letters
+    bool Guess(const char* word, Feedback& result)
+    {
+        u64 packed = WordListFile::PackWord(word, Length);
+        return packed && Guess(packed, result);
+    }
+
+    // True if the answer could still be this word given every guess so far
+    bool IsConsistent(u64 word) const
+    {
+        for (s32 i = 0; i < guessCount; i++)
+        {
+            if (Rules::Score(guesses[i], word) != feedback[i])
+                return false;
+        }
+
+        return true;
+    }
+};
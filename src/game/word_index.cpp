@@ -0,0 +1,82 @@
+#include "word_index.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "packed_word.h"
+
+namespace WordIndex
+{
+
+// Power of 2 so probing can wrap with a mask instead of a modulo.
+// Keeps the load factor under 0.4 for the full word list.
+static constexpr u32 CAPACITY_BITS = 15;
+static constexpr u32 CAPACITY = 1 << CAPACITY_BITS;
+static constexpr u32 CAPACITY_MASK = CAPACITY - 1;
+
+static_assert(wordListSize < CAPACITY / 2, "Word index is too small for the word list!");
+
+static struct
+{
+    u32 keys[CAPACITY];         // Packed words, 0 means the slot is empty
+    u16 indices[CAPACITY];      // Index into wordList
+    bool built = false;
+} index;
+
+static inline u32 HomeSlot(u32 packed)
+{
+    // Fibonacci hashing, the top bits of the product are the best mixed
+    return (packed * 0x9E3779B1u) >> (32 - CAPACITY_BITS);
+}
+
+void Build()
+{
+    // Static storage starts zeroed, so the table only needs filling once
+    if (index.built)
+        return;
+
+    BuildPackedWordList();
+
+    for (s32 i = 0; i < wordListSize; i++)
+    {
+        u32 packed = packedWordList[i];
+        u32 slot = HomeSlot(packed);
+
+        while (index.keys[slot] != 0)
+        {
+            AssertWithMessage(index.keys[slot] != packed, "Duplicate word in word list!");
+            slot = (slot + 1) & CAPACITY_MASK;
+        }
+
+        index.keys[slot] = packed;
+        index.indices[slot] = (u16) i;
+    }
+
+    index.built = true;
+}
+
+s32 Find(const char* word)
+{
+    AssertWithMessage(index.built, "Word index was not built!");
+
+    // Reject anything that isn't 5 uppercase letters, otherwise it could alias a real word
+    for (int i = 0; i < 5; i++)
+    {
+        if (word[i] < 'A' || word[i] > 'Z')
+            return -1;
+    }
+
+    u32 packed = PackWord(word);
+    u32 slot = HomeSlot(packed);
+
+    while (index.keys[slot] != 0)
+    {
+        if (index.keys[slot] == packed)
+            return index.indices[slot];
+
+        slot = (slot + 1) & CAPACITY_MASK;
+    }
+
+    return -1;
+}
+
+} // namespace WordIndex
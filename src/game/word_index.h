@@ -0,0 +1,31 @@
+#pragma once
+
+#include "core/types.h"
+#include "packed_word.h"
+
+/*
+
+Word Index.
+
+Open-addressed hash table over every word in packedWordList,
+so a lookup is one hash, and usually one or two integer compares.
+
+The table is built once at startup and lives in static memory.
+
+*/
+
+namespace WordIndex
+{
+
+// Builds the table from packedWordList (which is built if needed). Safe to call more than once.
+void Build();
+
+// Returns the index of the word in wordList, or -1 if it isn't an allowed guess
+s32 Find(const char* word);
+
+inline bool Contains(const char* word)
+{
+    return Find(word) >= 0;
+}
+
+} // namespace WordIndex
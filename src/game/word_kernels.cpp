@@ -0,0 +1,115 @@
+#include "word_kernels.h"
+
+#include "core/types.h"
+#include "math/bits.h"
+#include "packed_word.h"
+#include "simd_internal.h"
+
+namespace WordKernels
+{
+
+using namespace Simd;
+
+// Runs compare(index) -> lane mask over count words and packs the results into a bitset
+template <typename Compare, typename Scalar>
+static inline void WriteBitset(s32 count, u64* outBits, Compare compare, Scalar scalar)
+{
+    s32 i = 0;
+
+    for (; i + laneCount <= count; i += laneCount)
+    {
+        u64& bits = outBits[i / 64];
+        if ((i & 63) == 0)
+            bits = 0;
+
+        bits |= (u64) compare(i) << (i & 63);
+    }
+
+    for (; i < count; i++)
+    {
+        u64& bits = outBits[i / 64];
+        if ((i & 63) == 0)
+            bits = 0;
+
+        bits |= (u64) scalar(i) << (i & 63);
+    }
+}
+
+s32 FindWord(const PackedWord* words, s32 count, PackedWord word)
+{
+    Vec needle = Set1(word);
+
+    s32 i = 0;
+    for (; i + laneCount <= count; i += laneCount)
+    {
+        u32 mask = MoveMask(CmpEq(Load(words + i), needle));
+        if (mask)
+            return i + CountTrailingZeros(mask);
+    }
+
+    for (; i < count; i++)
+    {
+        if (words[i] == word)
+            return i;
+    }
+
+    return -1;
+}
+
+void BuildLetterMasks(const PackedWord* words, s32 count, u32* outMasks)
+{
+    const Vec fieldMask = Set1(letterFieldMask);
+
+    s32 i = 0;
+    for (; i + laneCount <= count; i += laneCount)
+    {
+        Vec packed = Load(words + i);
+        Vec mask = Zero();
+
+        for (s32 p = 0; p < wordLength; p++)
+        {
+            Vec letters = And(ShiftRight(packed, letterBits * p), fieldMask);
+            mask = Or(mask, LetterBit(letters));
+        }
+
+        Store(outMasks + i, mask);
+    }
+
+    for (; i < count; i++)
+        outMasks[i] = words[i] ? GetLetterMask(words[i]) : 0;
+}
+
+void MatchLetterAt(const PackedWord* words, s32 count, s32 position, s32 letter, u64* outBits)
+{
+    const Vec fieldMask = Set1(letterFieldMask);
+    const Vec needle = Set1((u32)(letter + 1));
+    const s32 shift = letterBits * position;
+
+    WriteBitset(count, outBits,
+        [&](s32 i) {
+            Vec letters = And(ShiftRight(Load(words + i), shift), fieldMask);
+            return MoveMask(CmpEq(letters, needle));
+        },
+        [&](s32 i) {
+            return (u32)(words[i] && GetLetter(words[i], position) == letter);
+        });
+}
+
+void MatchLetterMasks(const u32* letterMasks, s32 count, u32 required, u32 excluded, u64* outBits)
+{
+    const Vec requiredVec = Set1(required);
+    const Vec excludedVec = Set1(excluded);
+
+    WriteBitset(count, outBits,
+        [&](s32 i) {
+            Vec masks = Load(letterMasks + i);
+            Vec hasAll  = CmpEq(And(masks, requiredVec), requiredVec);
+            Vec hasNone = CmpEq(And(masks, excludedVec), Zero());
+            return MoveMask(And(hasAll, hasNone));
+        },
+        [&](s32 i) {
+            return (u32)((letterMasks[i] & required) == required && (letterMasks[i] & excluded) == 0);
+        });
+}
+
+} // namespace WordKernels
@@ -0,0 +1,36 @@
+#pragma once
+
+/*
+
+SIMD kernels over arrays of packed words.
+
+Uses AVX2 (8 words per instruction) when compiled with it enabled,
+otherwise SSE2 (4 words per instruction). Counts don't need to be a
+multiple of the vector width, but packedWordList is padded so passing
+packedWordListSize avoids the scalar tail entirely.
+
+Kernels that produce a bitset write one bit per word, word i at
+bit (i % 64) of bits[i / 64]. The output must hold (count + 63) / 64 u64s.
+
+*/
+
+#include "core/types.h"
+#include "packed_word.h"
+
+namespace WordKernels
+{
+
+// Index of the first occurrence of word, or -1
+s32 FindWord(const PackedWord* words, s32 count, PackedWord word);
+
+// One bit per letter present in each word (0 for padding)
+void BuildLetterMasks(const PackedWord* words, s32 count, u32* outMasks);
+
+// Sets bit i if words[i] has letter (0..25) at position
+void MatchLetterAt(const PackedWord* words, s32 count, s32 position, s32 letter, u64* outBits);
+
+// Sets bit i if letterMasks[i] contains every letter in required and none in excluded
+// (padding has an empty mask, so it only matches when required is 0)
+void MatchLetterMasks(const u32* letterMasks, s32 count, u32 required, u32 excluded, u64* outBits);
+
+} // namespace WordKernels
@@ -0,0 +1,171 @@
+#include "word_list_file.h"
+
+#include "core/types.h"
+#include "core/logging.h"
+#include "platform/platform.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace WordListFile
+{
+
+static constexpr char fileMagic[4] = { 'W', 'R', 'D', 'S' };
+static constexpr u64 dataOffset = 64;
+
+static_assert(sizeof(FileHeader) <= dataOffset, "Word list header doesn't fit before the data!");
+
+u64 PackWord(const char* word, s32 length)
+{
+    u64 packed = 0;
+    for (s32 i = 0; i < length; i++)
+    {
+        if (word[i] < 'A' || word[i] > 'Z')
+            return 0;
+
+        packed |= (u64) (word[i] - 'A' + 1) << (5 * i);
+    }
+
+    return packed;
+}
+
+void UnpackWord(u64 packed, s32 length, char* output)
+{
+    for (s32 i = 0; i < length; i++)
+        output[i] = (char) (((packed >> (5 * i)) & 0x1F) - 1 + 'A');
+}
+
+static u64 Checksum(const u64* answers, s32 answerCount, const u64* words, s32 wordCount)
+{
+    u64 hash = 0xCBF29CE484222325ull;
+
+    const u8* bytes = (const u8*) answers;
+    for (u64 i = 0; i < (u64) answerCount * sizeof(u64); i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+
+    bytes = (const u8*) words;
+    for (u64 i = 0; i < (u64) wordCount * sizeof(u64); i++)
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+
+    return hash;
+}
+
+// Sorts and removes duplicates, returns the new count
+static s32 SortUnique(u64* words, s32 count)
+{
+    std::sort(words, words + count);
+    return (s32) (std::unique(words, words + count) - words);
+}
+
+bool Save(const char* filepath, s32 wordLength, u64* answers, s32 answerCount, u64* words, s32 wordCount)
+{
+    AssertWithMessage(wordLength >= minWordFileLength && wordLength <= maxWordFileLength, "Word length is out of range!");
+
+    answerCount = SortUnique(answers, answerCount);
+    wordCount = SortUnique(words, wordCount);
+
+    // Every answer has to be a valid guess
+    u64* allWords = (u64*) PlatformAllocate((u64) (answerCount + wordCount) * sizeof(u64));
+    AssertWithMessage(allWords, "Couldn't allocate word list!");
+
+    PlatformCopyMemory(allWords, words, (u64) wordCount * sizeof(u64));
+    PlatformCopyMemory(allWords + wordCount, answers, (u64) answerCount * sizeof(u64));
+    s32 allCount = SortUnique(allWords, answerCount + wordCount);
+
+    FILE* file = fopen(filepath, "wb");
+    if (!file)
+    {
+        PlatformFree(allWords);
+        return false;
+    }
+
+    u8 header[dataOffset] = {};
+
+    FileHeader& fileHeader = *(FileHeader*) header;
+    PlatformCopyMemory(fileHeader.magic, fileMagic, sizeof(fileMagic));
+    fileHeader.version = fileVersion;
+    fileHeader.wordLength = wordLength;
+    fileHeader.answerCount = answerCount;
+    fileHeader.wordCount = allCount;
+    fileHeader.checksum = Checksum(answers, answerCount, allWords, allCount);
+    fileHeader.answersOffset = dataOffset;
+    fileHeader.wordsOffset = dataOffset + (u64) answerCount * sizeof(u64);
+
+    bool success = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+                   fwrite(answers, sizeof(u64), answerCount, file) == (u64) answerCount &&
+                   fwrite(allWords, sizeof(u64), allCount, file) == (u64) allCount;
+
+    fclose(file);
+    PlatformFree(allWords);
+
+    return success;
+}
+
+bool Load(const char* filepath, WordList& list)
+{
+    Free(list);
+
+    PlatformMappedFile file;
+    if (!PlatformMapFile(filepath, file))
+        return false;
+
+    const FileHeader& header = *(const FileHeader*) file.data;
+
+    bool valid = file.size >= sizeof(FileHeader) &&
+                 header.magic[0] == fileMagic[0] && header.magic[1] == fileMagic[1] &&
+                 header.magic[2] == fileMagic[2] && header.magic[3] == fileMagic[3] &&
+                 header.version == fileVersion &&
+                 header.wordLength >= minWordFileLength && header.wordLength <= maxWordFileLength &&
+                 header.answerCount > 0 && header.wordCount >= header.answerCount &&
+                 header.answersOffset % sizeof(u64) == 0 && header.wordsOffset % sizeof(u64) == 0 &&
+                 header.answersOffset + (u64) header.answerCount * sizeof(u64) <= file.size &&
+                 header.wordsOffset + (u64) header.wordCount * sizeof(u64) <= file.size;
+
+    if (valid)
+    {
+        const u64* answers = (const u64*) ((const u8*) file.data + header.answersOffset);
+        const u64* words = (const u64*) ((const u8*) file.data + header.wordsOffset);
+        valid = header.checksum == Checksum(answers, header.answerCount, words, header.wordCount);
+    }
+
+    if (!valid)
+    {
+        Warn("Word list file is corrupt, ignoring it.");
+        PlatformUnmapFile(file);
+        return false;
+    }
+
+    list.wordLength = header.wordLength;
+    list.answerCount = header.answerCount;
+    list.wordCount = header.wordCount;
+    list.answers = (const u64*) ((const u8*) file.data + header.answersOffset);
+    list.words = (const u64*) ((const u8*) file.data + header.wordsOffset);
+    list.file = file;
+
+    return true;
+}
+
+void Free(WordList& list)
+{
+    PlatformUnmapFile(list.file);
+    list = WordList();
+}
+
+s32 Find(const WordList& list, u64 packed)
+{
+    s32 low = 0;
+    s32 high = list.wordCount;
+
+    while (low < high)
+    {
+        s32 mid = (low + high) / 2;
+        if (list.words[mid] < packed)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return (low < list.wordCount && list.words[low] == packed) ? low : -1;
+}
+
+} // namespace WordListFile
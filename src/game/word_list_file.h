@@ -0,0 +1,91 @@
+#pragma once
+
+/*
+
+Word List Files.
+
+Dictionaries loaded at runtime instead of compiled in, so lists for
+other word lengths or rules can ship without rebuilding. They're played
+through WordGame (word_game.h), which simulate --words runs.
+tools/build_word_list.cpp writes them from plain text.
+
+The game itself still plays the compiled in 5 letter list. Its word
+index, candidate sets, feedback matrix, hints and replay logs all
+number words by their place in wordList, so a shipped words5.bin only
+narrows which of those words are accepted as guesses. Adding words to
+the game still takes a rebuild.
+
+Words of up to 8 letters are packed into a u64 the same way as
+PackedWord: 5 bits per letter, first letter in the lowest bits, letters
+stored as (ch - 'A' + 1). Both sections are sorted by packed value when
+the file is written, so loading is just a mapping and lookups are a
+binary search.
+
+File layout (little endian):
+
+    FileHeader
+    padding up to header.answersOffset
+    answerCount packed answers, sorted
+    wordCount packed words every guess is checked against, sorted (answers included)
+
+*/
+
+#include "core/types.h"
+#include "platform/platform.h"
+
+constexpr s32 minWordFileLength = 4;
+constexpr s32 maxWordFileLength = 8;
+
+struct WordList
+{
+    s32 wordLength = 0;
+    s32 answerCount = 0;
+    s32 wordCount = 0;
+
+    const u64* answers = nullptr;
+    const u64* words = nullptr;
+
+    PlatformMappedFile file;
+};
+
+namespace WordListFile
+{
+
+constexpr u32 fileVersion = 1;
+constexpr char defaultPath[] = "assets/words5.bin";     // The game's dictionary, written by shipit
+
+struct FileHeader
+{
+    char magic[4];          // "WRDS"
+    u32  version;
+    u32  wordLength;
+    u32  answerCount;
+    u32  wordCount;
+    u32  reserved;
+    u64  checksum;          // FNV-1a over both sections
+    u64  answersOffset;
+    u64  wordsOffset;
+};
+
+// Packs the first length letters of an uppercase word, returns 0 if any of them isn't A-Z
+u64 PackWord(const char* word, s32 length);
+
+void UnpackWord(u64 packed, s32 length, char* output);
+
+// Sorts both lists in place, drops duplicates, adds missing answers to words and writes the file
+bool Save(const char* filepath, s32 wordLength, u64* answers, s32 answerCount, u64* words, s32 wordCount);
+
+// Maps a file written by Save. Returns false if it's missing or corrupt, leaving list empty.
+bool Load(const char* filepath, WordList& list);
+
+void Free(WordList& list);
+
+// Index of the packed word in list.words, or -1
+s32 Find(const WordList& list, u64 packed);
+
+inline bool Contains(const WordList& list, u64 packed)
+{
+    return Find(list, packed) >= 0;
+}
+
+} // namespace WordListFile
@@ -1,7 +1,23 @@
 #include "core/application.h"
 #include "core/input.h"
 #include "engine/imgui.h"
+#include "math/random.h"
 #include "game/wordlist.h"
+#include "game/word_index.h"
+#include "game/word_dawg.h"
+#include "game/word_list_file.h"
+#include "game/packed_word.h"
+#include "game/scoring.h"
+#include "game/feedback_matrix.h"
+#include "game/board.h"
+#include "game/multi_board.h"
+#include "game/absurdle.h"
+#include "game/game_state.h"
+#include "game/replay_log.h"
+#include "game/stats_store.h"
+#include "game/hints.h"
+#include "game/decision_tree.h"
+#include "game/opening_book.h"
 
 enum struct LetterState
 {
@@ -16,139 +32,280 @@ namespace FontSizes {
     constexpr f32 SMALL = 24;
 }
 
+// Where the boards go on screen, worked out once per game
+struct BoardLayout
+{
+    s32 columns;
+    f32 tileSize;
+    f32 tileGap;
+    f32 boardWidth;
+    f32 boardHeight;
+};
+
+constexpr s32 boardCountOptions[] = { 1, 2, 4, 8, 16, 32 };
+constexpr s32 boardCountOptionCount = sizeof(boardCountOptions) / sizeof(boardCountOptions[0]);
+
 struct GameState
 {
     // Game Settings
     Imgui::Font font;
     
-    char guesses[6][5]        = {};
-    u8   correctMasks[6]      = {};
-    u8   placedMasks[6]       = {};
-    s32  placedCharacters[26] = {};
+    char guesses[maxMultiGuesses][wordLength] = {};
     LetterState letterStates[26] = {};
     bool invalidWord = false;
+    WordDawg::Cursor cursor;    // Follows the current row so dead ends show up while typing
+    WordList dictionary;        // Guesses have to be in it when it's loaded, empty otherwise
+
+    MultiBoard boards;          // Answers and tile masks for every board
+    Board board;                // The first board with its candidates, hints use it when there's only one
+    s32 boardCount = 1;
+    GameMode mode = GameMode::CLASSIC;
+    AbsurdleBoard absurdle;     // Answers the adversary still hasn't ruled out
+    Absurdle::Partition partition;
+    BoardLayout layout;
+    Math::RandomState random;   // Picks the answers
+    Hints::Hint hint;
+    s32 solverMove = -1;        // Guess from the decision tree, if the board is still on it
+    bool showHint = false;
 
     s32 currentGuessIndex = 0;
     s32 filled = 0;
-    s32 wordIndex = 0;
+
+    // For the replay log
+    u32 startTime = 0;          // Seconds since the Unix epoch
+    f64 startClock = 0.0;
+    f64 lastGuessClock = 0.0;
+    bool recorded = false;
 } gGameState;
 
-constexpr u8 correctWordMask = 0x1F;
+// Picks the column count that gives the biggest tiles in the space left of the keyboard
+BoardLayout GetBoardLayout(s32 boardCount, s32 rowCount)
+{
+    constexpr f32 areaWidth = 560;
+    constexpr f32 areaHeight = 650;
+    constexpr f32 boardGap = 20;
+
+    BoardLayout best = {};
+
+    for (s32 columns = 1; columns <= boardCount; columns++)
+    {
+        s32 gridRows = (boardCount + columns - 1) / columns;
+
+        f32 cellWidth  = (areaWidth  - (columns  - 1) * boardGap) / columns;
+        f32 cellHeight = (areaHeight - (gridRows - 1) * boardGap) / gridRows;
+
+        // Gaps between tiles are a tenth of a tile
+        f32 tileSize = Min(cellWidth / (1.1f * wordLength - 0.1f), cellHeight / (1.1f * rowCount - 0.1f));
+        tileSize = Min(tileSize, 100.0f);
+
+        if (tileSize > best.tileSize)
+        {
+            best.columns = columns;
+            best.tileSize = tileSize;
+        }
+    }
+
+    best.tileGap = 0.1f * best.tileSize;
+    best.boardWidth  = wordLength * (best.tileSize + best.tileGap) - best.tileGap;
+    best.boardHeight = rowCount * (best.tileSize + best.tileGap) - best.tileGap;
+
+    return best;
+}
+
+Vector3 GetBoardTopLeft(const BoardLayout& layout, s32 board)
+{
+    constexpr f32 startX = 10;
+    constexpr f32 startY = 10;
+    constexpr f32 boardGap = 20;
+
+    s32 column = board % layout.columns;
+    s32 row = board / layout.columns;
+
+    return Vector3(startX + column * (layout.boardWidth + boardGap), startY + row * (layout.boardHeight + boardGap), 0);
+}
+
+// Sends every board of the current game to the replay log and counts it in the stats, once it has at least one guess
+void RecordGame(GameState& state)
+{
+    const MultiBoard& boards = state.boards;
+    if (state.recorded || boards.guessCount == 0)
+        return;
+
+    ReplayLog::Record record;
+    PlatformZeroMemory(&record, sizeof(record));
+
+    record.startTime = state.startTime;
+    record.duration = (u32) ((state.lastGuessClock - state.startClock) * 1000.0);
+    record.boardCount = (u8) boards.boardCount;
+    record.mode = state.mode;
+
+    for (s32 b = 0; b < boards.boardCount; b++)
+    {
+        s32 rows = boards.GetFilledRows(b);
+
+        record.answerIndex = (u16) boards.answerIndices[b];
+        record.guessCount = (u8) rows;
+        record.boardIndex = (u8) b;
+
+        if (boards.IsSolved(b))
+            record.outcome = ReplayLog::Outcome::WON;
+        else if (boards.status == BoardStatus::LOST)
+            record.outcome = ReplayLog::Outcome::LOST;
+        else
+            record.outcome = ReplayLog::Outcome::ABANDONED;
+
+        for (s32 row = 0; row < rows; row++)
+        {
+            record.guesses[row] = (u16) boards.guesses[row];
+            record.feedback[row] = boards.feedback[row][b];
+        }
+
+        // Never waits on the file, a full queue just drops the record
+        ReplayLog::Append(record);
+    }
+
+    // Leaving a game unfinished counts as a loss
+    StatsStore::RecordGame(state.mode, boards.boardCount, boards.status == BoardStatus::WON, boards.guessCount);
+
+    state.recorded = true;
+}
 
 void ResetGame(GameState& state)
 {
+    // Games left unfinished are still worth keeping
+    RecordGame(state);
+
     PlatformZeroMemory(state.guesses, sizeof(state.guesses));
-    PlatformZeroMemory(state.correctMasks, sizeof(state.correctMasks));
-    PlatformZeroMemory(state.placedMasks, sizeof(state.placedMasks));
-    PlatformZeroMemory(state.placedCharacters, sizeof(state.placedCharacters));
     PlatformZeroMemory(state.letterStates, sizeof(state.letterStates));
     state.invalidWord = false;
+    state.showHint = false;
     state.currentGuessIndex = 0;
     state.filled = 0;
-    state.wordIndex = 0;
-
-    state.wordIndex = answersEnd * Math::Random();
+    state.cursor.Reset();
 
-    for (int i = 0; i < 5; i++)
-        state.placedCharacters[wordList[state.wordIndex][i] - 'A']++;
+    StartGame(state.mode, state.boardCount, state.random, state.boards, state.board, state.absurdle);
+    state.startTime = ReplayLog::GetTimestamp();
+    state.startClock = PlatformGetTime();
+    state.recorded = false;
+    state.layout = GetBoardLayout(state.boardCount, state.boards.guessLimit);
 }
 
 void OnEventCheckInput(Application& app, Key key)
 {
     GameState& state = *(GameState*) app.data;
 
-    if (state.correctMasks[state.currentGuessIndex] != correctWordMask)
+    if (state.boards.status == BoardStatus::PLAYING)
     {
         if (key == Key::BACKSPACE)
         {
             state.filled = (state.filled > 0) ? state.filled - 1 : 0;
+            state.cursor.Pop();
             state.invalidWord = false;
         }
 
         if (key == Key::ESCAPE)
         {
             state.filled = 0;
+            state.cursor.Reset();
             state.invalidWord = false;
         }
 
+        if (key == Key::TAB)
+        {
+            // Hints only know how to play a single board with a fixed answer
+            if (state.mode == GameMode::CLASSIC && state.boardCount == 1)
+            {
+                // The precomputed tree is instant, built offline by a pruned search. Fall back to the entropy hint once the player leaves it
+                state.solverMove = DecisionTree::GetMove(state.board);
+                if (state.solverMove < 0 && !OpeningBook::GetHint(state.board, state.hint))
+                    state.hint = Hints::GetBestGuess(state.board.candidates);
+
+                state.showHint = state.solverMove >= 0 || state.hint.guessIndex >= 0;
+            }
+        }
+
         if (key >= Key::A && key <= Key::Z)
         {
-            if (state.currentGuessIndex < 6 && state.filled < 5)
+            if (state.filled < wordLength)
+            {
                 state.guesses[state.currentGuessIndex][state.filled++] = (char) key;
+                state.cursor.Push((char) key);
+            }
         }
 
         if (key == Key::ENTER)
         {
-            if (state.filled == 5)
+            if (state.filled == wordLength)
             {
-                bool found = false;
+                s32 guessIndex = WordIndex::Find(state.guesses[state.currentGuessIndex]);
+
+                // A shipped dictionary can only narrow the built in list, every table
+                // the game plays with numbers words by their place in wordList
+                if (guessIndex >= 0 && state.dictionary.wordCount > 0 &&
+                    !WordListFile::Contains(state.dictionary, WordListFile::PackWord(state.guesses[state.currentGuessIndex], wordLength)))
+                    guessIndex = -1;
 
-                for (int i = 0; !found && i < wordListSize; i++)
+                if (guessIndex >= 0)
                 {
-                    found = true;
+                    s32 row = state.currentGuessIndex;
 
-                    for (int s = 0; s < 5; s++)
+                    // Any word left in the bucket the adversary keeps scores the same
+                    // against every guess so far, so the board can just switch to one of them
+                    if (state.mode == GameMode::ABSURDLE)
                     {
-                        if (state.guesses[state.currentGuessIndex][s] != wordList[i][s])
-                        {
-                            found = false;
-                            break;
-                        }
+                        state.absurdle.Guess(guessIndex, state.partition);
+                        state.boards.SetAnswer(0, state.absurdle.candidates[0]);
                     }
-                }
 
-                if (found)
-                {
-                    s32 charsLeft[26];
-                    PlatformCopyMemory(charsLeft, state.placedCharacters, sizeof(charsLeft));
+                    // Scores every board at once
+                    state.boards.Guess(guessIndex);
 
-                    // Check Correctness
-                    for (int i = 0; i < 5; i++)
-                    {
-                        char guessChar = state.guesses[state.currentGuessIndex][i];
+                    if (state.mode == GameMode::CLASSIC && state.boardCount == 1)
+                        state.board.Guess(guessIndex);
 
-                        bool correct = wordList[state.wordIndex][i] == guessChar;
-                        state.correctMasks[state.currentGuessIndex] |= ((s32) correct << i);
+                    state.showHint = false;
 
-                        if (correct)
+                    // Keys show the best a letter did on any board that was still being played
+                    u8 correctMask = 0;
+                    u8 placedMask = 0;
+                    for (s32 b = 0; b < state.boardCount; b++)
+                    {
+                        if (state.boards.solvedAt[b] < 0 || state.boards.solvedAt[b] == row)
                         {
-                            charsLeft[guessChar - 'A']--;
-                            state.letterStates[guessChar - 'A'] = LetterState::CORRECT;
+                            correctMask |= state.boards.correctMasks[row][b];
+                            placedMask  |= state.boards.placedMasks[row][b];
                         }
                     }
 
-                    if (state.correctMasks[state.currentGuessIndex] != correctWordMask)
+                    for (int i = 0; i < wordLength; i++)
                     {
-                        // Check for placed
-                        for (int i = 0; i < 5; i++)
-                        {
-                            // Ignore correct guesses
-                            if (state.correctMasks[state.currentGuessIndex] & (1 << i))
-                                continue;
-                            
-                            char guessChar = state.guesses[state.currentGuessIndex][i];
-
-                            bool placed = charsLeft[guessChar - 'A'] > 0;
-                            state.placedMasks[state.currentGuessIndex] |= ((s32) placed << i);
-                            charsLeft[guessChar - 'A']--;
-
-                            // Save state based on priority (1. Correct, 2. Placed, 3. Wrong, 4. Untouched)
-                            if (placed)
-                            {
-                                if (state.letterStates[guessChar - 'A'] != LetterState::CORRECT)
-                                    state.letterStates[guessChar - 'A'] = LetterState::PLACED;
-                            }
-                            else
-                            {
-                                if (state.letterStates[guessChar - 'A'] == LetterState::UNTOUCHED)
-                                    state.letterStates[guessChar - 'A'] = LetterState::WRONG;
-                            }
+                        char guessChar = state.guesses[row][i];
+                        s32 flag = 1 << i;
 
+                        // Save state based on priority (1. Correct, 2. Placed, 3. Wrong, 4. Untouched)
+                        if (correctMask & flag)
+                        {
+                            state.letterStates[guessChar - 'A'] = LetterState::CORRECT;
+                        }
+                        else if (placedMask & flag)
+                        {
+                            if (state.letterStates[guessChar - 'A'] != LetterState::CORRECT)
+                                state.letterStates[guessChar - 'A'] = LetterState::PLACED;
+                        }
+                        else
+                        {
+                            if (state.letterStates[guessChar - 'A'] == LetterState::UNTOUCHED)
+                                state.letterStates[guessChar - 'A'] = LetterState::WRONG;
                         }
-
-                        state.currentGuessIndex++;
-                        state.filled = 0;
                     }
+
+                    state.lastGuessClock = PlatformGetTime();
+                    if (state.boards.status != BoardStatus::PLAYING)
+                        RecordGame(state);
+
+                    state.currentGuessIndex++;
+                    state.filled = 0;
+                    state.cursor.Reset();
                 }
                 else
                 {
@@ -167,7 +324,124 @@ void OnInit(Application& app)
 
     state.font.Load("assets/fonts/atlas.font.png", "assets/fonts/atlas.font.json");
 
+    WordIndex::Build();
+
+    // Written by tools/build_word_list.cpp, without it every word in the built in list counts
+    if (WordListFile::Load(WordListFile::defaultPath, state.dictionary) && state.dictionary.wordLength != wordLength)
+        WordListFile::Free(state.dictionary);
+
+    state.random = Math::SeedRandom(Math::GetTimeSeed());
+
+    // Built by tools/build_feedback_matrix.cpp, recomputing it is a slow fallback
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+        FeedbackMatrix::Build();
+
+    // Built by tools/build_decision_tree.cpp, hints fall back to entropy without it
+    DecisionTree::Load(DecisionTree::defaultPath);
+
+    // Built by tools/build_opening_book.cpp, the first two hints are searched for without it
+    OpeningBook::Load(OpeningBook::defaultPath);
+
+    // Games are only recorded if the log opens, the game plays the same without it
+    ReplayLog::Open(ReplayLog::defaultPath);
+
+    // A missing or unreadable stats file just means starting from zero
+    StatsStore::Load(StatsStore::defaultPath);
+
     ResetGame(state);
+
+    // Warm up the opening hint, it's the most expensive one and the same every game
+    if (!OpeningBook::IsLoaded())
+        Hints::GetBestGuess(state.board.candidates);
+}
+
+void OnShutdown(Application& app)
+{
+    GameState& state = *(GameState*) app.data;
+
+    RecordGame(state);
+    ReplayLog::Close();
+    StatsStore::Close();
+
+    WordListFile::Free(state.dictionary);
+    OpeningBook::Free();
+    DecisionTree::Free();
+    FeedbackMatrix::Free();
+}
+
+// Stats for the variant being played, under the end of game toasts. Returns where the next toast goes.
+s32 RenderStats(GameState& state, s32 y)
+{
+    const StatsStore::Stats& stats = StatsStore::Get(state.mode, state.boards.boardCount);
+    const Vector4 textColor = Vector4(0.3f, 0.3f, 0.3f, 1.0f);
+
+    {   // Summary
+        char buffer[128];
+        sprintf(buffer, "Played %u  Won %u%%  Streak %u  Best %u",
+                stats.played, (stats.played > 0) ? 100 * stats.won / stats.played : 0, stats.currentStreak, stats.maxStreak);
+
+        Vector2 size = Imgui::GetRenderedTextSize(buffer, state.font, FontSizes::SMALL);
+        Imgui::Rect rect;
+
+        {   // Render Background
+            rect.size = size + Vector2(50, 20);
+            rect.topLeft = Vector3((1618 - rect.size.x) / 2, y, 0);
+            Imgui::RenderRect(rect, Vector4(1));
+        }
+
+        {   // Render Text
+            Vector3 topLeft = rect.topLeft;
+            topLeft.x += 25;
+            topLeft.y += 10;
+            Imgui::RenderText(buffer, state.font, topLeft, FontSizes::SMALL, textColor);
+        }
+
+        y += rect.size.y + 10;
+    }
+
+    // A bar per row only fits for the shorter games
+    if (state.boards.guessLimit <= 8)
+    {   // Guess Distribution
+        constexpr f32 barHeight = 28;
+        constexpr f32 maxBarWidth = 300;
+
+        u32 mostWins = 1;
+        for (s32 n = 1; n <= state.boards.guessLimit; n++)
+            mostWins = (stats.guesses[n] > mostWins) ? stats.guesses[n] : mostWins;
+
+        for (s32 n = 1; n <= state.boards.guessLimit; n++)
+        {
+            char label[16];
+            sprintf(label, "%d", n);
+
+            char count[16];
+            sprintf(count, "%u", stats.guesses[n]);
+
+            // The row this game was won in stands out
+            bool thisGame = state.boards.status == BoardStatus::WON && state.boards.guessCount == n;
+
+            Imgui::Rect rect;
+            rect.size = Vector2(40 + (maxBarWidth - 40) * stats.guesses[n] / mostWins, barHeight);
+            rect.topLeft = Vector3((1618 - maxBarWidth) / 2, y, 0);
+            Imgui::RenderRect(rect, thisGame ? Vector4(0.003f, 0.71f, 0.003f, 1.0f) : Vector4(0.2f, 0.2f, 0.2f, 1.0f));
+
+            {   // Guess count to the left of the bar, wins inside it
+                Vector2 size = Imgui::GetRenderedTextSize(label, state.font, FontSizes::SMALL);
+                Vector3 topLeft = rect.topLeft + Vector3(-size.x - 10, (barHeight - size.y) / 2, 0);
+                Imgui::RenderText(label, state.font, topLeft, FontSizes::SMALL);
+
+                size = Imgui::GetRenderedTextSize(count, state.font, FontSizes::SMALL);
+                topLeft = rect.topLeft + Vector3(rect.size.x - size.x - 10, (barHeight - size.y) / 2, 0);
+                Imgui::RenderText(count, state.font, topLeft, FontSizes::SMALL);
+            }
+
+            y += barHeight + 4;
+        }
+
+        y += 6;
+    }
+
+    return y;
 }
 
 void OnRender(Application& app)
@@ -176,10 +450,6 @@ void OnRender(Application& app)
 
     Imgui::Begin();
 
-    constexpr s32 rectSize = 100;
-    constexpr s32 startX = 10;
-    constexpr s32 startY = 10;
-
     const Vector4 invalidColor = Vector4(0.5f, 0.0f, 0.0f, 1.0f);
     const Vector4 colors[] = {
         Vector4(0.5f, 0.5f, 0.5f, 1.0f),
@@ -188,78 +458,82 @@ void OnRender(Application& app)
         Vector4(0.003f, 0.71f, 0.003f, 1.0f)
     };
 
+    const MultiBoard& boards = state.boards;
+    const BoardLayout& layout = state.layout;
+    const f32 tileStep = layout.tileSize + layout.tileGap;
+
+    bool typing = boards.status == BoardStatus::PLAYING;
+    bool invalidRow = state.invalidWord || !state.cursor.IsValidPrefix();
+
     {   // Render Rects
-        Imgui::Rect rect;
-        rect.size = Vector2(rectSize);
-        rect.topLeft = Vector3(startX, startY, 0);
+        // Every tile of every board goes out in one call so 32 boards are still a single draw
+        static Imgui::Rect tileRects[maxBoards * maxMultiGuesses * wordLength];
+        static Vector4 tileColors[maxBoards * maxMultiGuesses * wordLength];
+        s32 tileCount = 0;
 
-        for (int y = 0; y < 6; y++)
+        for (s32 b = 0; b < boards.boardCount; b++)
         {
-            const Vector4& defaultColor = (y < state.currentGuessIndex) ? colors[(s32) LetterState::WRONG] : colors[(s32) LetterState::UNTOUCHED];
+            Vector3 boardTopLeft = GetBoardTopLeft(layout, b);
+            s32 filledRows = boards.GetFilledRows(b);
+            bool boardTyping = typing && !boards.IsSolved(b);
 
-            for (int x = 0; x < 5; x++)
+            for (s32 y = 0; y < boards.guessLimit; y++)
             {
-                Vector4 color = defaultColor;
-                s32 flag = 1 << x;
-
-                if (state.invalidWord && y == state.currentGuessIndex)
-                    color = invalidColor;
-                else if (state.placedMasks[y] & flag)
-                    color = colors[(s32) LetterState::PLACED];
-                else if (state.correctMasks[y] & flag)
-                    color = colors[(s32) LetterState::CORRECT];
+                const Vector4& defaultColor = (y < filledRows) ? colors[(s32) LetterState::WRONG] : colors[(s32) LetterState::UNTOUCHED];
 
-                Imgui::RenderRect(rect, color);
-
-                rect.topLeft.x += rectSize + 10;
+                for (s32 x = 0; x < wordLength; x++)
+                {
+                    Vector4 color = defaultColor;
+                    s32 flag = 1 << x;
+
+                    if (boardTyping && invalidRow && y == state.currentGuessIndex)
+                        color = invalidColor;
+                    else if (y < filledRows && (boards.placedMasks[y][b] & flag))
+                        color = colors[(s32) LetterState::PLACED];
+                    else if (y < filledRows && (boards.correctMasks[y][b] & flag))
+                        color = colors[(s32) LetterState::CORRECT];
+
+                    Imgui::Rect& rect = tileRects[tileCount];
+                    rect.topLeft = boardTopLeft + Vector3(x * tileStep, y * tileStep, 0);
+                    rect.size = Vector2(layout.tileSize);
+                    tileColors[tileCount] = color;
+                    tileCount++;
+                }
             }
-
-            rect.topLeft.y += rectSize + 10;
-            rect.topLeft.x = startX;
         }
+
+        Imgui::RenderRects(tileRects, tileColors, tileCount);
     }
 
+    // Letters stop being readable well before the tiles get this small
+    if (layout.tileSize >= 20.0f)
     {   // Render Text
-        Vector3 rectTopLeft = Vector3(startX, startY, 0);
+        const f32 fontSize = FontSizes::LARGE * layout.tileSize / 100.0f;
 
-        // Render previous guesses
-        for (int g = 0; g < state.currentGuessIndex; g++)
+        for (s32 b = 0; b < boards.boardCount; b++)
         {
-            for (int i = 0; i < 5; i++)
-            {
-                char ch = state.guesses[g][i];
+            Vector3 boardTopLeft = GetBoardTopLeft(layout, b);
+            s32 filledRows = boards.GetFilledRows(b);
 
-                Vector2 size = Imgui::GetRenderedCharSize(ch, state.font, FontSizes::LARGE);
+            // Previous guesses, and the one being typed if this board is still open
+            s32 rows = (typing && !boards.IsSolved(b)) ? filledRows + 1 : filledRows;
 
-                Vector3 topLeft = rectTopLeft;
-                topLeft.x += ((rectSize - size.x) / 2);
-                topLeft.y += ((rectSize - size.y) / 2);
-                
-                Imgui::RenderChar(ch, state.font, topLeft, FontSizes::LARGE);
-
-                rectTopLeft.x += rectSize + 10;
-            }
-
-            rectTopLeft.y += rectSize + 10;
-            rectTopLeft.x = startX;
-        }
-
-        // Render current guess
-        if (state.currentGuessIndex < 6)
-        {
-            for (int i = 0; i < state.filled; i++)
+            for (s32 y = 0; y < rows; y++)
             {
-                char ch = state.guesses[state.currentGuessIndex][i];
+                s32 letters = (y < filledRows) ? wordLength : state.filled;
 
-                Vector2 size = Imgui::GetRenderedCharSize(ch, state.font, FontSizes::LARGE);
+                for (s32 x = 0; x < letters; x++)
+                {
+                    char ch = state.guesses[y][x];
 
-                Vector3 topLeft = rectTopLeft;
-                topLeft.x += ((rectSize - size.x) / 2);
-                topLeft.y += ((rectSize - size.y) / 2);
-                
-                Imgui::RenderChar(ch, state.font, topLeft, FontSizes::LARGE);
+                    Vector2 size = Imgui::GetRenderedCharSize(ch, state.font, fontSize);
 
-                rectTopLeft.x += rectSize + 10;
+                    Vector3 topLeft = boardTopLeft + Vector3(x * tileStep, y * tileStep, 0);
+                    topLeft.x += ((layout.tileSize - size.x) / 2);
+                    topLeft.y += ((layout.tileSize - size.y) / 2);
+
+                    Imgui::RenderChar(ch, state.font, topLeft, fontSize);
+                }
             }
         }
     }
@@ -351,14 +625,129 @@ void OnRender(Application& app)
         }
     }
 
-    // Render answer if player is out of guesses but hasn't guess the correct word yet
-    if (state.currentGuessIndex >= 6 && state.correctMasks[5] != correctWordMask)
+    {   // Mode Button
+        StringView text = (state.mode == GameMode::ABSURDLE) ? "ABSURDLE" : "CLASSIC";
+        Vector2 size = Imgui::GetRenderedTextSize(text, state.font, FontSizes::SMALL);
+
+        Imgui::Rect rect;
+
+        {   // Button Background
+            rect.size = size + Vector2(50, 20);
+            rect.topLeft = Vector3((1618 - rect.size.x) / 2, 475 - 3 * (rect.size.y + 20), 0);
+
+            // Absurdle is always played on one board
+            if (Imgui::RenderButton(GenImguiID(), rect, colors[0], colors[0] + Vector4(0.25f, 0.25f, 0.25f, 0.0f), colors[0]))
+            {
+                // Recorded now so the old game keeps its own mode
+                RecordGame(state);
+
+                state.mode = (state.mode == GameMode::ABSURDLE) ? GameMode::CLASSIC : GameMode::ABSURDLE;
+                state.boardCount = 1;
+                ResetGame(state);
+            }
+        }
+
+        {   // Button Text
+            Vector3 topLeft = rect.topLeft;
+            topLeft.x += ((rect.size.x - size.x) / 2);
+            topLeft.y += ((rect.size.y - size.y) / 2);
+            Imgui::RenderText(text, state.font, topLeft, FontSizes::SMALL);
+        }
+    }
+
+    if (state.mode == GameMode::CLASSIC)
+    {   // Board Count Button
+        char text[32];
+        sprintf(text, "BOARDS %d", state.boardCount);
+
+        Vector2 size = Imgui::GetRenderedTextSize(text, state.font, FontSizes::SMALL);
+
+        Imgui::Rect rect;
+
+        {   // Button Background
+            rect.size = size + Vector2(50, 20);
+            rect.topLeft = Vector3((1618 - rect.size.x) / 2, 475 - 2 * (rect.size.y + 20), 0);
+
+            // Cycles through the options and starts a new game
+            if (Imgui::RenderButton(GenImguiID(), rect, colors[0], colors[0] + Vector4(0.25f, 0.25f, 0.25f, 0.0f), colors[0]))
+            {
+                s32 option = 0;
+                while (boardCountOptions[option] != state.boardCount)
+                    option++;
+
+                state.boardCount = boardCountOptions[(option + 1) % boardCountOptionCount];
+                ResetGame(state);
+            }
+        }
+
+        {   // Button Text
+            Vector3 topLeft = rect.topLeft;
+            topLeft.x += ((rect.size.x - size.x) / 2);
+            topLeft.y += ((rect.size.y - size.y) / 2);
+            Imgui::RenderText(text, state.font, topLeft, FontSizes::SMALL);
+        }
+    }
+
+    if (state.mode == GameMode::CLASSIC && state.boardCount == 1)
+    {   // Hint Button
+        StringView text = "HINT";
+        Vector2 size = Imgui::GetRenderedTextSize(text, state.font, FontSizes::SMALL);
+
+        Imgui::Rect rect;
+
+        {   // Button Background
+            rect.size = size + Vector2(50, 20);
+            rect.topLeft = Vector3((1618 - rect.size.x) / 2, 475 - rect.size.y - 20, 0);
+
+            if (Imgui::RenderButton(GenImguiID(), rect, colors[0], colors[0] + Vector4(0.25f, 0.25f, 0.25f, 0.0f), colors[0]))
+                OnEventCheckInput(app, Key::TAB);
+        }
+
+        {   // Button Text
+            Vector3 topLeft = rect.topLeft;
+            topLeft.x += ((rect.size.x - size.x) / 2);
+            topLeft.y += ((rect.size.y - size.y) / 2);
+            Imgui::RenderText(text, state.font, topLeft, FontSizes::SMALL);
+        }
+    }
+
+    // Render answers if player is out of guesses but hasn't guessed every word yet
+    if (state.boards.status == BoardStatus::LOST)
     {
         s32 y = 10;
 
         {   // Game Finished Toast!
             char buffer[256];
-            sprintf(buffer, "The word was: %s", wordList[state.wordIndex]);
+            if (state.mode == GameMode::ABSURDLE && state.absurdle.candidateCount > 1)
+            {
+                sprintf(buffer, "%d words were left, like %s", state.absurdle.candidateCount, wordList[state.boards.answerIndices[0]]);
+            }
+            else if (state.boardCount == 1)
+            {
+                sprintf(buffer, "The word was: %s", wordList[state.boards.answerIndices[0]]);
+            }
+            else
+            {
+                // Only the first few missed words fit on screen
+                constexpr s32 maxListed = 4;
+
+                s32 length = sprintf(buffer, "Missed:");
+                s32 missed = 0;
+
+                for (s32 b = 0; b < state.boardCount; b++)
+                {
+                    if (state.boards.IsSolved(b))
+                        continue;
+
+                    if (missed < maxListed)
+                        length += sprintf(buffer + length, " %s", wordList[state.boards.answerIndices[b]]);
+
+                    missed++;
+                }
+
+                if (missed > maxListed)
+                    sprintf(buffer + length, " and %d more", missed - maxListed);
+            }
 
             Vector2 size = Imgui::GetRenderedTextSize(buffer, state.font, FontSizes::SMALL);
             Imgui::Rect rect;
@@ -401,10 +790,12 @@ void OnRender(Application& app)
 
             y += rect.size.y + 10;
         }
+
+        y = RenderStats(state, y);
     }
 
     // Show a celebration text if the player has guessed the correct word
-    if (state.correctMasks[state.currentGuessIndex] == correctWordMask)
+    if (state.boards.status == BoardStatus::WON)
     {
         s32 y = 10;
 
@@ -452,6 +843,34 @@ void OnRender(Application& app)
 
             y += rect.size.y + 10;
         }
+
+        y = RenderStats(state, y);
+    }
+
+    // Show the suggested guess unless another toast is already up
+    if (state.showHint && !state.invalidWord && state.boards.status == BoardStatus::PLAYING)
+    {
+        char buffer[256];
+        if (state.solverMove >= 0)
+            sprintf(buffer, "Solver plays %.5s (%d left)", wordList[state.solverMove], state.board.candidates.Count());
+        else
+            sprintf(buffer, "Try %.5s (%.2f bits, %d left)", wordList[state.hint.guessIndex], state.hint.bits, state.hint.candidateCount);
+
+        Vector2 size = Imgui::GetRenderedTextSize(buffer, state.font, FontSizes::SMALL);
+        Imgui::Rect rect;
+
+        {   // Render Background
+            rect.size = size + Vector2(50, 20);
+            rect.topLeft = Vector3((1618 - rect.size.x) / 2, 10, 0);
+            Imgui::RenderRect(rect, Vector4(1));
+        }
+
+        {   // Render Text
+            Vector3 topLeft = rect.topLeft;
+            topLeft.x += 25;
+            topLeft.y += 10;
+            Imgui::RenderText(buffer, state.font, topLeft, FontSizes::SMALL, Vector4(0.3f, 0.3f, 0.3f, 1.0f));
+        }
     }
 
     // Show a toast for invalid words
@@ -492,4 +911,5 @@ void CreateApp(Application& app)
 
     app.OnInit = OnInit;
     app.OnRender = OnRender;
+    app.OnShutdown = OnShutdown;
 }
\ No newline at end of file
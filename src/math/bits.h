@@ -0,0 +1,59 @@
+#pragma once
+
+#include "core/types.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Bit Manipulation Functions
+
+// Index of the lowest set bit (x must not be 0)
+inline s32 CountTrailingZeros(u32 x)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, x);
+    return (s32) index;
+#endif
+
+#ifdef __GNUC__
+    return __builtin_ctz(x);
+#endif
+}
+
+// Index of the lowest set bit (x must not be 0)
+inline s32 CountTrailingZeros(u64 x)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (s32) index;
+#endif
+
+#ifdef __GNUC__
+    return __builtin_ctzll(x);
+#endif
+}
+
+inline s32 PopCount(u32 x)
+{
+#ifdef _MSC_VER
+    return (s32) __popcnt(x);
+#endif
+
+#ifdef __GNUC__
+    return __builtin_popcount(x);
+#endif
+}
+
+inline s32 PopCount(u64 x)
+{
+#ifdef _MSC_VER
+    return (s32) __popcnt64(x);
+#endif
+
+#ifdef __GNUC__
+    return __builtin_popcountll(x);
+#endif
+}
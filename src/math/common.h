@@ -3,6 +3,7 @@
 #include <cmath>
 #include <ctime>
 #include "core/types.h"
+#include "random.h"
 
 template<typename T>
 inline T Abs(const T& a)
@@ -72,10 +73,10 @@ inline f32 Ceil(f32 x)
 
 // Extra Functions
 
-// Gives a random float in the range [0, 1)
+// Gives a random float in the range [0, 1) from the calling thread's default stream
 inline f32 Random()
 {
-    return rand() / (f32) RAND_MAX;
+    return RandomF32(GetThreadRandomState());
 }
 
 // TODO: Add more functions as needed...
@@ -0,0 +1,293 @@
+#include "random.h"
+
+#include "core/types.h"
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+
+#include <emmintrin.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace Math
+{
+
+static inline u64 RotateLeft(u64 x, s32 k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline u64 SplitMix64(u64& x)
+{
+    u64 z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+RandomState SeedRandom(u64 seed)
+{
+    RandomState state;
+    for (s32 i = 0; i < 4; i++)
+        state.s[i] = SplitMix64(seed);
+
+    return state;
+}
+
+u64 RandomU64(RandomState& state)
+{
+    u64* s = state.s;
+
+    u64 result = RotateLeft(s[1] * 5, 7) * 9;
+    u64 t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+
+    s[2] ^= t;
+    s[3] = RotateLeft(s[3], 45);
+
+    return result;
+}
+
+void JumpRandom(RandomState& state)
+{
+    static constexpr u64 jump[] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+
+    u64 s[4] = {};
+    for (s32 i = 0; i < 4; i++)
+    {
+        for (s32 b = 0; b < 64; b++)
+        {
+            if (jump[i] & (1ull << b))
+            {
+                s[0] ^= state.s[0];
+                s[1] ^= state.s[1];
+                s[2] ^= state.s[2];
+                s[3] ^= state.s[3];
+            }
+
+            RandomU64(state);
+        }
+    }
+
+    for (s32 i = 0; i < 4; i++)
+        state.s[i] = s[i];
+}
+
+u32 RandomBounded(RandomState& state, u32 bound)
+{
+    // Lemire's multiply and reject, only loops for the few values that would make some results more likely
+    u64 product = (u64) RandomU32(state) * bound;
+    u32 low = (u32) product;
+
+    if (low < bound)
+    {
+        u32 threshold = (0u - bound) % bound;
+        while (low < threshold)
+        {
+            product = (u64) RandomU32(state) * bound;
+            low = (u32) product;
+        }
+    }
+
+    return (u32) (product >> 32);
+}
+
+void SeedRandomBulk(RandomBulkState& state, u64 seed)
+{
+    for (s32 lane = 0; lane < randomBulkLanes; lane++)
+    {
+        u64 a = SplitMix64(seed);
+        u64 b = SplitMix64(seed);
+
+        state.s[0][lane] = (u32) a;
+        state.s[1][lane] = (u32) (a >> 32);
+        state.s[2][lane] = (u32) b;
+        state.s[3][lane] = (u32) (b >> 32) | 1;     // Never all zeros
+    }
+}
+
+// One xoshiro128** step on every lane
+#ifdef __AVX2__
+
+static inline __m256i RotateLeft32(__m256i x, s32 k)
+{
+    return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+}
+
+static inline __m256i NextBulk(__m256i s[4])
+{
+    // x * 5 and x * 9 as shifts and adds, there's no cheap 32 bit multiply before SSE4.1
+    __m256i times5 = _mm256_add_epi32(_mm256_slli_epi32(s[1], 2), s[1]);
+    __m256i rotated = RotateLeft32(times5, 7);
+    __m256i result = _mm256_add_epi32(_mm256_slli_epi32(rotated, 3), rotated);
+
+    __m256i t = _mm256_slli_epi32(s[1], 9);
+
+    s[2] = _mm256_xor_si256(s[2], s[0]);
+    s[3] = _mm256_xor_si256(s[3], s[1]);
+    s[1] = _mm256_xor_si256(s[1], s[2]);
+    s[0] = _mm256_xor_si256(s[0], s[3]);
+
+    s[2] = _mm256_xor_si256(s[2], t);
+    s[3] = RotateLeft32(s[3], 11);
+
+    return result;
+}
+
+#else
+
+static inline __m128i RotateLeft32(__m128i x, s32 k)
+{
+    return _mm_or_si128(_mm_slli_epi32(x, k), _mm_srli_epi32(x, 32 - k));
+}
+
+static inline __m128i NextBulk(__m128i s[4])
+{
+    // x * 5 and x * 9 as shifts and adds, there's no 32 bit multiply in SSE2
+    __m128i times5 = _mm_add_epi32(_mm_slli_epi32(s[1], 2), s[1]);
+    __m128i rotated = RotateLeft32(times5, 7);
+    __m128i result = _mm_add_epi32(_mm_slli_epi32(rotated, 3), rotated);
+
+    __m128i t = _mm_slli_epi32(s[1], 9);
+
+    s[2] = _mm_xor_si128(s[2], s[0]);
+    s[3] = _mm_xor_si128(s[3], s[1]);
+    s[1] = _mm_xor_si128(s[1], s[2]);
+    s[0] = _mm_xor_si128(s[0], s[3]);
+
+    s[2] = _mm_xor_si128(s[2], t);
+    s[3] = RotateLeft32(s[3], 11);
+
+    return result;
+}
+
+#endif
+
+// Writes count / randomBulkLanes full rows of random u32s, returns how many were written
+static s32 FillBulkRows(RandomBulkState& state, u32* out, s32 count)
+{
+    s32 rows = count / randomBulkLanes;
+
+#ifdef __AVX2__
+    __m256i s[4];
+    for (s32 i = 0; i < 4; i++)
+        s[i] = _mm256_load_si256((const __m256i*) state.s[i]);
+
+    for (s32 r = 0; r < rows; r++)
+        _mm256_storeu_si256((__m256i*) (out + r * randomBulkLanes), NextBulk(s));
+
+    for (s32 i = 0; i < 4; i++)
+        _mm256_store_si256((__m256i*) state.s[i], s[i]);
+#else
+    // Lanes are independent, so doing 4 at a time gives the same output as AVX2
+    for (s32 half = 0; half < 2; half++)
+    {
+        __m128i s[4];
+        for (s32 i = 0; i < 4; i++)
+            s[i] = _mm_load_si128((const __m128i*) (state.s[i] + half * 4));
+
+        for (s32 r = 0; r < rows; r++)
+            _mm_storeu_si128((__m128i*) (out + r * randomBulkLanes + half * 4), NextBulk(s));
+
+        for (s32 i = 0; i < 4; i++)
+            _mm_store_si128((__m128i*) (state.s[i] + half * 4), s[i]);
+    }
+#endif
+
+    return rows * randomBulkLanes;
+}
+
+void FillRandomU32(RandomBulkState& state, u32* out, s32 count)
+{
+    s32 written = FillBulkRows(state, out, count);
+
+    if (written < count)
+    {
+        u32 tail[randomBulkLanes];
+        FillBulkRows(state, tail, randomBulkLanes);
+
+        for (s32 i = written; i < count; i++)
+            out[i] = tail[i - written];
+    }
+}
+
+void FillRandomF32(RandomBulkState& state, f32* out, s32 count)
+{
+    // Generated in place, then the top 24 bits of each become the float
+    FillRandomU32(state, (u32*) out, count);
+
+    u32* bits = (u32*) out;
+    s32 i = 0;
+
+#ifdef __AVX2__
+    const __m256 scale8 = _mm256_set1_ps(1.0f / 16777216.0f);
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256i v = _mm256_srli_epi32(_mm256_loadu_si256((const __m256i*) (bits + i)), 8);
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(v), scale8));
+    }
+#endif
+
+    const __m128 scale4 = _mm_set1_ps(1.0f / 16777216.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128i v = _mm_srli_epi32(_mm_loadu_si128((const __m128i*) (bits + i)), 8);
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(v), scale4));
+    }
+
+    for (; i < count; i++)
+        out[i] = (bits[i] >> 8) * (1.0f / 16777216.0f);
+}
+
+u64 GetDailySeed(s32 dayOffset)
+{
+    s64 day = (s64) time(nullptr) / (24 * 60 * 60) + dayOffset;
+
+    // Mixed so neighbouring days don't give neighbouring seeds
+    u64 seed = (u64) day;
+    return SplitMix64(seed);
+}
+
+u64 GetTimeSeed()
+{
+    u64 seed = (u64) std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    return SplitMix64(seed);
+}
+
+static std::atomic<u64> defaultSeed { 0x5EED5EED5EED5EEDull };
+static std::atomic<u64> nextStream { 1 };      // Stream 0 is the thread that set the seed
+
+static thread_local struct
+{
+    RandomState state;
+    bool seeded = false;
+} threadRandom;
+
+RandomState& GetThreadRandomState()
+{
+    if (!threadRandom.seeded)
+    {
+        u64 seed = defaultSeed.load() ^ (nextStream.fetch_add(1) * 0xD1B54A32D192ED03ull);
+        threadRandom.state = SeedRandom(seed);
+        threadRandom.seeded = true;
+    }
+
+    return threadRandom.state;
+}
+
+void SetDefaultRandomSeed(u64 seed)
+{
+    defaultSeed.store(seed);
+    nextStream.store(1);
+
+    threadRandom.state = SeedRandom(seed);
+    threadRandom.seeded = true;
+}
+
+} // namespace Math
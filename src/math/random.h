@@ -0,0 +1,84 @@
+#pragma once
+
+/*
+
+Random Numbers.
+
+Seedable generators with explicit state, so every thread, simulation or
+game can own a reproducible stream instead of sharing the CRT's rand().
+
+    - RandomState is xoshiro256** (64 bit outputs, period 2^256 - 1)
+    - RandomBulkState runs 8 xoshiro128** streams side by side, and is
+      what the Fill functions use to write big buffers with SSE2 / AVX2
+
+Seeds are expanded with SplitMix64, so any u64 (including 0) is fine.
+
+*/
+
+#include "core/types.h"
+
+namespace Math
+{
+
+struct RandomState
+{
+    u64 s[4];
+};
+
+constexpr s32 randomBulkLanes = 8;
+
+struct alignas(32) RandomBulkState
+{
+    u32 s[4][randomBulkLanes];      // s[word][lane]
+};
+
+RandomState SeedRandom(u64 seed);
+
+// Advances the state by 2^128 steps. Jumping copies of one state gives
+// non overlapping streams, e.g. one per thread.
+void JumpRandom(RandomState& state);
+
+u64 RandomU64(RandomState& state);
+
+inline u32 RandomU32(RandomState& state)
+{
+    // High bits are the strongest
+    return (u32) (RandomU64(state) >> 32);
+}
+
+// Uniform in [0, 1)
+inline f32 RandomF32(RandomState& state)
+{
+    return (RandomU64(state) >> 40) * (1.0f / 16777216.0f);
+}
+
+// Uniform in [0, bound), without the bias of a plain modulo. bound has to be > 0.
+u32 RandomBounded(RandomState& state, u32 bound);
+
+// Uniform in [min, max)
+inline s32 RandomRange(RandomState& state, s32 min, s32 max)
+{
+    return min + (s32) RandomBounded(state, (u32) (max - min));
+}
+
+void SeedRandomBulk(RandomBulkState& state, u64 seed);
+
+void FillRandomU32(RandomBulkState& state, u32* out, s32 count);
+
+// Uniform in [0, 1)
+void FillRandomF32(RandomBulkState& state, f32* out, s32 count);
+
+// Same seed for everyone on the same UTC day. dayOffset picks an earlier or later day.
+u64 GetDailySeed(s32 dayOffset = 0);
+
+// Seed from the clock, different every run
+u64 GetTimeSeed();
+
+// Each thread has its own default state, used by Math::Random().
+// Threads start from streams derived from SetDefaultRandomSeed's seed.
+RandomState& GetThreadRandomState();
+
+// Reseeds the calling thread's default state, and the streams of threads that haven't used theirs yet
+void SetDefaultRandomSeed(u64 seed);
+
+} // namespace Math
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdio>
+
 #include "core/types.h"
 
 struct InternalState;   // Defined based on the OS
@@ -20,9 +22,37 @@ void* PlatformAllocate(u64 size);                   // TODO: Option for aligned
 void* PlatformReallocate(void* block, u64 size);    // TODO: Option for aligned memory
 void  PlatformFree(void* block);                    // TODO: Option for aligned memory
 
+#ifdef GN_TRACK_ALLOCATIONS
+// Allocations and reallocations made since startup, so benchmarks can catch hot paths that allocate
+u64 PlatformGetAllocationCount();
+#endif
+
 void* PlatformZeroMemory(void* block, u64 size);
 void* PlatformCopyMemory(void* dest, const void* source, u64 size);
 void* PlatformSetMemory(void* dest, s32 value, u64 size);
 
+// File Mapping
+
+struct PlatformMappedFile
+{
+    const void* data = nullptr;
+    u64 size = 0;
+
+    void* handle = nullptr;     // OS specific
+};
+
+// Maps the whole file read only. Returns false if it doesn't exist or is empty.
+bool PlatformMapFile(const char* filepath, PlatformMappedFile& file);
+void PlatformUnmapFile(PlatformMappedFile& file);
+
+// File Offsets
+
+// fseek and ftell with 64 bit offsets, long is only 32 bits on Windows
+bool PlatformSeekFile(FILE* file, s64 offset, s32 origin);
+s64  PlatformTellFile(FILE* file);          // -1 on failure
+
 // In Seconds
-f64 PlatformGetTime();
\ No newline at end of file
+f64 PlatformGetTime();
+
+// CPU time the calling thread has used, in seconds
+f64 PlatformGetThreadCpuTime();
\ No newline at end of file
@@ -0,0 +1,152 @@
+#include "platform.h"
+
+#ifdef GN_PLATFORM_LINUX
+
+// Headless platform layer. There is no window or graphics backend on Linux yet,
+// this is only here so tools and simulators can run without Win32.
+
+#include "core/types.h"
+#include "core/logging.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static f64 ReadMonotonicClock()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (f64) now.tv_sec + (f64) now.tv_nsec * 1e-9;
+}
+
+// Clock Stuff
+static const f64 startTime = ReadMonotonicClock();
+
+bool PlatformWindowStartup(PlatformState& pstate, const char* windowName, int x, int y, int width, int height, const char* iconPath)
+{
+    fprintf(stderr, "Windows aren't supported on Linux yet, only headless tools can run.\n");
+    return false;
+}
+
+void PlatformWindowShutdown(PlatformState& pstate)
+{
+}
+
+bool PlatformPumpMessages()
+{
+    return true;
+}
+
+#ifdef GN_TRACK_ALLOCATIONS
+static std::atomic<u64> allocationCount { 0 };
+
+u64 PlatformGetAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+#endif
+
+void* PlatformAllocate(u64 size)
+{
+#ifdef GN_TRACK_ALLOCATIONS
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+    return malloc(size);
+}
+
+void* PlatformReallocate(void* block, u64 size)
+{
+#ifdef GN_TRACK_ALLOCATIONS
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+
+    return realloc(block, size);
+}
+
+void PlatformFree(void* block)
+{
+    free(block);
+}
+
+void* PlatformZeroMemory(void* block, u64 size)
+{
+    return memset(block, 0, size);
+}
+
+void* PlatformCopyMemory(void* dest, const void* source, u64 size)
+{
+    return memcpy(dest, source, size);
+}
+
+void* PlatformSetMemory(void* block, s32 value, u64 size)
+{
+    return memset(block, value, size);
+}
+
+bool PlatformMapFile(const char* filepath, PlatformMappedFile& file)
+{
+    int fd = open(filepath, O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size == 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    void* data = mmap(nullptr, (size_t) info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);  // The mapping keeps the file open
+
+    if (data == MAP_FAILED)
+        return false;
+
+    file.data = data;
+    file.size = (u64) info.st_size;
+    file.handle = nullptr;
+
+    return true;
+}
+
+void PlatformUnmapFile(PlatformMappedFile& file)
+{
+    if (!file.data)
+        return;
+
+    munmap((void*) file.data, (size_t) file.size);
+
+    file.data = nullptr;
+    file.size = 0;
+}
+
+bool PlatformSeekFile(FILE* file, s64 offset, s32 origin)
+{
+    return fseeko(file, (off_t) offset, origin) == 0;
+}
+
+s64 PlatformTellFile(FILE* file)
+{
+    return (s64) ftello(file);
+}
+
+f64 PlatformGetTime()
+{
+    return ReadMonotonicClock() - startTime;
+}
+
+f64 PlatformGetThreadCpuTime()
+{
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return (f64) now.tv_sec + (f64) now.tv_nsec * 1e-9;
+}
+
+#endif // GN_PLATFORM_LINUX
@@ -13,6 +13,9 @@
 #include <windows.h>
 #include <windowsx.h>   // For param input extraction
 
+#include <atomic>
+#include <cstdio>
+
 // Clock Stuff
 static f64 clockFrequency;
 static LARGE_INTEGER startTime;
@@ -122,13 +125,30 @@ bool PlatformPumpMessages()
     return true;
 }
 
+#ifdef GN_TRACK_ALLOCATIONS
+static std::atomic<u64> allocationCount { 0 };
+
+u64 PlatformGetAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+#endif
+
 void* PlatformAllocate(u64 size)
 {
+#ifdef GN_TRACK_ALLOCATIONS
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+
     return malloc(size);
 }
 
 void* PlatformReallocate(void* block, u64 size)
 {
+#ifdef GN_TRACK_ALLOCATIONS
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+#endif
+
     return realloc(block, size);
 }
 
@@ -152,6 +172,62 @@ void* PlatformSetMemory(void* block, s32 value, u64 size)
     return memset(block, value, size);
 }
 
+bool PlatformMapFile(const char* filepath, PlatformMappedFile& file)
+{
+    HANDLE fileHandle = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(fileHandle, 0, PAGE_READONLY, 0, 0, 0);
+    CloseHandle(fileHandle);    // The mapping keeps the file open
+
+    if (!mapping)
+        return false;
+
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    file.data = data;
+    file.size = (u64) size.QuadPart;
+    file.handle = (void*) mapping;
+
+    return true;
+}
+
+void PlatformUnmapFile(PlatformMappedFile& file)
+{
+    if (!file.data)
+        return;
+
+    UnmapViewOfFile(file.data);
+    CloseHandle((HANDLE) file.handle);
+
+    file.data = nullptr;
+    file.size = 0;
+    file.handle = nullptr;
+}
+
+bool PlatformSeekFile(FILE* file, s64 offset, s32 origin)
+{
+    return _fseeki64(file, offset, origin) == 0;
+}
+
+s64 PlatformTellFile(FILE* file)
+{
+    return _ftelli64(file);
+}
+
 f64 PlatformGetTime()
 {
     LARGE_INTEGER nowTime;
@@ -159,6 +235,17 @@ f64 PlatformGetTime()
     return (f64) (nowTime.QuadPart - startTime.QuadPart) * clockFrequency; 
 }
 
+f64 PlatformGetThreadCpuTime()
+{
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime);
+
+    // Both are in 100 ns ticks
+    u64 kernel = ((u64) kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime;
+    u64 user = ((u64) userTime.dwHighDateTime << 32) | userTime.dwLowDateTime;
+    return (f64) (kernel + user) * 1e-7;
+}
+
 LRESULT CALLBACK Win32ProcessMessage(HWND hwnd, u32 msg, WPARAM wParam, LPARAM lParam)
 {
     PlatformState* pstate = (PlatformState*) GetWindowLongPtrA(hwnd, GWLP_USERDATA);
@@ -3,7 +3,7 @@
 #include "core/types.h"
 #include "containers/stringview.h"
 #include "containers/darray.h"
-#include "containers/hashtable.h"
+#include "containers/orderedtable.h"
 #include "platform/platform.h"
 
 namespace json
@@ -11,7 +11,7 @@ namespace json
 
 using ResourceIndex = u64;
 using ArrayNode = DynamicArray<ResourceIndex>;
-using ObjectNode = HashTable<String, ResourceIndex>;
+using ObjectNode = OrderedTable<String, ResourceIndex>;
 
 struct Resource
 {
@@ -112,7 +112,7 @@ struct DependencyNode
                 break;
             
             case Type::OBJECT:
-                _object.~HashTable();
+                _object.~OrderedTable();
                 break;
         }
     }
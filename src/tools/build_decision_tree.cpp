@@ -0,0 +1,97 @@
+// Searches for a decision tree that solves every answer and writes it where the game maps it from.
+//
+// Usage: build_decision_tree [options] [output path]
+//
+//   --breadth N      Guesses tried at each node (default 20), 0 tries all of them (very slow)
+//   --opening WORD   Forces the first guess instead of searching for it
+//   --memo-bits N    The memo gets 2^N entries of 16 bytes (default 22)
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/board.h"
+#include "game/packed_word.h"
+#include "game/feedback_matrix.h"
+#include "game/tree_builder.h"
+#include "game/word_index.h"
+#include "game/wordlist.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = "assets/decision_tree.bin";
+    const char* opening = nullptr;
+    TreeBuilder::Settings settings;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--breadth") == 0 && i + 1 < argc)
+            settings.breadth = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--opening") == 0 && i + 1 < argc)
+            opening = argv[++i];
+        else if (strcmp(argv[i], "--memo-bits") == 0 && i + 1 < argc)
+            settings.memoBits = atoi(argv[++i]);
+        else
+            outputPath = argv[i];
+    }
+
+    Jobs::Init();
+    WordIndex::Build();
+
+    if (opening)
+    {
+        settings.openingGuess = -1;
+
+        // Only copied once it's known to be long enough
+        if (strlen(opening) == 5)
+        {
+            char word[5];
+            for (s32 i = 0; i < 5; i++)
+                word[i] = (opening[i] >= 'a' && opening[i] <= 'z') ? opening[i] - 'a' + 'A' : opening[i];
+
+            settings.openingGuess = WordIndex::Find(word);
+        }
+
+        if (settings.openingGuess < 0)
+        {
+            fprintf(stderr, "'%s' is not in the word list\n", opening);
+            return 1;
+        }
+    }
+
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+    {
+        printf("No feedback matrix at %s, building it...\n", FeedbackMatrix::defaultPath);
+        FeedbackMatrix::Build();
+    }
+
+    TreeBuilder::Results results = TreeBuilder::Build(settings);
+
+    if (!results.solved)
+    {
+        fprintf(stderr, "No tree solves every answer in %d guesses with breadth %d\n", maxGuesses, settings.breadth);
+        return 1;
+    }
+
+    printf("Opening:  %.5s\n", wordList[results.openingGuess]);
+    printf("Guesses:  %u total, %.4f average, %u at most\n",
+           results.totalGuesses, (f64) results.totalGuesses / answersEnd, results.maxDepth);
+    printf("Tree:     %u nodes\n", results.nodeCount);
+    printf("Search:   %llu nodes, %llu memo hits, %.3f s on %d threads\n",
+           (unsigned long long) results.nodesSearched, (unsigned long long) results.memoHits,
+           results.seconds, Jobs::GetThreadCount());
+
+    bool saved = TreeBuilder::Save(outputPath);
+    if (saved)
+        printf("Wrote %s\n", outputPath);
+    else
+        fprintf(stderr, "Failed to write %s\n", outputPath);
+
+    TreeBuilder::Free();
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return saved ? 0 : 1;
+}
@@ -0,0 +1,38 @@
+// Builds the guess x answer feedback matrix and writes it where the game maps it from.
+//
+// Usage: build_feedback_matrix [output path]
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/packed_word.h"
+#include "game/feedback_matrix.h"
+
+#include <chrono>
+#include <cstdio>
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = (argc > 1) ? argv[1] : FeedbackMatrix::defaultPath;
+
+    Jobs::Init();
+    BuildPackedWordList();
+
+    auto start = std::chrono::steady_clock::now();
+    FeedbackMatrix::Build();
+    auto end = std::chrono::steady_clock::now();
+
+    f64 seconds = std::chrono::duration<f64>(end - start).count();
+    printf("Scored %d x %d pairs on %d threads in %.3f s\n",
+           FeedbackMatrix::guessCount, FeedbackMatrix::answerCount, Jobs::GetThreadCount(), seconds);
+
+    bool saved = FeedbackMatrix::Save(outputPath);
+    if (saved)
+        printf("Wrote %s\n", outputPath);
+    else
+        fprintf(stderr, "Failed to write %s\n", outputPath);
+
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return saved ? 0 : 1;
+}
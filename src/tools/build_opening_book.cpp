@@ -0,0 +1,217 @@
+// Works out the entropy hint for the first two guesses and writes the opening book
+// where the game maps it from.
+//
+// Usage: build_opening_book [--threads N] [--output path] [opener ...]
+//
+// The book always covers the best opening guess. Openers listed on the command
+// line are covered too, and without any a set of popular ones is used. The
+// feedback codes of each opener are split across the worker pool.
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/candidates.h"
+#include "game/feedback_matrix.h"
+#include "game/hints.h"
+#include "game/opening_book.h"
+#include "game/packed_word.h"
+#include "game/scoring.h"
+#include "game/word_index.h"
+#include "game/wordlist.h"
+#include "platform/platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static const char* popularOpeners[] = {
+    "SALET", "CRANE", "SLATE", "TRACE", "CRATE", "CARET", "ROATE",
+    "RAISE", "ARISE", "STARE", "ADIEU", "AUDIO", "SOARE", "IRATE",
+};
+
+static constexpr s32 maxOpeners = 64;
+
+struct alignas(64) ThreadScratch
+{
+    Hints::Scratch hints;
+};
+
+static struct
+{
+    s32 opener;
+    ThreadScratch* scratch;                                 // One per thread
+
+    OpeningBook::Entry results[Scoring::feedbackCount];     // Indexed by feedback
+    bool filled[Scoring::feedbackCount];
+} job;
+
+static void SolveFeedback(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    Hints::Scratch& scratch = job.scratch[threadIndex].hints;
+
+    for (s32 f = begin; f < end; f++)
+    {
+        job.filled[f] = false;
+
+        // All correct ends the game, there's nothing to follow up with
+        if (f == Scoring::allCorrectFeedback)
+            continue;
+
+        CandidateSet candidates;
+        candidates.Reset();
+        candidates.Apply(packedWordList[job.opener], (Scoring::Feedback) f);
+
+        // Two candidates or fewer are trivial for Hints, and impossible feedback has nothing to hint
+        if (candidates.Count() <= 2)
+            continue;
+
+        Hints::Hint hint = Hints::FindBestGuess(candidates, scratch);
+
+        OpeningBook::Entry& entry = job.results[f];
+        entry.key = OpeningBook::MakeKey(job.opener, (Scoring::Feedback) f);
+        entry.guess = (u16) hint.guessIndex;
+        entry.candidateCount = (u16) hint.candidateCount;
+        entry.bits = hint.bits;
+
+        job.filled[f] = true;
+    }
+}
+
+static s32 FindOpener(const char* text)
+{
+    if (strlen(text) != 5)
+        return -1;
+
+    char word[5];
+    for (s32 i = 0; i < 5; i++)
+        word[i] = (text[i] >= 'a' && text[i] <= 'z') ? text[i] - 'a' + 'A' : text[i];
+
+    return WordIndex::Find(word);
+}
+
+static void AddOpener(s32* openers, s32& openerCount, s32 opener)
+{
+    for (s32 i = 0; i < openerCount; i++)
+    {
+        if (openers[i] == opener)
+            return;
+    }
+
+    if (openerCount < maxOpeners)
+        openers[openerCount++] = opener;
+}
+
+int main(int argc, char** argv)
+{
+    const char* outputPath = OpeningBook::defaultPath;
+    s32 threadCount = 0;
+
+    const char* names[maxOpeners];
+    s32 nameCount = 0;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threadCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--output") == 0 && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (nameCount < maxOpeners)
+            names[nameCount++] = argv[i];
+    }
+
+    if (nameCount == 0)
+    {
+        for (const char* name : popularOpeners)
+            names[nameCount++] = name;
+    }
+
+    Jobs::Init(threadCount);
+    WordIndex::Build();
+    CandidateIndex::Build();
+
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+    {
+        printf("No feedback matrix at %s, building it...\n", FeedbackMatrix::defaultPath);
+        FeedbackMatrix::Build();
+    }
+
+    f64 startTime = PlatformGetTime();
+
+    // The best opener is the one hint every game asks for
+    CandidateSet all;
+    all.Reset();
+    Hints::Hint opening = Hints::GetBestGuess(all);
+
+    s32 openers[maxOpeners];
+    s32 openerCount = 0;
+    AddOpener(openers, openerCount, opening.guessIndex);
+
+    for (s32 i = 0; i < nameCount; i++)
+    {
+        s32 opener = FindOpener(names[i]);
+        if (opener < 0)
+            printf("'%s' is not in the word list, skipping it\n", names[i]);
+        else
+            AddOpener(openers, openerCount, opener);
+    }
+
+    // Entries are sorted by (opener, feedback), so openers go in ascending order
+    for (s32 i = 1; i < openerCount; i++)
+    {
+        s32 opener = openers[i];
+
+        s32 j = i;
+        for (; j > 0 && openers[j - 1] > opener; j--)
+            openers[j] = openers[j - 1];
+
+        openers[j] = opener;
+    }
+
+    s32 threads = Jobs::GetThreadCount();
+    void* scratchBlock = PlatformAllocate(threads * sizeof(ThreadScratch) + alignof(ThreadScratch));
+    u64 aligned = ((u64) scratchBlock + alignof(ThreadScratch) - 1) & ~(u64) (alignof(ThreadScratch) - 1);
+    job.scratch = (ThreadScratch*) aligned;
+
+    OpeningBook::Entry* entries = (OpeningBook::Entry*) PlatformAllocate(openerCount * Scoring::feedbackCount * sizeof(OpeningBook::Entry));
+    u32 entryCount = 0;
+
+    for (s32 i = 0; i < openerCount; i++)
+    {
+        job.opener = openers[i];
+
+        // Big bins take far longer than small ones, so each feedback is its own chunk
+        Jobs::ParallelFor(Scoring::feedbackCount, 1, SolveFeedback, nullptr);
+
+        u32 openerEntries = 0;
+        for (s32 f = 0; f < Scoring::feedbackCount; f++)
+        {
+            if (job.filled[f])
+                entries[entryCount + openerEntries++] = job.results[f];
+        }
+
+        entryCount += openerEntries;
+        printf("%.5s: %u follow ups\n", wordList[job.opener], openerEntries);
+    }
+
+    f64 seconds = PlatformGetTime() - startTime;
+
+    bool saved = OpeningBook::Save(outputPath, entries, entryCount, (u32) openerCount, opening);
+
+    printf("Opening:  %.5s (%.3f bits)\n", wordList[opening.guessIndex], opening.bits);
+    printf("Book:     %d openers, %u entries, %.1f KB\n", openerCount, entryCount,
+           (sizeof(OpeningBook::FileHeader) + entryCount * sizeof(OpeningBook::Entry)) / 1024.0);
+    printf("Time:     %.3f s on %d threads\n", seconds, threads);
+
+    PlatformFree(entries);
+    PlatformFree(scratchBlock);
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    if (!saved)
+    {
+        fprintf(stderr, "Couldn't write %s\n", outputPath);
+        return 1;
+    }
+
+    printf("Wrote %s\n", outputPath);
+    return 0;
+}
@@ -0,0 +1,230 @@
+// Compresses the word lists into the DAWG the game decodes its word list from.
+//
+// Usage: build_word_dawg [answers.txt] [allowed.txt] [output header]
+//
+// Defaults to src/game/words/answers.txt, src/game/words/allowed.txt and
+// src/game/word_dawg_data.h. Run it from the repository root whenever the
+// text lists change, and commit the header it writes.
+
+#include "core/types.h"
+#include "game/word_dawg.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+static bool ReadWords(const char* filepath, std::vector<std::string>& words)
+{
+    FILE* file = fopen(filepath, "r");
+    if (!file)
+        return false;
+
+    char line[256];
+    while (fgets(line, sizeof(line), file))
+    {
+        std::string word;
+        for (s32 i = 0; line[i] && line[i] != '\n' && line[i] != '\r'; i++)
+            word += (line[i] >= 'a' && line[i] <= 'z') ? line[i] - 'a' + 'A' : line[i];
+
+        if (word.empty())
+            continue;
+
+        bool valid = word.size() == WordDawg::wordLength;
+        for (char ch : word)
+            valid = valid && ch >= 'A' && ch <= 'Z';
+
+        if (!valid)
+        {
+            fprintf(stderr, "Skipping '%s' in %s\n", word.c_str(), filepath);
+            continue;
+        }
+
+        words.push_back(word);
+    }
+
+    fclose(file);
+    return true;
+}
+
+struct TrieNode
+{
+    s32 child[26];          // -1 if there's no edge, sinkNode after the last letter
+    bool answer[26];        // Only used on last letter edges
+};
+
+static constexpr s32 sinkNode = -2;
+
+// Edges of a node with children replaced by their minimized ids, which is
+// the same for every node that accepts the same set of suffixes
+using Signature = std::vector<u32>;
+
+struct Builder
+{
+    std::vector<TrieNode> trie;
+    std::map<Signature, s32> registry;      // Signature -> minimized id
+    std::vector<Signature> unique;          // Minimized id -> signature
+
+    s32 Minimize(s32 node)
+    {
+        Signature signature;
+        for (s32 letter = 0; letter < 26; letter++)
+        {
+            s32 child = trie[node].child[letter];
+            if (child == -1)
+                continue;
+
+            u32 childId = (child == sinkNode) ? 0 : (u32) Minimize(child) + 1;
+            signature.push_back((childId << 6) | (trie[node].answer[letter] << 5) | letter);
+        }
+
+        auto found = registry.find(signature);
+        if (found != registry.end())
+            return found->second;
+
+        s32 id = (s32) unique.size();
+        registry[signature] = id;
+        unique.push_back(signature);
+
+        return id;
+    }
+};
+
+int main(int argc, char** argv)
+{
+    const char* answersPath = (argc > 1) ? argv[1] : "src/game/words/answers.txt";
+    const char* allowedPath = (argc > 2) ? argv[2] : "src/game/words/allowed.txt";
+    const char* outputPath  = (argc > 3) ? argv[3] : "src/game/word_dawg_data.h";
+
+    std::vector<std::string> answers, allowed;
+    if (!ReadWords(answersPath, answers) || !ReadWords(allowedPath, allowed))
+    {
+        fprintf(stderr, "Couldn't read %s or %s\n", answersPath, allowedPath);
+        return 1;
+    }
+
+    std::sort(answers.begin(), answers.end());
+    answers.erase(std::unique(answers.begin(), answers.end()), answers.end());
+
+    std::sort(allowed.begin(), allowed.end());
+    allowed.erase(std::unique(allowed.begin(), allowed.end()), allowed.end());
+
+    Builder builder;
+    builder.trie.push_back(TrieNode());
+    std::fill_n(builder.trie[0].child, 26, -1);
+
+    s32 allowedOnly = 0;
+
+    auto insert = [&](const std::string& word, bool isAnswer) {
+        s32 node = 0;
+        for (s32 i = 0; i < WordDawg::wordLength; i++)
+        {
+            s32 letter = word[i] - 'A';
+
+            if (i == WordDawg::wordLength - 1)
+            {
+                // An answer listed as allowed too is still an answer
+                if (builder.trie[node].child[letter] == sinkNode && !isAnswer)
+                    return;
+
+                allowedOnly += !isAnswer;
+                builder.trie[node].child[letter] = sinkNode;
+                builder.trie[node].answer[letter] = isAnswer;
+                return;
+            }
+
+            if (builder.trie[node].child[letter] == -1)
+            {
+                builder.trie[node].child[letter] = (s32) builder.trie.size();
+                builder.trie.push_back(TrieNode());
+                std::fill_n(builder.trie.back().child, 26, -1);
+            }
+
+            node = builder.trie[node].child[letter];
+        }
+    };
+
+    for (const std::string& word : answers)
+        insert(word, true);
+
+    for (const std::string& word : allowed)
+        insert(word, false);
+
+    s32 root = builder.Minimize(0);
+
+    // Lay nodes out breadth first from the root, so the root's edges start at 0
+    std::vector<s32> order;
+    std::vector<s32> offsets(builder.unique.size(), -1);
+    order.push_back(root);
+    offsets[root] = 0;
+
+    u32 edgeCount = (u32) builder.unique[root].size();
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        for (u32 entry : builder.unique[order[i]])
+        {
+            u32 childId = entry >> 6;
+            if (childId == 0 || offsets[childId - 1] >= 0)
+                continue;
+
+            offsets[childId - 1] = edgeCount;
+            edgeCount += (u32) builder.unique[childId - 1].size();
+            order.push_back(childId - 1);
+        }
+    }
+
+    if (edgeCount >= (1u << (32 - WordDawg::childShift)))
+    {
+        fprintf(stderr, "DAWG has too many edges to encode (%u)\n", edgeCount);
+        return 1;
+    }
+
+    std::vector<u32> edges;
+    edges.reserve(edgeCount);
+
+    for (s32 node : order)
+    {
+        const Signature& signature = builder.unique[node];
+        for (size_t e = 0; e < signature.size(); e++)
+        {
+            u32 childId = signature[e] >> 6;
+            u32 child = (childId == 0) ? 0 : (u32) offsets[childId - 1];
+
+            WordDawg::Edge edge = (signature[e] & WordDawg::letterMask) | (child << WordDawg::childShift);
+            if (signature[e] & (1 << 5))
+                edge |= WordDawg::answerFlag;
+            if (e + 1 == signature.size())
+                edge |= WordDawg::lastEdgeFlag;
+
+            edges.push_back(edge);
+        }
+    }
+
+    FILE* file = fopen(outputPath, "w");
+    if (!file)
+    {
+        fprintf(stderr, "Failed to write %s\n", outputPath);
+        return 1;
+    }
+
+    fprintf(file, "#pragma once\n\n");
+    fprintf(file, "// Generated by tools/build_word_dawg.cpp from src/game/words, don't edit by hand.\n\n");
+    fprintf(file, "#include \"core/types.h\"\n\n");
+    fprintf(file, "constexpr s32 wordListSize = %d;    // All possible allowed guesses\n", (s32) (answers.size() + allowedOnly));
+    fprintf(file, "constexpr s32 answersEnd = %d;       // These are the words to be picked from\n\n", (s32) answers.size());
+    fprintf(file, "constexpr s32 wordDawgEdgeCount = %u;\n\n", edgeCount);
+    fprintf(file, "inline constexpr u32 wordDawgEdges[wordDawgEdgeCount] = {");
+
+    for (u32 i = 0; i < edgeCount; i++)
+        fprintf(file, "%s0x%08X,", (i % 8 == 0) ? "\n    " : " ", edges[i]);
+
+    fprintf(file, "\n};\n");
+    fclose(file);
+
+    printf("Wrote %s: %d words (%d answers), %zu trie nodes minimized to %zu, %u edges (%u bytes)\n",
+           outputPath, (s32) (answers.size() + allowedOnly), (s32) answers.size(),
+           builder.trie.size(), builder.unique.size(), edgeCount, edgeCount * 4);
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+// Writes a word list file the game and tools can load at runtime.
+//
+// Usage: build_word_list <length> <answers.txt> <allowed.txt> <output path>
+//        build_word_list [output path]
+//
+// Text files have one word per line, words of other lengths are skipped.
+// With no text files, the compiled in 5 letter list is written instead
+// (to assets/words5.bin by default).
+
+#include "core/types.h"
+#include "platform/platform.h"
+#include "game/wordlist.h"
+#include "game/word_list_file.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+// Reads every word of the given length, returns how many were read or -1 if the file couldn't be opened
+static s32 ReadWords(const char* filepath, s32 length, u64* words, s32 capacity)
+{
+    FILE* file = fopen(filepath, "r");
+    if (!file)
+        return -1;
+
+    s32 count = 0;
+    char line[256];
+
+    while (count < capacity && fgets(line, sizeof(line), file))
+    {
+        s32 lineLength = 0;
+        for (; line[lineLength] && line[lineLength] != '\n' && line[lineLength] != '\r'; lineLength++)
+        {
+            if (line[lineLength] >= 'a' && line[lineLength] <= 'z')
+                line[lineLength] = line[lineLength] - 'a' + 'A';
+        }
+
+        if (lineLength != length)
+            continue;
+
+        u64 packed = WordListFile::PackWord(line, length);
+        if (packed)
+            words[count++] = packed;
+    }
+
+    fclose(file);
+    return count;
+}
+
+int main(int argc, char** argv)
+{
+    constexpr s32 capacity = 1 << 20;
+
+    u64* answers = (u64*) PlatformAllocate(capacity * sizeof(u64));
+    u64* words = (u64*) PlatformAllocate(capacity * sizeof(u64));
+
+    s32 length = 5;
+    s32 answerCount = 0;
+    s32 wordCount = 0;
+    const char* outputPath = "assets/words5.bin";
+
+    if (argc >= 5)
+    {
+        length = atoi(argv[1]);
+        if (length < minWordFileLength || length > maxWordFileLength)
+        {
+            fprintf(stderr, "Word length has to be between %d and %d\n", minWordFileLength, maxWordFileLength);
+            return 1;
+        }
+
+        answerCount = ReadWords(argv[2], length, answers, capacity);
+        wordCount = ReadWords(argv[3], length, words, capacity);
+        outputPath = argv[4];
+
+        if (answerCount <= 0 || wordCount < 0)
+        {
+            fprintf(stderr, "Couldn't read any answers from %s and %s\n", argv[2], argv[3]);
+            return 1;
+        }
+    }
+    else
+    {
+        BuildWordList();
+
+        for (s32 i = 0; i < wordListSize; i++)
+        {
+            u64 packed = WordListFile::PackWord(wordList[i], 5);
+            if (i < answersEnd)
+                answers[answerCount++] = packed;
+
+            words[wordCount++] = packed;
+        }
+
+        if (argc > 1)
+            outputPath = argv[1];
+    }
+
+    bool saved = WordListFile::Save(outputPath, length, answers, answerCount, words, wordCount);
+    if (saved)
+        printf("Wrote %s (%d letters)\n", outputPath, length);
+    else
+        fprintf(stderr, "Failed to write %s\n", outputPath);
+
+    PlatformFree(answers);
+    PlatformFree(words);
+
+    return saved ? 0 : 1;
+}
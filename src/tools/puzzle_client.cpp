@@ -0,0 +1,402 @@
+// Load generator for puzzle_server: plays games over many connections at once
+// and reports throughput and request latency.
+//
+// Usage: puzzle_client [--unix <socket path> | --tcp <port>] [--connections N] [--pipeline N] [--games N]
+//
+// Every connection keeps --pipeline games going, each with one request in
+// flight, and starts a new game as soon as one ends until --games have been
+// played. Games guess the first answer that's still possible. Latency is from
+// queueing a request to reading its reply, so it includes time spent waiting
+// in this process' own batches, which is what a real client would see.
+
+#include "core/types.h"
+#include "game/board.h"
+#include "game/candidates.h"
+#include "game/packed_word.h"
+#include "game/puzzle_protocol.h"
+#include "game/scoring.h"
+#include "platform/platform.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace PuzzleProtocol;
+
+static constexpr s32 maxPipeline = 256;     // Replies for a full pipeline fit in one read
+static constexpr s32 maxEvents = 256;
+
+struct Game
+{
+    CandidateSet candidates;
+    u32 sessionId;
+    PackedWord lastGuess;
+    f64 sendTime;
+    bool started;
+    bool awaitingSession;   // The NEW_GAME reply hasn't come back yet
+};
+
+struct Connection
+{
+    s32 fd;
+    s32 inUsed;
+    s32 outUsed;
+    u8 in[maxPipeline * sizeof(Reply)];
+    u8 out[maxPipeline * sizeof(Request)];
+};
+
+static struct
+{
+    Connection* connections = nullptr;
+    Game* games = nullptr;      // pipeline per connection
+    s32 connectionCount = 16;
+    s32 pipeline = 16;
+
+    s64 targetGames = 100000;
+    s64 startedGames = 0;
+    s64 finishedGames = 0;
+    s64 wonGames = 0;
+    s64 totalGuesses = 0;       // Over won games
+    s64 errors = 0;
+    s32 activeGames = 0;
+
+    u32* latencies = nullptr;   // Nanoseconds, one per reply
+    s64 latencyCount = 0;
+    s64 latencyCapacity = 0;
+} client;
+
+static void Queue(Connection& connection, const Request& request)
+{
+    PlatformCopyMemory(connection.out + connection.outUsed, &request, sizeof(Request));
+    connection.outUsed += sizeof(Request);
+}
+
+// Queues the next request for a game slot, or leaves it idle once enough games have started
+static void Advance(s32 connectionIndex, s32 slot)
+{
+    Connection& connection = client.connections[connectionIndex];
+    Game& game = client.games[connectionIndex * client.pipeline + slot];
+
+    Request request = {};
+    request.tag = (u32) slot;
+
+    if (!game.started)
+    {
+        if (client.startedGames >= client.targetGames)
+            return;
+
+        client.startedGames++;
+        client.activeGames++;
+
+        game.started = true;
+        game.awaitingSession = true;
+        game.candidates.Reset();
+
+        request.type = RequestType::NEW_GAME;
+    }
+    else
+    {
+        s32 guess = -1;
+        for (s32 answer : game.candidates)
+        {
+            guess = answer;
+            break;
+        }
+
+        game.lastGuess = packedWordList[(guess >= 0) ? guess : 0];
+
+        request.type = RequestType::GUESS;
+        request.sessionId = game.sessionId;
+        request.word = game.lastGuess;
+    }
+
+    game.sendTime = PlatformGetTime();
+    Queue(connection, request);
+}
+
+static void EndGame(Game& game)
+{
+    game.started = false;
+    client.finishedGames++;
+    client.activeGames--;
+}
+
+static void OnReply(s32 connectionIndex, const Reply& reply, f64 now)
+{
+    if (reply.tag >= (u32) client.pipeline)
+    {
+        client.errors++;
+        return;
+    }
+
+    s32 slot = (s32) reply.tag;
+    Game& game = client.games[connectionIndex * client.pipeline + slot];
+
+    if (client.latencyCount < client.latencyCapacity)
+        client.latencies[client.latencyCount++] = (u32) ((now - game.sendTime) * 1e9);
+
+    if (reply.status != ReplyStatus::OK)
+    {
+        client.errors++;
+        EndGame(game);
+    }
+    else if (game.awaitingSession)
+    {
+        game.sessionId = reply.sessionId;
+        game.awaitingSession = false;
+    }
+    else
+    {
+        game.candidates.Apply(game.lastGuess, reply.feedback);
+
+        if ((BoardStatus) reply.boardStatus != BoardStatus::PLAYING)
+        {
+            if ((BoardStatus) reply.boardStatus == BoardStatus::WON)
+            {
+                client.wonGames++;
+                client.totalGuesses += reply.guessCount;
+            }
+
+            EndGame(game);
+        }
+    }
+
+    Advance(connectionIndex, slot);
+}
+
+// Sends everything queued on a connection, the sockets block so this waits if the socket is full
+static bool Flush(Connection& connection)
+{
+    s32 sent = 0;
+    while (sent < connection.outUsed)
+    {
+        ssize_t result = send(connection.fd, connection.out + sent, connection.outUsed - sent, MSG_NOSIGNAL);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return false;
+        }
+
+        sent += (s32) result;
+    }
+
+    connection.outUsed = 0;
+    return true;
+}
+
+static s32 Connect(const char* socketPath, s32 port)
+{
+    s32 fd;
+
+    if (port > 0)
+    {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons((u16) port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (fd < 0 || connect(fd, (sockaddr*) &address, sizeof(address)) != 0)
+            return -1;
+
+        s32 noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+    }
+    else
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (strlen(socketPath) >= sizeof(address.sun_path))
+            return -1;
+
+        strcpy(address.sun_path, socketPath);
+
+        if (fd < 0 || connect(fd, (sockaddr*) &address, sizeof(address)) != 0)
+            return -1;
+    }
+
+    return fd;
+}
+
+static f64 GetPercentile(f64 percentile)
+{
+    s64 index = (s64) (percentile / 100.0 * (client.latencyCount - 1) + 0.5);
+    return client.latencies[index] / 1000.0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* socketPath = defaultSocketPath;
+    s32 port = 0;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--unix") == 0 && i + 1 < argc)
+            socketPath = argv[++i];
+        else if (strcmp(argv[i], "--tcp") == 0 && i + 1 < argc)
+            port = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--connections") == 0 && i + 1 < argc)
+            client.connectionCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--pipeline") == 0 && i + 1 < argc)
+            client.pipeline = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            client.targetGames = atoll(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Usage: puzzle_client [--unix <socket path> | --tcp <port>] [--connections N] [--pipeline N] [--games N]\n");
+            return 1;
+        }
+    }
+
+    if (client.connectionCount < 1 || client.pipeline < 1 || client.pipeline > maxPipeline || client.targetGames < 1)
+    {
+        fprintf(stderr, "Connections and games have to be at least 1, pipeline in [1, %d]\n", maxPipeline);
+        return 1;
+    }
+
+    BuildPackedWordList();
+    CandidateIndex::Build();
+
+    client.connections = (Connection*) PlatformAllocate(client.connectionCount * sizeof(Connection));
+    client.games = (Game*) PlatformAllocate((u64) client.connectionCount * client.pipeline * sizeof(Game));
+    PlatformZeroMemory(client.games, (u64) client.connectionCount * client.pipeline * sizeof(Game));
+
+    // A game is a new game request plus at most maxGuesses guesses
+    client.latencyCapacity = client.targetGames * (maxGuesses + 1);
+    client.latencies = (u32*) PlatformAllocate(client.latencyCapacity * sizeof(u32));
+
+    s32 epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    for (s32 c = 0; c < client.connectionCount; c++)
+    {
+        Connection& connection = client.connections[c];
+        connection.fd = Connect(socketPath, port);
+        connection.inUsed = 0;
+        connection.outUsed = 0;
+
+        if (connection.fd < 0)
+        {
+            if (port > 0)
+                fprintf(stderr, "Couldn't connect to 127.0.0.1:%d (%s)\n", port, strerror(errno));
+            else
+                fprintf(stderr, "Couldn't connect to %s (%s)\n", socketPath, strerror(errno));
+
+            return 1;
+        }
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = (u64) c;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, connection.fd, &event);
+    }
+
+    f64 startTime = PlatformGetTime();
+
+    for (s32 c = 0; c < client.connectionCount; c++)
+    {
+        for (s32 slot = 0; slot < client.pipeline; slot++)
+            Advance(c, slot);
+
+        Flush(client.connections[c]);
+    }
+
+    epoll_event events[maxEvents];
+
+    while (client.activeGames > 0)
+    {
+        s32 eventCount = epoll_wait(epollFd, events, maxEvents, 5000);
+        if (eventCount == 0)
+        {
+            fprintf(stderr, "Server stopped answering\n");
+            break;
+        }
+
+        if (eventCount < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        for (s32 e = 0; e < eventCount; e++)
+        {
+            s32 c = (s32) events[e].data.u64;
+            Connection& connection = client.connections[c];
+
+            ssize_t received = recv(connection.fd, connection.in + connection.inUsed, sizeof(connection.in) - connection.inUsed, 0);
+            if (received <= 0)
+            {
+                fprintf(stderr, "Server closed the connection\n");
+                client.activeGames = 0;
+                break;
+            }
+
+            connection.inUsed += (s32) received;
+            f64 now = PlatformGetTime();
+
+            // The replies that came in go out as one batch of requests
+            s32 replyCount = connection.inUsed / (s32) sizeof(Reply);
+            for (s32 r = 0; r < replyCount; r++)
+            {
+                Reply reply;
+                PlatformCopyMemory(&reply, connection.in + r * sizeof(Reply), sizeof(Reply));
+                OnReply(c, reply, now);
+            }
+
+            s32 consumed = replyCount * (s32) sizeof(Reply);
+            memmove(connection.in, connection.in + consumed, connection.inUsed - consumed);
+            connection.inUsed -= consumed;
+
+            if (!Flush(connection))
+            {
+                fprintf(stderr, "Couldn't send to the server\n");
+                client.activeGames = 0;
+                break;
+            }
+        }
+    }
+
+    f64 seconds = PlatformGetTime() - startTime;
+
+    std::sort(client.latencies, client.latencies + client.latencyCount);
+
+    printf("Games:    %lld finished, %lld won (%.4f guesses per win), %lld errors\n",
+           (long long) client.finishedGames, (long long) client.wonGames,
+           client.wonGames ? (f64) client.totalGuesses / client.wonGames : 0.0, (long long) client.errors);
+    printf("Requests: %lld in %.3f s (%.0f requests/s, %.0f games/s)\n",
+           (long long) client.latencyCount, seconds, client.latencyCount / seconds, client.finishedGames / seconds);
+    printf("Clients:  %d connections x %d games in flight\n", client.connectionCount, client.pipeline);
+
+    if (client.latencyCount > 0)
+    {
+        printf("Latency:  p50 %.1f us, p90 %.1f us, p99 %.1f us, p99.9 %.1f us, max %.1f us\n",
+               GetPercentile(50.0), GetPercentile(90.0), GetPercentile(99.0), GetPercentile(99.9),
+               client.latencies[client.latencyCount - 1] / 1000.0);
+    }
+
+    for (s32 c = 0; c < client.connectionCount; c++)
+        close(client.connections[c].fd);
+
+    close(epollFd);
+
+    PlatformFree(client.latencies);
+    PlatformFree(client.games);
+    PlatformFree(client.connections);
+
+    return 0;
+}
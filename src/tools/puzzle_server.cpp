@@ -0,0 +1,552 @@
+// Hosts independent games for many players at once, see game/puzzle_protocol.h.
+//
+// Usage: puzzle_server [--unix <socket path> | --tcp <port>] [--sessions N] [--connections N]
+//
+// Listens on a Unix domain socket by default, or on loopback TCP with --tcp.
+// Linux only, it's one thread driving non blocking sockets with epoll.
+//
+// Every connection and session lives in an array allocated at startup. A
+// connection's requests are read in one go, answered into its output buffer
+// and written back with one write, so serving a request never allocates and
+// costs a couple of system calls per batch rather than per request.
+//
+// Runs until interrupted, then prints what it served.
+
+#include "core/types.h"
+#include "game/board.h"
+#include "game/packed_word.h"
+#include "game/puzzle_protocol.h"
+#include "game/scoring.h"
+#include "game/session_slab.h"
+#include "game/word_index.h"
+#include "game/wordlist.h"
+#include "math/random.h"
+#include "platform/platform.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace PuzzleProtocol;
+
+static constexpr s32 bufferSize = 4096;                     // Per connection and direction, 256 messages
+static constexpr s32 maxEvents = 256;
+static constexpr u64 listenerTag = ~0ull;
+
+struct Connection
+{
+    s32 fd;
+    u32 generation;             // Bumped on close, owns this connection's sessions together with the index
+    s32 inUsed;
+    s32 outUsed;
+    s32 outSent;
+    bool open;
+    bool waitingToWrite;        // Reading is paused until the output buffer drains
+
+    SessionSlab::OwnedList sessions;
+
+    u8 in[bufferSize];
+    u8 out[bufferSize];
+};
+
+static struct
+{
+    Connection* connections = nullptr;
+    s32 connectionCount = 0;
+    s32 firstFree = 0;          // Connections are handed out from the lowest free index
+
+    s32 epollFd = -1;
+    s32 listenFd = -1;
+
+    Math::RandomState random;
+
+    u64 requests = 0;
+    u64 games = 0;
+    u64 batches = 0;
+    s32 peakSessions = 0;
+} server;
+
+static volatile sig_atomic_t quit = 0;
+
+static void OnSignal(int signal)
+{
+    quit = 1;
+}
+
+static inline u32 GetOwner(s32 index)
+{
+    return ((u32) server.connections[index].generation << 16) | (u32) index;
+}
+
+static bool IsValidWord(PackedWord word, s32& guessIndex)
+{
+    if (word >> (letterBits * wordLength))
+        return false;
+
+    char letters[wordLength];
+    UnpackWord(word, letters);
+
+    guessIndex = WordIndex::Find(letters);
+    return guessIndex >= 0;
+}
+
+static Reply Serve(const Request& request, u32 owner, SessionSlab::OwnedList& sessions)
+{
+    Reply reply = {};
+    reply.sessionId = request.sessionId;
+    reply.tag = request.tag;
+    reply.answerIndex = 0xFFFF;
+
+    switch (request.type)
+    {
+        case RequestType::NEW_GAME:
+        {
+            u32 id = SessionSlab::Create((s32) Math::RandomBounded(server.random, answersEnd), owner, sessions);
+            if (id == SessionSlab::invalidId)
+            {
+                reply.status = ReplyStatus::SERVER_FULL;
+                break;
+            }
+
+            server.games++;
+            s32 active = SessionSlab::GetActiveCount();
+            server.peakSessions = (active > server.peakSessions) ? active : server.peakSessions;
+
+            reply.status = ReplyStatus::OK;
+            reply.sessionId = id;
+            reply.candidateCount = (u16) SessionSlab::Get(id)->board.candidates.Count();
+            break;
+        }
+
+        case RequestType::GUESS:
+        {
+            // Other connections' sessions look the same as ones that don't exist
+            SessionSlab::Session* session = SessionSlab::Get(request.sessionId);
+            if (!session || session->owner != owner)
+            {
+                reply.status = ReplyStatus::UNKNOWN_SESSION;
+                break;
+            }
+
+            Board& board = session->board;
+
+            s32 guessIndex;
+            if (!IsValidWord(request.word, guessIndex))
+            {
+                reply.status = ReplyStatus::INVALID_WORD;
+                reply.guessCount = (u8) board.guessCount;
+                break;
+            }
+
+            reply.status = ReplyStatus::OK;
+            reply.feedback = board.Guess(guessIndex);
+            reply.guessCount = (u8) board.guessCount;
+            reply.boardStatus = (u8) board.status;
+            reply.candidateCount = (u16) board.candidates.Count();
+
+            if (board.status != BoardStatus::PLAYING)
+            {
+                reply.answerIndex = (u16) board.answerIndex;
+                SessionSlab::Destroy(request.sessionId);
+            }
+            break;
+        }
+
+        case RequestType::END:
+        {
+            SessionSlab::Session* session = SessionSlab::Get(request.sessionId);
+            if (!session || session->owner != owner)
+            {
+                reply.status = ReplyStatus::UNKNOWN_SESSION;
+                break;
+            }
+
+            reply.status = ReplyStatus::OK;
+            reply.answerIndex = (u16) session->board.answerIndex;
+            SessionSlab::Destroy(request.sessionId);
+            break;
+        }
+
+        default:
+        {
+            reply.status = ReplyStatus::BAD_REQUEST;
+            break;
+        }
+    }
+
+    return reply;
+}
+
+static void UpdateEvents(s32 index)
+{
+    Connection& connection = server.connections[index];
+
+    epoll_event event = {};
+    event.events = connection.waitingToWrite ? EPOLLOUT : EPOLLIN;
+    event.data.u64 = (u64) index;
+    epoll_ctl(server.epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+}
+
+static void CloseConnection(s32 index)
+{
+    Connection& connection = server.connections[index];
+
+    // Games nobody can finish anymore would only take up slots
+    SessionSlab::DestroyAll(connection.sessions);
+
+    close(connection.fd);
+    connection.open = false;
+    connection.generation++;
+
+    server.firstFree = (index < server.firstFree) ? index : server.firstFree;
+}
+
+// Writes out as much of the output buffer as the socket takes. Returns false if the connection broke.
+static bool Flush(s32 index)
+{
+    Connection& connection = server.connections[index];
+
+    while (connection.outSent < connection.outUsed)
+    {
+        ssize_t sent = send(connection.fd, connection.out + connection.outSent, connection.outUsed - connection.outSent, MSG_NOSIGNAL);
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            if (errno != EAGAIN && errno != EWOULDBLOCK)
+                return false;
+
+            break;
+        }
+
+        connection.outSent += (s32) sent;
+    }
+
+    if (connection.outSent == connection.outUsed)
+    {
+        connection.outSent = 0;
+        connection.outUsed = 0;
+    }
+
+    bool waiting = connection.outUsed > 0;
+    if (waiting != connection.waitingToWrite)
+    {
+        connection.waitingToWrite = waiting;
+        UpdateEvents(index);
+    }
+
+    return true;
+}
+
+// Answers every whole request in the input buffer that there's room to reply to
+static void ServeBuffered(s32 index)
+{
+    Connection& connection = server.connections[index];
+    u32 owner = GetOwner(index);
+
+    s32 requestCount = connection.inUsed / (s32) sizeof(Request);
+    s32 room = (bufferSize - connection.outUsed) / (s32) sizeof(Reply);
+    s32 count = (requestCount < room) ? requestCount : room;
+
+    for (s32 i = 0; i < count; i++)
+    {
+        Request request;
+        PlatformCopyMemory(&request, connection.in + i * sizeof(Request), sizeof(Request));
+
+        Reply reply = Serve(request, owner, connection.sessions);
+        PlatformCopyMemory(connection.out + connection.outUsed, &reply, sizeof(Reply));
+        connection.outUsed += sizeof(Reply);
+    }
+
+    // Whatever's left is a partial request, or ones waiting for room to reply
+    s32 consumed = count * (s32) sizeof(Request);
+    if (consumed > 0)
+    {
+        memmove(connection.in, connection.in + consumed, connection.inUsed - consumed);
+        connection.inUsed -= consumed;
+
+        server.requests += count;
+        server.batches++;
+    }
+}
+
+// Serves and writes until the buffered requests run out or the socket stops taking replies.
+// Returns false if the connection broke.
+static bool ServeAndFlush(s32 index)
+{
+    Connection& connection = server.connections[index];
+
+    do
+    {
+        ServeBuffered(index);
+
+        if (!Flush(index))
+            return false;
+    } while (!connection.waitingToWrite && connection.inUsed >= (s32) sizeof(Request));
+
+    return true;
+}
+
+static void OnReadable(s32 index)
+{
+    Connection& connection = server.connections[index];
+
+    if (connection.inUsed < bufferSize)
+    {
+        ssize_t received = recv(connection.fd, connection.in + connection.inUsed, bufferSize - connection.inUsed, 0);
+        if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+        {
+            CloseConnection(index);
+            return;
+        }
+
+        if (received > 0)
+            connection.inUsed += (s32) received;
+    }
+
+    if (!ServeAndFlush(index))
+        CloseConnection(index);
+}
+
+static void OnWritable(s32 index)
+{
+    if (!Flush(index))
+    {
+        CloseConnection(index);
+        return;
+    }
+
+    // Requests that didn't fit last time
+    if (!server.connections[index].waitingToWrite && !ServeAndFlush(index))
+        CloseConnection(index);
+}
+
+static void AcceptConnections()
+{
+    while (true)
+    {
+        s32 fd = accept4(server.listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return;
+        }
+
+        s32 index = server.firstFree;
+        while (index < server.connectionCount && server.connections[index].open)
+            index++;
+
+        if (index >= server.connectionCount)
+        {
+            close(fd);
+            continue;
+        }
+
+        server.firstFree = index + 1;
+
+        s32 noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        Connection& connection = server.connections[index];
+        connection.fd = fd;
+        connection.inUsed = 0;
+        connection.outUsed = 0;
+        connection.outSent = 0;
+        connection.open = true;
+        connection.waitingToWrite = false;
+        connection.sessions = SessionSlab::OwnedList();
+
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.u64 = (u64) index;
+        epoll_ctl(server.epollFd, EPOLL_CTL_ADD, fd, &event);
+    }
+}
+
+static s32 Listen(const char* socketPath, s32 port)
+{
+    s32 fd;
+
+    if (port > 0)
+    {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        s32 reuse = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons((u16) port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        if (fd < 0 || bind(fd, (sockaddr*) &address, sizeof(address)) != 0)
+            return -1;
+    }
+    else
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        sockaddr_un address = {};
+        address.sun_family = AF_UNIX;
+        if (strlen(socketPath) >= sizeof(address.sun_path))
+            return -1;
+
+        strcpy(address.sun_path, socketPath);
+
+        // A socket file left behind by a server that didn't shut down cleanly
+        unlink(socketPath);
+
+        if (fd < 0 || bind(fd, (sockaddr*) &address, sizeof(address)) != 0)
+            return -1;
+    }
+
+    if (listen(fd, SOMAXCONN) != 0)
+        return -1;
+
+    return fd;
+}
+
+int main(int argc, char** argv)
+{
+    const char* socketPath = defaultSocketPath;
+    s32 port = 0;
+    s32 sessionCount = 65536;
+    s32 connectionCount = 1024;
+
+    for (s32 i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--unix") == 0 && i + 1 < argc)
+            socketPath = argv[++i];
+        else if (strcmp(argv[i], "--tcp") == 0 && i + 1 < argc)
+            port = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--sessions") == 0 && i + 1 < argc)
+            sessionCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--connections") == 0 && i + 1 < argc)
+            connectionCount = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "Usage: puzzle_server [--unix <socket path> | --tcp <port>] [--sessions N] [--connections N]\n");
+            return 1;
+        }
+    }
+
+    if (sessionCount < 1 || sessionCount > SessionSlab::maxCapacity || connectionCount < 1 || connectionCount > 0xFFFF)
+    {
+        fprintf(stderr, "Session count has to be in [1, %d] and connection count in [1, 65535]\n", SessionSlab::maxCapacity);
+        return 1;
+    }
+
+    BuildPackedWordList();
+    WordIndex::Build();
+
+    server.random = Math::SeedRandom(Math::GetTimeSeed());
+
+    if (!SessionSlab::Init(sessionCount))
+    {
+        fprintf(stderr, "Couldn't allocate %d sessions\n", sessionCount);
+        return 1;
+    }
+
+    server.connections = (Connection*) PlatformAllocate((u64) connectionCount * sizeof(Connection));
+    PlatformZeroMemory(server.connections, (u64) connectionCount * sizeof(Connection));
+    server.connectionCount = connectionCount;
+
+    server.listenFd = Listen(socketPath, port);
+    if (server.listenFd < 0)
+    {
+        if (port > 0)
+            fprintf(stderr, "Couldn't listen on 127.0.0.1:%d (%s)\n", port, strerror(errno));
+        else
+            fprintf(stderr, "Couldn't listen on %s (%s)\n", socketPath, strerror(errno));
+
+        return 1;
+    }
+
+    server.epollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    epoll_event listenEvent = {};
+    listenEvent.events = EPOLLIN;
+    listenEvent.data.u64 = listenerTag;
+    epoll_ctl(server.epollFd, EPOLL_CTL_ADD, server.listenFd, &listenEvent);
+
+    signal(SIGINT, OnSignal);
+    signal(SIGTERM, OnSignal);
+
+    if (port > 0)
+        printf("Listening on 127.0.0.1:%d, %d sessions, %d connections\n", port, sessionCount, connectionCount);
+    else
+        printf("Listening on %s, %d sessions, %d connections\n", socketPath, sessionCount, connectionCount);
+
+    fflush(stdout);
+
+    f64 startTime = PlatformGetTime();
+    epoll_event events[maxEvents];
+
+    while (!quit)
+    {
+        s32 eventCount = epoll_wait(server.epollFd, events, maxEvents, -1);
+        if (eventCount < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            break;
+        }
+
+        for (s32 e = 0; e < eventCount; e++)
+        {
+            if (events[e].data.u64 == listenerTag)
+            {
+                AcceptConnections();
+                continue;
+            }
+
+            s32 index = (s32) events[e].data.u64;
+            if (!server.connections[index].open)
+                continue;
+
+            if (events[e].events & (EPOLLERR | EPOLLHUP))
+                CloseConnection(index);
+            else if (events[e].events & EPOLLOUT)
+                OnWritable(index);
+            else
+                OnReadable(index);
+        }
+    }
+
+    f64 seconds = PlatformGetTime() - startTime;
+
+    printf("\nServed:   %llu requests in %llu batches (%.1f per batch) over %.1f s\n",
+           (unsigned long long) server.requests, (unsigned long long) server.batches,
+           server.batches ? (f64) server.requests / server.batches : 0.0, seconds);
+    printf("Games:    %llu started, %d sessions at peak\n", (unsigned long long) server.games, server.peakSessions);
+
+    for (s32 i = 0; i < server.connectionCount; i++)
+    {
+        if (server.connections[i].open)
+            close(server.connections[i].fd);
+    }
+
+    close(server.epollFd);
+    close(server.listenFd);
+
+    if (port <= 0)
+        unlink(socketPath);
+
+    PlatformFree(server.connections);
+    SessionSlab::Shutdown();
+
+    return 0;
+}
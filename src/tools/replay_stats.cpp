@@ -0,0 +1,195 @@
+// Scans a replay log and prints what players did.
+//
+// Usage: replay_stats [log file]
+//        replay_stats --generate <game count> [log file]
+//
+// The log defaults to the one the game writes. With --generate, plays games
+// with the first candidate strategy and appends them to the log instead,
+// which is handy for trying the reader on millions of records.
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/board.h"
+#include "game/feedback_matrix.h"
+#include "game/replay_log.h"
+#include "game/strategies.h"
+#include "game/wordlist.h"
+#include "math/random.h"
+#include "platform/platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+struct Stats
+{
+    u64 records;
+    u64 outcomes[3];            // Indexed by ReplayLog::Outcome
+    u64 wins[ReplayLog::maxRecordGuesses + 1];
+    u64 totalWinGuesses;
+    u64 modes[2];               // Indexed by GameMode
+    u32 openers[wordListSize];  // First guesses of the first board of each game
+};
+
+static Stats stats;
+
+static void AddGroup(const ReplayLog::Record* records, s32 count)
+{
+    for (s32 i = 0; i < count; i++)
+    {
+        const ReplayLog::Record& record = records[i];
+
+        stats.outcomes[(s32) record.outcome]++;
+
+        if (record.outcome == ReplayLog::Outcome::WON)
+        {
+            stats.wins[record.guessCount]++;
+            stats.totalWinGuesses += record.guessCount;
+        }
+
+        if (record.boardIndex == 0)
+        {
+            stats.modes[(s32) record.mode]++;
+
+            if (record.guessCount > 0)
+                stats.openers[record.guesses[0]]++;
+        }
+    }
+
+    stats.records += count;
+}
+
+static int PrintStats(const char* filepath)
+{
+    ReplayLog::Reader reader;
+    if (!ReplayLog::OpenReader(filepath, reader))
+    {
+        fprintf(stderr, "Couldn't open replay log %s\n", filepath);
+        return 1;
+    }
+
+    f64 startTime = PlatformGetTime();
+
+    s64 damaged = 0;
+    for (s64 g = 0; g < reader.groupCount; g++)
+    {
+        damaged += !ReplayLog::VerifyGroup(reader, g);
+
+        s32 count;
+        const ReplayLog::Record* records = ReplayLog::GetGroup(reader, g, count);
+        AddGroup(records, count);
+    }
+
+    f64 seconds = PlatformGetTime() - startTime;
+
+    u64 games = stats.modes[0] + stats.modes[1];
+    printf("Log:      %s, %lld records in %lld groups (%lld damaged)\n",
+           filepath, (long long) reader.recordCount, (long long) reader.groupCount, (long long) damaged);
+    printf("Games:    %llu (%llu classic, %llu absurdle)\n",
+           (unsigned long long) games, (unsigned long long) stats.modes[0], (unsigned long long) stats.modes[1]);
+    printf("Boards:   %llu won, %llu lost, %llu abandoned\n",
+           (unsigned long long) stats.outcomes[0], (unsigned long long) stats.outcomes[1], (unsigned long long) stats.outcomes[2]);
+
+    for (s32 n = 1; n <= maxGuesses; n++)
+        printf("  %d guesses: %llu\n", n, (unsigned long long) stats.wins[n]);
+
+    if (stats.outcomes[0] > 0)
+        printf("Average:  %.4f guesses per won board\n", (f64) stats.totalWinGuesses / stats.outcomes[0]);
+
+    // Top openers, a few passes over the counts is plenty for five of them
+    printf("Openers: ");
+    for (s32 top = 0; top < 5; top++)
+    {
+        s32 best = -1;
+        for (s32 w = 0; w < wordListSize; w++)
+        {
+            if (stats.openers[w] > 0 && (best < 0 || stats.openers[w] > stats.openers[best]))
+                best = w;
+        }
+
+        if (best < 0)
+            break;
+
+        printf(" %.5s (%u)", wordList[best], stats.openers[best]);
+        stats.openers[best] = 0;
+    }
+    printf("\n");
+
+    printf("Scan:     %.3f s (%.0f records/s)\n", seconds, (seconds > 0.0) ? reader.recordCount / seconds : 0.0);
+
+    ReplayLog::CloseReader(reader);
+    return 0;
+}
+
+static int GenerateGames(s64 gameCount, const char* filepath)
+{
+    Jobs::Init(1);
+
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+        FeedbackMatrix::Build();
+
+    Strategies::Init();
+
+    if (!ReplayLog::Open(filepath))
+    {
+        fprintf(stderr, "Couldn't open replay log %s\n", filepath);
+        return 1;
+    }
+
+    Math::RandomState random = Math::SeedRandom(Math::GetTimeSeed());
+    Strategies::Scratch* scratch = (Strategies::Scratch*) PlatformAllocate(sizeof(Strategies::Scratch));
+
+    Board board;
+    ReplayLog::Record record;
+    PlatformZeroMemory(&record, sizeof(record));
+    record.boardCount = 1;
+    record.mode = GameMode::CLASSIC;
+
+    f64 startTime = PlatformGetTime();
+
+    for (s64 game = 0; game < gameCount; game++)
+    {
+        board.Reset((s32) Math::RandomBounded(random, answersEnd));
+
+        while (board.status == BoardStatus::PLAYING)
+            board.Guess(Strategies::FirstCandidate(board, *scratch));
+
+        record.startTime = ReplayLog::GetTimestamp();
+        record.duration = (u32) Math::RandomRange(random, 10000, 300000);
+        record.answerIndex = (u16) board.answerIndex;
+        record.guessCount = (u8) board.guessCount;
+        record.outcome = (board.status == BoardStatus::WON) ? ReplayLog::Outcome::WON : ReplayLog::Outcome::LOST;
+
+        for (s32 i = 0; i < board.guessCount; i++)
+        {
+            record.guesses[i] = (u16) board.guesses[i];
+            record.feedback[i] = board.feedback[i];
+        }
+
+        // Unlike the game, a tool can afford to wait for the writer
+        while (!ReplayLog::Append(record))
+            std::this_thread::yield();
+    }
+
+    ReplayLog::Close();
+
+    f64 seconds = PlatformGetTime() - startTime;
+    printf("Appended %lld games to %s in %.3f s\n", (long long) gameCount, filepath, seconds);
+
+    PlatformFree(scratch);
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    BuildPackedWordList();
+
+    if (argc > 2 && strcmp(argv[1], "--generate") == 0)
+        return GenerateGames(atoll(argv[2]), (argc > 3) ? argv[3] : ReplayLog::defaultPath);
+
+    return PrintStats((argc > 1) ? argv[1] : ReplayLog::defaultPath);
+}
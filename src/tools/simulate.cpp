@@ -0,0 +1,194 @@
+// Plays every answer with a guessing strategy and prints how it did.
+//
+// Usage: simulate [strategy] [thread count]
+//        simulate --words <word list file> [thread count]
+//
+// Thread count defaults to every hardware thread. Uses the feedback matrix
+// from build_feedback_matrix if it's there, and builds it in memory if not.
+//
+// With --words, plays a word list from build_word_list instead, of any
+// length, always guessing the first answer that's still possible.
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/board.h"
+#include "game/feedback_matrix.h"
+#include "game/opening_book.h"
+#include "game/simulator.h"
+#include "game/state_cache.h"
+#include "game/strategies.h"
+#include "game/word_game.h"
+#include "game/word_list_file.h"
+#include "platform/platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void PrintResults(const Simulator::Results& results)
+{
+    printf("Games:    %u\n", results.games);
+
+    for (s32 n = 1; n <= maxGuesses; n++)
+        printf("  %d guesses: %6u (%5.2f%%)\n", n, results.wins[n], 100.0f * results.wins[n] / results.games);
+
+    printf("  failed:    %6u (%5.2f%%)\n", results.losses, 100.0f * results.GetFailureRate());
+    printf("Average:  %.4f guesses\n", results.GetAverageGuesses());
+    printf("Time:     %.3f s (%.0f games/s)\n", results.seconds, results.GetGamesPerSecond());
+}
+
+struct alignas(64) WordListCounts
+{
+    u32 wins[maxGuesses + 1];
+    u32 losses;
+};
+
+static struct
+{
+    const WordList* list;
+    WordListCounts* counts;     // One per thread
+} wordListRun;
+
+template <s32 Length>
+static void PlayWordListGames(void* data, s32 begin, s32 end, s32 threadIndex)
+{
+    const WordList& list = *wordListRun.list;
+    WordListCounts& counts = wordListRun.counts[threadIndex];
+
+    WordGame<Length, maxGuesses> game;
+    typename WordGame<Length, maxGuesses>::Feedback feedback;
+
+    for (s32 answer = begin; answer < end; answer++)
+    {
+        game.Reset(list, answer);
+
+        // Answers are checked in order, so the next candidate is never before the last guess
+        s32 next = 0;
+        while (game.status == BoardStatus::PLAYING)
+        {
+            while (!game.IsConsistent(list.answers[next]))
+                next++;
+
+            game.Guess(list.answers[next], feedback);
+        }
+
+        if (game.status == BoardStatus::WON)
+            counts.wins[game.guessCount]++;
+        else
+            counts.losses++;
+    }
+}
+
+static int SimulateWordList(const char* filepath)
+{
+    WordList list;
+    if (!WordListFile::Load(filepath, list))
+    {
+        fprintf(stderr, "Couldn't load word list %s\n", filepath);
+        return 1;
+    }
+
+    s32 threadCount = Jobs::GetThreadCount();
+    wordListRun.list = &list;
+    wordListRun.counts = (WordListCounts*) PlatformAllocate(threadCount * sizeof(WordListCounts));
+    PlatformZeroMemory(wordListRun.counts, threadCount * sizeof(WordListCounts));
+
+    // Every length is its own instantiation of the game
+    Jobs::JobFunction play = nullptr;
+    switch (list.wordLength)
+    {
+        case 4: play = PlayWordListGames<4>; break;
+        case 5: play = PlayWordListGames<5>; break;
+        case 6: play = PlayWordListGames<6>; break;
+        case 7: play = PlayWordListGames<7>; break;
+        case 8: play = PlayWordListGames<8>; break;
+    }
+
+    f64 startTime = PlatformGetTime();
+    Jobs::ParallelFor(list.answerCount, 8, play, nullptr);
+    f64 seconds = PlatformGetTime() - startTime;
+
+    Simulator::Results results = {};
+    results.games = list.answerCount;
+    results.seconds = seconds;
+
+    for (s32 t = 0; t < threadCount; t++)
+    {
+        for (s32 n = 0; n <= maxGuesses; n++)
+        {
+            results.wins[n] += wordListRun.counts[t].wins[n];
+            results.totalGuesses += n * wordListRun.counts[t].wins[n];
+        }
+
+        results.losses += wordListRun.counts[t].losses;
+        results.totalGuesses += maxGuesses * wordListRun.counts[t].losses;
+    }
+
+    printf("Word list: %s, %d letters, %d answers, %d words, %d threads\n",
+           filepath, list.wordLength, list.answerCount, list.wordCount, threadCount);
+    PrintResults(results);
+
+    PlatformFree(wordListRun.counts);
+    WordListFile::Free(list);
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 2 && strcmp(argv[1], "--words") == 0)
+    {
+        Jobs::Init((argc > 3) ? atoi(argv[3]) : 0);
+        int result = SimulateWordList(argv[2]);
+        Jobs::Shutdown();
+
+        return result;
+    }
+
+    const char* strategyName = (argc > 1) ? argv[1] : "entropy";
+    s32 threadCount = (argc > 2) ? atoi(argv[2]) : 0;
+
+    const Strategies::StrategyInfo* strategy = Strategies::Find(strategyName);
+    if (!strategy)
+    {
+        fprintf(stderr, "Unknown strategy '%s', pick one of:", strategyName);
+        for (s32 i = 0; i < Strategies::strategyCount; i++)
+            fprintf(stderr, " %s", Strategies::strategies[i].name);
+        fprintf(stderr, "\n");
+        return 1;
+    }
+
+    Jobs::Init(threadCount);
+
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+    {
+        printf("No feedback matrix at %s, building it...\n", FeedbackMatrix::defaultPath);
+        FeedbackMatrix::Build();
+    }
+
+    // Without a book the first two guesses of the entropy strategy are searched for
+    OpeningBook::Load(OpeningBook::defaultPath);
+    Strategies::Init();
+    StateCache::Init(StateCache::defaultCapacity);
+
+    Simulator::Results results = Simulator::Run(strategy->nextGuess);
+
+    printf("Strategy: %s, %d threads\n", strategy->name, Jobs::GetThreadCount());
+    PrintResults(results);
+
+    StateCache::Stats cacheStats = StateCache::GetStats();
+    if (cacheStats.hits + cacheStats.misses > 0)
+    {
+        printf("Cache:    %llu hits, %llu misses (%.1f%%), %llu evictions, %d / %d entries\n",
+               (unsigned long long) cacheStats.hits, (unsigned long long) cacheStats.misses, 100.0f * cacheStats.GetHitRate(),
+               (unsigned long long) cacheStats.evictions, cacheStats.size, cacheStats.capacity);
+    }
+
+    Simulator::Shutdown();
+    StateCache::Shutdown();
+    OpeningBook::Free();
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+// Plays every answer with a field of strategies and prints a leaderboard.
+//
+// Usage: tournament [--threads <count>] [--answers <count>] [strategy ...]
+//
+// Plays every built in strategy by default, plus the decision tree from
+// build_decision_tree if it's there. Thread count defaults to every hardware
+// thread. CPU time is summed over the threads that played for a strategy, so
+// it stays the same however many threads the tournament runs on.
+
+#include "core/types.h"
+#include "core/jobs.h"
+#include "game/board.h"
+#include "game/decision_tree.h"
+#include "game/feedback_matrix.h"
+#include "game/opening_book.h"
+#include "game/state_cache.h"
+#include "game/strategies.h"
+#include "game/tournament.h"
+#include "platform/platform.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// The offline solver's move, or the entropy guess if the board ever leaves the tree
+static s32 DecisionTreeGuess(const Board& board, Strategies::Scratch& scratch)
+{
+    s32 guess = DecisionTree::GetMove(board);
+    return (guess >= 0) ? guess : Strategies::MaxEntropy(board, scratch);
+}
+
+static bool RegisterByName(const char* name)
+{
+    if (strcmp(name, "tree") == 0)
+        return DecisionTree::IsLoaded() && Tournament::Register("tree", DecisionTreeGuess);
+
+    const Strategies::StrategyInfo* strategy = Strategies::Find(name);
+    return strategy && Tournament::Register(strategy->name, strategy->nextGuess);
+}
+
+static void PrintLeaderboard(const Tournament::Results& results)
+{
+    printf("%-4s %-12s %8s %8s %8s %10s %12s %12s\n",
+           "Rank", "Strategy", "Games", "Lost", "Mean", "Worst", "CPU (s)", "us/game");
+
+    for (s32 i = 0; i < results.entrantCount; i++)
+    {
+        const Tournament::Standing& standing = results.standings[i];
+
+        char worst[12];
+        if (standing.worstGuesses > maxGuesses)
+            snprintf(worst, sizeof(worst), "X");
+        else
+            snprintf(worst, sizeof(worst), "%d", standing.worstGuesses);
+
+        printf("%-4d %-12s %8u %8u %8.4f %10s %12.3f %12.1f\n",
+               i + 1, standing.name, standing.games, standing.losses, standing.GetMeanGuesses(), worst,
+               standing.cpuSeconds, (standing.games > 0) ? 1e6 * standing.cpuSeconds / standing.games : 0.0);
+    }
+
+    f64 cpuSeconds = 0.0;
+    for (s32 i = 0; i < results.entrantCount; i++)
+        cpuSeconds += results.standings[i].cpuSeconds;
+
+    // With every thread busy the whole time, CPU time over wall time comes out at the thread count
+    printf("\nWall:     %.3f s on %d threads, %u steals\n", results.seconds, results.threadCount, results.steals);
+    printf("Parallel: %.2fx (CPU time / wall time)\n", (results.seconds > 0.0) ? cpuSeconds / results.seconds : 0.0);
+}
+
+int main(int argc, char** argv)
+{
+    s32 threadCount = 0;
+    s32 answerCount = 0;
+
+    s32 firstName = 1;
+    while (firstName + 1 < argc && strncmp(argv[firstName], "--", 2) == 0)
+    {
+        if (strcmp(argv[firstName], "--threads") == 0)
+            threadCount = atoi(argv[firstName + 1]);
+        else if (strcmp(argv[firstName], "--answers") == 0)
+            answerCount = atoi(argv[firstName + 1]);
+        else
+            break;
+
+        firstName += 2;
+    }
+
+    Jobs::Init(threadCount);
+
+    if (!FeedbackMatrix::Load(FeedbackMatrix::defaultPath))
+    {
+        printf("No feedback matrix at %s, building it...\n", FeedbackMatrix::defaultPath);
+        FeedbackMatrix::Build();
+    }
+
+    DecisionTree::Load(DecisionTree::defaultPath);
+    OpeningBook::Load(OpeningBook::defaultPath);
+    Strategies::Init();
+    StateCache::Init(StateCache::defaultCapacity);
+
+    if (firstName < argc)
+    {
+        for (s32 i = firstName; i < argc; i++)
+        {
+            if (!RegisterByName(argv[i]))
+            {
+                fprintf(stderr, "Can't enter strategy '%s', pick from:", argv[i]);
+                for (s32 s = 0; s < Strategies::strategyCount; s++)
+                    fprintf(stderr, " %s", Strategies::strategies[s].name);
+                fprintf(stderr, " tree (needs %s)\n", DecisionTree::defaultPath);
+                return 1;
+            }
+        }
+    }
+    else
+    {
+        for (s32 i = 0; i < Strategies::strategyCount; i++)
+            RegisterByName(Strategies::strategies[i].name);
+
+        if (DecisionTree::IsLoaded())
+            RegisterByName("tree");
+    }
+
+    Tournament::Results results;
+    Tournament::Run(results, answerCount);
+    PrintLeaderboard(results);
+
+    StateCache::Stats cacheStats = StateCache::GetStats();
+    if (cacheStats.hits + cacheStats.misses > 0)
+    {
+        printf("Cache:    %llu hits, %llu misses (%.1f%%), %llu evictions, %d / %d entries\n",
+               (unsigned long long) cacheStats.hits, (unsigned long long) cacheStats.misses, 100.0f * cacheStats.GetHitRate(),
+               (unsigned long long) cacheStats.evictions, cacheStats.size, cacheStats.capacity);
+    }
+
+    Tournament::Shutdown();
+    StateCache::Shutdown();
+    OpeningBook::Free();
+    DecisionTree::Free();
+    FeedbackMatrix::Free();
+    Jobs::Shutdown();
+
+    return 0;
+}